@@ -0,0 +1,651 @@
+//*****************************************************************************
+//
+// ControllerBench.cpp
+//
+// Microbenchmarks of the code the Controller runs on every frame: packet
+// encoding, framing and decoding, angle serialization, finger angle
+// calculation, camera image conversion, pressure decoding and .hirc frame
+// I/O. Each kernel is timed over enough iterations to run for --min-time,
+// five times, and the median is reported in nanoseconds per operation along
+// with heap allocations per operation.
+//
+// A run can be saved as a baseline and later runs compared against it. A
+// kernel regresses when it is slower than the baseline by more than the
+// tolerance, or allocates more; the program then exits with status 1.
+// Baselines are only comparable on the same machine and build type.
+//
+// Usage: controller_bench [options]
+//   --baseline FILE   compare against a baseline saved with --save
+//   --save FILE       save this run as a baseline
+//   --tolerance PCT   slowdown allowed before a regression (default 15)
+//   --min-time MS     time spent on each of the five runs (default 200)
+//   --filter TEXT     only run kernels whose name contains TEXT
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h> /* mkstemp */
+
+#include "FrameKernels.h"
+#include "HIRCP.h"
+#include "HIRCPFrameReader.h"
+
+//*****************************************************************************
+//
+// Heap allocations, counted by replacing the global allocation functions
+//
+//*****************************************************************************
+static unsigned long long gAllocations = 0;
+
+void *operator new(std::size_t size)
+{
+    gAllocations++;
+    void *ptr = std::malloc(size ? size : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+//*****************************************************************************
+//
+// Keeps the compiler from optimizing away results and memory writes
+//
+//*****************************************************************************
+template <typename T>
+static inline void keep(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+static inline void clobber()
+{
+    asm volatile("" : : : "memory");
+}
+
+//*****************************************************************************
+//
+// Stand-in for Leap::Vector, with angleTo() computed as the Leap Motion SDK
+// documents it
+//
+//*****************************************************************************
+struct Vector
+{
+    float x;
+    float y;
+    float z;
+
+    float angleTo(const Vector &other) const
+    {
+        float denom = (x*x + y*y + z*z) *
+            (other.x*other.x + other.y*other.y + other.z*other.z);
+        if (denom <= 1e-5f)
+        {
+            return 0.0f;
+        }
+        float val = (x*other.x + y*other.y + z*other.z) / std::sqrt(denom);
+        if (val >= 1.0f)
+        {
+            return 0.0f;
+        }
+        else if (val <= -1.0f)
+        {
+            return 3.14159265f;
+        }
+        return std::acos(val);
+    }
+};
+
+//*****************************************************************************
+//
+// Kernels. Each runs its operation the given number of times.
+//
+//*****************************************************************************
+static const int NUM_POSES = 64;
+static const int BONES_PER_FINGER = 4;
+static const int IMAGE_PIXELS = 153600;     /* LeapData::_IMAGE_SIZE */
+static const int HIRC_FILE_FRAMES = 4096;
+static const int HIRC_HEADER_LEN = 5;
+static const int SOCKET_READ_LEN = 37;      /* Splits and merges packets */
+
+static HIRCPPacket gDataPacket;
+static HIRCPPacket gDackPacket;
+static HIRCPPacket gTimedDackPacket;
+static unsigned char gDackData[HIRCPPacket::MAX_PACKET_SIZE];
+static std::vector<unsigned char> gDackStream;
+static unsigned char gAngles[NUM_POSES][FrameKernels::HIRC_FRAME_LEN];
+static Vector gBones[NUM_POSES][BONES_PER_FINGER];
+static std::vector<unsigned char> gGrayImage;
+static std::vector<unsigned char> gRGBAImage;
+static std::string gHircPath;
+
+static void setUp()
+{
+    srand(1);
+    for (int i=0; i<NUM_POSES; i++)
+    {
+        for (int j=0; j<FrameKernels::HIRC_FRAME_LEN; j++)
+        {
+            gAngles[i][j] = static_cast<unsigned char>(rand() % 180);
+        }
+
+        //
+        // A finger curling by a different amount at each joint
+        //
+        float bend = 0.0f;
+        for (int b=0; b<BONES_PER_FINGER; b++)
+        {
+            bend += (rand() % 60) * 3.14159265f / 180;
+            gBones[i][b].x = 0.0f;
+            gBones[i][b].y = -std::sin(bend);
+            gBones[i][b].z = -std::cos(bend);
+        }
+    }
+
+    gDataPacket = HIRCPPacket::createDATAPacket(gAngles[0],
+        FrameKernels::HIRC_FRAME_LEN);
+
+    unsigned char payload[HIRCPPacket::MAX_PAYLOAD_LEN] =
+        { 0x03, 0x20, 0x02, 0xF0, 0x03, 0x80, 0x03, 0xF0, 0x03, 0xB0 };
+    gDackPacket.setType(HIRCPPacket::DACK);
+    gDackPacket.setPayload(payload, HIRCPPacket::MAX_PAYLOAD_LEN);
+    gDackPacket.getData(gDackData, HIRCPPacket::MAX_PACKET_SIZE);
+
+    //
+    // A whole number of socket reads of back to back DACK packets
+    //
+    for (int i=0; i<SOCKET_READ_LEN; i++)
+    {
+        gDackStream.insert(gDackStream.end(), gDackData,
+            gDackData+HIRCPPacket::MAX_PACKET_SIZE);
+    }
+
+    unsigned char timedPayload[HIRCPPacket::MAX_PAYLOAD_LEN] =
+        { 0x32, 0x02, 0xF0, 0x38, 0x03, 0xF0, 0x3B, 0x00, 0x00, 0x2A };
+    gTimedDackPacket.setType(HIRCPPacket::DACK);
+    gTimedDackPacket.setPayload(timedPayload, HIRCPPacket::MAX_PAYLOAD_LEN);
+
+    gGrayImage.resize(IMAGE_PIXELS);
+    gRGBAImage.resize(4*IMAGE_PIXELS);
+    for (int i=0; i<IMAGE_PIXELS; i++)
+    {
+        gGrayImage[i] = static_cast<unsigned char>(rand());
+    }
+
+    //
+    // A recording to read frames from
+    //
+    char path[] = "/tmp/controller_bench_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    gHircPath = path;
+    std::ofstream file(gHircPath, std::ofstream::binary);
+    file << "HIRC" << static_cast<char>(60);
+    for (int i=0; i<HIRC_FILE_FRAMES; i++)
+    {
+        FrameKernels::writeHIRCFrame(file, gAngles[i % NUM_POSES],
+            gAngles[i % NUM_POSES][NUM_FINGERS]);
+    }
+}
+
+static void tearDown()
+{
+    std::remove(gHircPath.c_str());
+}
+
+static void benchGetData(unsigned long iterations)
+{
+    unsigned char buf[HIRCPPacket::MAX_PACKET_SIZE];
+
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        gDataPacket.getData(buf, HIRCPPacket::MAX_PACKET_SIZE);
+        clobber();
+    }
+}
+
+static void benchPopulate(unsigned long iterations)
+{
+    HIRCPPacket packet;
+
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        packet.populate(gDackData, HIRCPPacket::MAX_PACKET_SIZE);
+        keep(packet);
+    }
+}
+
+static void benchFrameReader(unsigned long iterations)
+{
+    static HIRCPFrameReader reader;
+    unsigned char packet[HIRCPPacket::MAX_PACKET_SIZE];
+    unsigned int offset = 0;
+    unsigned long packets = 0;
+
+    reader.reset();
+    while (packets < iterations)
+    {
+        unsigned char *space;
+        unsigned int len = std::min(reader.getSpace(space),
+            static_cast<unsigned int>(SOCKET_READ_LEN));
+        len = std::min(len,
+            static_cast<unsigned int>(gDackStream.size()) - offset);
+        std::memcpy(space, &gDackStream[offset], len);
+        reader.commit(len);
+        offset = (offset + len) % gDackStream.size();
+
+        while (packets < iterations && reader.next(packet))
+        {
+            keep(packet);
+            packets++;
+        }
+    }
+}
+
+static void benchSerialize(unsigned long iterations)
+{
+    unsigned char buf[256]; /* LeapData::_MAX_PAYLOAD */
+
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        const unsigned char *angles = gAngles[i % NUM_POSES];
+        FrameKernels::serializeAngles(angles, angles[NUM_FINGERS], buf,
+            sizeof(buf));
+        clobber();
+    }
+}
+
+static void benchTotalAngle(unsigned long iterations)
+{
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        float angle = FrameKernels::totalAngle(gBones[i % NUM_POSES],
+            BONES_PER_FINGER, 1.2f);
+        keep(angle);
+    }
+}
+
+static void benchGrayscaleToRGBA(unsigned long iterations)
+{
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        FrameKernels::grayscaleToRGBA(gGrayImage.data(), gRGBAImage.data(),
+            IMAGE_PIXELS);
+        clobber();
+    }
+}
+
+//
+// As Panel::_populateFingerPressureStruct(), which takes the packet by value
+//
+static void decodePacket(HIRCPPacket packet, bool timedDack,
+    unsigned char *pressure)
+{
+    unsigned char buf[HIRCPPacket::MAX_PAYLOAD_LEN];
+    packet.getPayload(buf, HIRCPPacket::MAX_PAYLOAD_LEN);
+    unsigned int age = FrameKernels::decodeFingerPressures(buf, timedDack,
+        pressure);
+    keep(age);
+}
+
+static void benchPressures(unsigned long iterations)
+{
+    unsigned char pressure[NUM_FINGERS];
+
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        decodePacket(gDackPacket, false, pressure);
+        clobber();
+    }
+}
+
+static void benchTimedPressures(unsigned long iterations)
+{
+    unsigned char pressure[NUM_FINGERS];
+
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        decodePacket(gTimedDackPacket, true, pressure);
+        clobber();
+    }
+}
+
+static void benchWriteFrame(unsigned long iterations)
+{
+    static std::ofstream file("/dev/null", std::ofstream::binary);
+
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        const unsigned char *angles = gAngles[i % NUM_POSES];
+        FrameKernels::writeHIRCFrame(file, angles, angles[NUM_FINGERS]);
+    }
+}
+
+static void benchReadFrame(unsigned long iterations)
+{
+    static std::ifstream file(gHircPath, std::ifstream::binary);
+    unsigned char totalAngle[NUM_FINGERS];
+    unsigned char wristAngle;
+
+    for (unsigned long i=0; i<iterations; i++)
+    {
+        if (!FrameKernels::readHIRCFrame(file, totalAngle, wristAngle))
+        {
+            file.clear();
+            file.seekg(HIRC_HEADER_LEN);
+        }
+        keep(totalAngle);
+        keep(wristAngle);
+    }
+}
+
+struct Kernel
+{
+    const char *name;
+    void (*run)(unsigned long iterations);
+};
+
+static const Kernel KERNELS[] =
+{
+    { "HIRCPPacket::getData", benchGetData },
+    { "HIRCPPacket::populate", benchPopulate },
+    { "HIRCPFrameReader split and merged reads", benchFrameReader },
+    { "LeapMotionManager::serialize", benchSerialize },
+    { "LeapMotionManager::_calculateTotalAngle", benchTotalAngle },
+    { "LeapMotionManager grayscale to RGBA", benchGrayscaleToRGBA },
+    { "Panel::_populateFingerPressureStruct", benchPressures },
+    { "Panel::_populateFingerPressureStruct timed", benchTimedPressures },
+    { "PlaybackRecorder .hirc frame write", benchWriteFrame },
+    { "PlaybackStreamer .hirc frame read", benchReadFrame },
+};
+
+//*****************************************************************************
+//
+// Measurement
+//
+//*****************************************************************************
+struct Result
+{
+    double nsPerOp;
+    double allocsPerOp;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+static double timeRun(const Kernel &kernel, unsigned long iterations,
+    unsigned long long &allocations)
+{
+    unsigned long long allocationsBefore = gAllocations;
+    Clock::time_point begin = Clock::now();
+    kernel.run(iterations);
+    Clock::time_point end = Clock::now();
+    allocations = gAllocations - allocationsBefore;
+
+    return std::chrono::duration<double, std::nano>(end - begin).count();
+}
+
+//*****************************************************************************
+//
+//! Times a kernel. The number of iterations is first doubled until a run
+//! takes a tenth of minTimeNs, then scaled to take minTimeNs.
+//!
+//! \param kernel the kernel to time.
+//! \param minTimeNs time each of the five runs should take.
+//!
+//! \return The median time and the allocations per operation.
+//
+//*****************************************************************************
+static Result measure(const Kernel &kernel, double minTimeNs)
+{
+    const int RUNS = 5;
+    unsigned long long allocations;
+    unsigned long iterations = 1;
+    double elapsed;
+
+    while ((elapsed = timeRun(kernel, iterations, allocations)) <
+        minTimeNs/10)
+    {
+        iterations *= 2;
+    }
+    iterations = std::max(1UL,
+        static_cast<unsigned long>(iterations*minTimeNs/elapsed));
+
+    std::vector<double> nsPerOp;
+    unsigned long long totalAllocations = 0;
+    for (int i=0; i<RUNS; i++)
+    {
+        nsPerOp.push_back(timeRun(kernel, iterations, allocations)/
+            iterations);
+        totalAllocations += allocations;
+    }
+    std::sort(nsPerOp.begin(), nsPerOp.end());
+
+    Result result;
+    result.nsPerOp = nsPerOp[RUNS/2];
+    result.allocsPerOp = static_cast<double>(totalAllocations)/
+        (static_cast<double>(iterations)*RUNS);
+    return result;
+}
+
+//*****************************************************************************
+//
+// Baselines, one kernel per line: name, ns/op and allocs/op separated by
+// tabs
+//
+//*****************************************************************************
+static bool loadBaseline(const std::string &path,
+    std::map<std::string, Result> &baseline)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        std::cerr << "[ERROR] Cannot read baseline " << path << std::endl;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::istringstream fields(line);
+        std::string name;
+        Result result;
+        if (line.empty() || line[0] == '#' ||
+            !std::getline(fields, name, '\t') ||
+            !(fields >> result.nsPerOp >> result.allocsPerOp))
+        {
+            continue;
+        }
+        baseline[name] = result;
+    }
+
+    return true;
+}
+
+static bool saveBaseline(const std::string &path,
+    const std::vector<std::pair<std::string, Result> > &results)
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        std::cerr << "[ERROR] Cannot write baseline " << path << std::endl;
+        return false;
+    }
+
+    file << "# kernel\tns/op\tallocs/op" << std::endl;
+    for (auto &entry : results)
+    {
+        file << entry.first << '\t' << entry.second.nsPerOp << '\t'
+            << entry.second.allocsPerOp << std::endl;
+    }
+
+    return true;
+}
+
+static void usage(const char *name)
+{
+    std::cerr << "Usage: " << name << " [--baseline FILE] [--save FILE] "\
+        "[--tolerance PCT] [--min-time MS] [--filter TEXT]" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string baselinePath;
+    std::string savePath;
+    std::string filter;
+    double tolerance = 15;
+    double minTimeMs = 200;
+
+    for (int i=1; i<argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i+1 >= argc)
+        {
+            usage(argv[0]);
+            return (arg == "--help") ? 0 : 2;
+        }
+        if (arg == "--baseline")
+        {
+            baselinePath = argv[++i];
+        }
+        else if (arg == "--save")
+        {
+            savePath = argv[++i];
+        }
+        else if (arg == "--tolerance")
+        {
+            tolerance = std::atof(argv[++i]);
+        }
+        else if (arg == "--min-time")
+        {
+            minTimeMs = std::atof(argv[++i]);
+        }
+        else if (arg == "--filter")
+        {
+            filter = argv[++i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    std::map<std::string, Result> baseline;
+    if (!baselinePath.empty() && !loadBaseline(baselinePath, baseline))
+    {
+        return 2;
+    }
+
+    setUp();
+
+    std::cout << std::left << std::setw(44) << "kernel" << std::right
+        << std::setw(12) << "ns/op" << std::setw(11) << "allocs/op";
+    if (!baselinePath.empty())
+    {
+        std::cout << std::setw(12) << "baseline" << std::setw(9) << "change";
+    }
+    std::cout << std::endl;
+
+    std::vector<std::pair<std::string, Result> > results;
+    int regressions = 0;
+    for (const Kernel &kernel : KERNELS)
+    {
+        if (std::string(kernel.name).find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        Result result = measure(kernel, minTimeMs*1e6);
+        results.push_back(std::make_pair(kernel.name, result));
+
+        std::cout << std::left << std::setw(44) << kernel.name << std::right
+            << std::fixed << std::setprecision(2) << std::setw(12)
+            << result.nsPerOp << std::setw(11) << result.allocsPerOp;
+
+        auto it = baseline.find(kernel.name);
+        if (it != baseline.end())
+        {
+            const Result &base = it->second;
+            double change = (result.nsPerOp/base.nsPerOp - 1)*100;
+            bool regressed = (change > tolerance) ||
+                (result.allocsPerOp > base.allocsPerOp + 0.005);
+            std::cout << std::setw(12) << base.nsPerOp << std::setw(8)
+                << std::showpos << std::setprecision(1) << change << '%'
+                << std::noshowpos << (regressed ? "  REGRESSION" : "");
+            regressions += regressed ? 1 : 0;
+        }
+        else if (!baselinePath.empty())
+        {
+            std::cout << std::setw(12) << "-" << std::setw(9) << "new";
+        }
+        std::cout << std::endl;
+    }
+
+    tearDown();
+
+    if (!savePath.empty() && !saveBaseline(savePath, results))
+    {
+        return 2;
+    }
+
+    if (regressions > 0)
+    {
+        std::cout << regressions << " kernel(s) regressed by more than "
+            << tolerance << "% or allocate more than the baseline."
+            << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+//*****************************************************************************
+//
+// Backoff.h
+//
+// Delays between retries that double up to a limit, with jitter so that
+// several controllers retrying after the same outage do not stay in step.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _BACKOFF_H_
+#define _BACKOFF_H_
+
+#include <random>
+
+class Backoff
+{
+private:
+    /* Fields */
+    int _initialMs;
+    int _maxMs;
+    int _attempts;
+    std::mt19937 _random;
+
+public:
+    /* Constructor */
+    Backoff(int initialMs, int maxMs);
+
+    /* Methods */
+    int nextDelayMs();
+    int getAttempts();
+    void reset();
+};
+
+#endif /* _BACKOFF_H_ */
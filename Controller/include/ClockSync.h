@@ -0,0 +1,74 @@
+//*****************************************************************************
+//
+// ClockSync.h
+//
+// Class that relates the controller's clock to the robot's from timestamp
+// exchanges, as NTP does. Each exchange gives a sample of the offset
+// between the clocks; a line fitted through the samples with the shortest
+// round trips gives the offset and the drift. Times are in microseconds.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _CLOCKSYNC_H_
+#define _CLOCKSYNC_H_
+
+#include <deque>
+
+class ClockSync
+{
+private:
+    /* Types */
+    struct Sample
+    {
+        double local;                   // Midpoint of the round trip
+        double offset;                  // Robot clock less local clock
+        double delay;                   // Round trip
+    };
+
+    /* Fields */
+    std::deque<Sample> _samples;
+    unsigned int _robotLast;            // Last robot reading, to unwrap it
+    double _robotWraps;                 // Microseconds lost to wrapping
+    double _offset;                     // At _reference
+    double _drift;                      // Microseconds per microsecond
+    double _reference;
+    double _error;
+    double _uplink;
+    double _downlink;
+
+    /* Methods */
+    void _fit();
+
+public:
+    /* Constants */
+    static const int MAX_SAMPLES = 64;
+    static const int MIN_DRIFT_SPAN_S = 10;    // Shorter spans give offset only
+    static const int MAX_DRIFT_PPM = 500;      // Beyond any crystal
+
+    /* Constructor */
+    ClockSync();
+
+    /* Destructor */
+    ~ClockSync();
+
+    /* Methods */
+    void add(double localSent, unsigned int robotTime, double localReceived);
+    void reset();
+    bool isSynchronized();
+    double toRobot(double local);
+    double getOffset();
+    double getDriftPpm();
+    double getError();
+    double getUplink();
+    double getDownlink();
+};
+
+#endif /* _CLOCKSYNC_H_ */
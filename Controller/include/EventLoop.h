@@ -0,0 +1,66 @@
+//*****************************************************************************
+//
+// EventLoop.h
+//
+// Waits on a set of sockets with poll() (WSAPoll() on Windows) and calls a
+// handler for each socket that becomes ready.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _EVENTLOOP_H_
+#define _EVENTLOOP_H_
+
+#include <functional>
+#include <vector>
+
+#include "Network.h"
+
+class EventLoop
+{
+public:
+    /* Types */
+    enum EVENT
+    {
+        EVENT_READ = 0x01,
+        EVENT_WRITE = 0x02,
+        EVENT_ERROR = 0x04,
+    };
+
+    typedef std::function<void(int sockfd, int events)> Handler;
+
+private:
+    /* Types */
+    struct Watch
+    {
+        int sockfd;
+        int events;
+        Handler handler;
+    };
+
+    /* Fields */
+    std::vector<Watch> _watches;
+    std::vector<struct pollfd> _pollfds;
+
+    /* Methods */
+    static short _toPollEvents(int events);
+    static int _fromPollEvents(short revents);
+
+public:
+    /* Methods */
+    bool add(int sockfd, int events, Handler handler);
+    bool modify(int sockfd, int events);
+    void remove(int sockfd);
+    bool empty();
+    int runOnce(int timeoutMs);
+    static int wait(int sockfd, int events, int timeoutMs);
+};
+
+#endif /* _EVENTLOOP_H_ */
@@ -0,0 +1,84 @@
+//*****************************************************************************
+//
+// FastConnector.h
+//
+// Connects to whichever of several robot addresses answers first. Every
+// candidate is connected to at once without blocking, and the first to
+// complete the CRQ/ACK handshake is kept. Alternatively every robot that
+// completes the handshake is kept.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _FASTCONNECTOR_H_
+#define _FASTCONNECTOR_H_
+
+#include <memory>
+#include <vector>
+
+#include "EventLoop.h"
+#include "HIRCP.h"
+#include "HIRCPFrameReader.h"
+#include "IPv4Address.h"
+#include "TCPSocket.h"
+
+class FastConnector
+{
+public:
+    /* Types */
+    struct Connection
+    {
+        std::unique_ptr<TCPSocket> socket;
+        HIRCPFrameReader frameReader;   // Holds anything sent after the ACK
+        unsigned char ack[HIRCPPacket::MAX_PACKET_SIZE];
+        int candidate;                  // Index of the address connected to
+    };
+
+private:
+    /* Types */
+    struct Attempt
+    {
+        std::unique_ptr<TCPSocket> socket;
+        HIRCPFrameReader frameReader;
+        unsigned char ack[HIRCPPacket::MAX_PACKET_SIZE];
+        bool handshaking;               // CRQ sent, waiting for the ACK
+        bool accepted;                  // ACK received
+    };
+
+    /* Fields */
+    int _socketTimeoutMs;
+    TCPSocket::Profile _profile;
+
+    /* Methods */
+    int _run(const std::vector<IPv4Address> &addresses,
+        const unsigned char *crq, int timeoutMs, bool all,
+        std::vector<Attempt> &attempts);
+    void _handle(Attempt &attempt, EventLoop &loop, int sockfd,
+        const unsigned char *crq);
+    bool _sendCRQ(Attempt &attempt, const unsigned char *crq);
+    void _fail(Attempt &attempt, EventLoop &loop, int sockfd);
+
+public:
+    /* Constants */
+    static const unsigned int MAX_CANDIDATES = 16;
+
+    /* Constructor */
+    FastConnector();
+
+    /* Methods */
+    void setSocketOptions(int timeoutMs, const TCPSocket::Profile &profile);
+    bool connect(const std::vector<IPv4Address> &addresses,
+        const unsigned char *crq, int timeoutMs, Connection &connection);
+    int connectAll(const std::vector<IPv4Address> &addresses,
+        const unsigned char *crq, int timeoutMs,
+        std::vector<Connection> &connections);
+};
+
+#endif /* _FASTCONNECTOR_H_ */
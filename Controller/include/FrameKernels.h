@@ -0,0 +1,92 @@
+//*****************************************************************************
+//
+// FrameKernels.h
+//
+// Computations run on every frame, kept free of the Leap Motion, SDL and
+// Windows headers so they can be built and benchmarked on any platform
+// (see bench/).
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _FRAMEKERNELS_H_
+#define _FRAMEKERNELS_H_
+
+#include <istream>
+#include <ostream>
+
+#ifndef NUM_FINGERS
+#define NUM_FINGERS 5
+#endif
+
+class FrameKernels
+{
+public:
+    /* Constants */
+    static const int HIRC_FRAME_LEN = NUM_FINGERS+1; // NUM_FINGERS + WRIST
+
+    /* Methods */
+    static void serializeAngles(const unsigned char *totalAngle,
+        unsigned char wristAngle, unsigned char *buf, unsigned int buflen);
+    template <typename Vector>
+    static float totalAngle(const Vector *vectors, unsigned int size,
+        float scale);
+    static void grayscaleToRGBA(const unsigned char *gray,
+        unsigned char *rgba, int pixels);
+    static unsigned int decodeFingerPressures(const unsigned char *payload,
+        bool timedDack, unsigned char *pressure);
+    static void writeHIRCFrame(std::ostream &file,
+        const unsigned char *totalAngle, unsigned char wristAngle);
+    static bool readHIRCFrame(std::istream &file, unsigned char *totalAngle,
+        unsigned char &wristAngle);
+};
+
+//*****************************************************************************
+//
+//! Calculates the total angle (in radians) between consecutive vectors.
+//! Vector is Leap::Vector in the application; any type with an angleTo()
+//! returning radians will do.
+//!
+//! \param vectors the array of vectors.
+//! \param size the length of the array.
+//! \param scale factor applied to each angle.
+//!
+//! \return Returns the total angle (in radians) between the vectors.
+//
+//*****************************************************************************
+template <typename Vector>
+float FrameKernels::totalAngle(const Vector *vectors, unsigned int size,
+    float scale)
+{
+    float angle = 0;
+
+    for (unsigned int i=0; i<size-1; i++)
+    {
+        float temp = vectors[i].angleTo(vectors[i+1])*scale;
+        angle += temp;
+        //
+        // Adds rotation to account for the case where the finger is pointed
+        // directly down
+        //
+        if (i==0 && (angle>40))
+        {
+            angle += 50;
+        }
+    }
+
+    if (angle > 255)
+    {
+        angle = 255;
+    }
+
+    return angle;
+}
+
+#endif /* _FRAMEKERNELS_H_ */
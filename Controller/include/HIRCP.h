@@ -45,6 +45,13 @@ public:
         TRQ,
         ACK,
         ERR,
+        FSET,
+        STATS,
+        TRAJ,
+        BEACON,
+        PING,
+        PONG,
+        NUM_TYPES,
     };
 
     enum FEEDBACK_MODE
@@ -52,8 +59,90 @@ public:
         INVALID_MODE = 0,
         NORMAL_MODE,
         CLOSED_LOOP_MODE,
+        HYBRID_MODE,
     };
 
+    /* Options requested by a CRQ packet and granted by its ACK */
+    enum OPTION
+    {
+        TIMED_DACK = 0x01,
+        STAMPED_DATA = 0x02,
+    };
+
+    /* Where a stamped DATA packet carries its send time on the robot's
+       clock */
+    static const int DATA_STAMP_OFFSET = 6;
+
+    /* Discovery beacons, broadcast over UDP by every robot */
+    static const unsigned short BEACON_PORT = 5002;
+    static const int BEACON_VERSION = 1;
+
+    /* Capabilities a BEACON packet advertises */
+    enum CAPABILITY
+    {
+        CAPABILITY_TIMED_DACK = 0x01,
+        CAPABILITY_HYBRID = 0x02,
+        CAPABILITY_TRAJECTORY = 0x04,
+        CAPABILITY_BUSY = 0x08,
+    };
+
+    /* Unit of the sensor age carried by a timed DACK packet */
+    static const int SENSOR_AGE_UNIT_US = 100;
+
+    /* Statistics a STATS packet asks for */
+    enum STATS_KIND
+    {
+        PLAYBACK_STATS = 0,
+        PROFILE_STATS,
+        LATENCY_STATS,
+    };
+
+    /* Units of the target and times reported by playback STATS packets */
+    static const int PLAYBACK_PERIOD_US = 20000;
+    static const int PLAYBACK_UNIT_US = 100;
+
+    /* Unit of the one-way latencies reported by latency STATS packets */
+    static const int LATENCY_UNIT_US = 100;
+
+    /* Firmware sections reported by profile STATS packets, and the unit
+       of their times */
+    static const int NUM_PROFILE_SECTIONS = 6;
+    static const int PROFILE_UNIT_NS = 100;
+
+    /* Trajectory commands, results of a TRAJ reply, and states it reports */
+    enum TRAJ_COMMAND
+    {
+        TRAJ_BEGIN = 0,
+        TRAJ_CHUNK,
+        TRAJ_END,
+        TRAJ_PLAY,
+        TRAJ_PAUSE,
+        TRAJ_STOP,
+        TRAJ_STATUS,
+    };
+
+    enum TRAJ_RESULT
+    {
+        TRAJ_OK = 0,
+        TRAJ_REJECTED,
+        TRAJ_BAD_CHECKSUM,
+        TRAJ_INCOMPLETE,
+        TRAJ_NOT_READY,
+    };
+
+    enum TRAJ_STATE
+    {
+        TRAJ_EMPTY = 0,
+        TRAJ_UPLOADING,
+        TRAJ_READY,
+        TRAJ_PLAYING,
+        TRAJ_PAUSED,
+    };
+
+    /* Size of a trajectory frame, and the most frames the robot holds */
+    static const int TRAJ_FRAME_LEN = 6;
+    static const int TRAJ_MAX_FRAMES = 2048;
+
     /* Constructor */
     HIRCPPacket();
 
@@ -70,21 +159,40 @@ public:
     void populate(unsigned char *buf, int len);
 
     /* Static methods */
-    static HIRCPPacket createCRQPacket(FEEDBACK_MODE mode);
+    static HIRCPPacket createCRQPacket(FEEDBACK_MODE mode,
+        unsigned char options = 0);
     static HIRCPPacket createMODEPacket(FEEDBACK_MODE mode);
     static HIRCPPacket createDATAPacket(unsigned char *payload, int len);
+    static HIRCPPacket createFSETPacket(const unsigned short *setpoints,
+        int count);
+    static HIRCPPacket createSTATSPacket(STATS_KIND kind = PLAYBACK_STATS,
+        unsigned char section = 0);
+    static HIRCPPacket createTRAJBeginPacket(unsigned char fps, int frames);
+    static HIRCPPacket createTRAJChunkPacket(int index,
+        const unsigned char *frame);
+    static HIRCPPacket createTRAJEndPacket(unsigned short checksum);
+    static HIRCPPacket createTRAJPlayPacket(bool loop);
+    static HIRCPPacket createTRAJPacket(TRAJ_COMMAND command);
     static HIRCPPacket createTRQPacket();
+    static HIRCPPacket createPINGPacket(unsigned short sequence,
+        unsigned int timestampUs);
     static HIRCPPacket createEmptyPacket();
+    static unsigned short trajectoryChecksum(const unsigned char *frames,
+        int len);
 
 private:
     /* Fields */
-    static const int CRQ_PAYLOAD_LEN = 1;
+    static const int CRQ_PAYLOAD_LEN = 2;
     static const int MODE_PAYLOAD_LEN = 1;
     static const int DATA_PAYLOAD_LEN = 6;
     static const int DACK_PAYLOAD_LEN = 10;
     static const int TRQ_PAYLOAD_LEN = 0;
     static const int ACK_PAYLOAD_LEN = 0;
     static const int ERR_PAYLOAD_LEN = 1;
+    static const int FSET_PAYLOAD_LEN = 10;
+    static const int STATS_PAYLOAD_LEN = 10;
+    static const int TRAJ_PAYLOAD_LEN = 10;
+    static const int PING_PAYLOAD_LEN = 10;
 
     TYPE _type;
     unsigned char _payload[MAX_PAYLOAD_LEN];
@@ -0,0 +1,50 @@
+//*****************************************************************************
+//
+// HIRCPFrameReader.h
+//
+// Collects bytes received from the robot in a ring buffer and hands them out
+// as whole HIRCP packets, however TCP split or merged them.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _HIRCPFRAMEREADER_H_
+#define _HIRCPFRAMEREADER_H_
+
+class HIRCPFrameReader
+{
+public:
+    /* Constants */
+    static const unsigned int BUFFER_SIZE = 256; // Must be a power of two
+
+    /* Constructor */
+    HIRCPFrameReader();
+
+    /* Methods */
+    void reset();
+    unsigned int getSpace(unsigned char *&space);
+    void commit(unsigned int len);
+    bool next(unsigned char *packet);
+    unsigned int getBuffered();
+    unsigned long getDiscarded();
+
+private:
+    /* Fields */
+    unsigned char _buf[BUFFER_SIZE];
+    unsigned int _head;
+    unsigned int _tail;
+    unsigned long _discarded;
+
+    /* Methods */
+    unsigned char _peek(unsigned int offset);
+    bool _startsPacket(unsigned int buffered);
+};
+
+#endif /* _HIRCPFRAMEREADER_H_ */
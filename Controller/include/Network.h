@@ -11,7 +11,7 @@
 // December 27, 2015
 //
 // Modified:
-// December 30, 2015
+// October 19, 2026
 //
 //*****************************************************************************
 #ifndef _NETWORK_H_
@@ -19,15 +19,30 @@
 
 #define _WINSOCK_DEPRECATED_NO_WARNINGS
 
+#ifdef _WIN32
 #include <winsock2.h>
+#include <ws2tcpip.h>
+#include <mstcpip.h>
 
 typedef int socklen_t;
 typedef int ssize_t;
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
 
 namespace network
 {
     bool initialize();
     void terminate();
+    int poll(struct pollfd *fds, unsigned int nfds, int timeoutMs);
+    bool setNonBlocking(int sockfd, bool nonBlocking);
+    int getLastError();
+    bool isWouldBlock(int error);
 }
 
 #endif /* _NETWORK_H_ */
@@ -20,46 +20,160 @@
 #define _WINSOCK_DEPRECATED_NO_WARNINGS
 #define WIN32_LEAN_AND_MEAN
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 #include <windows.h>
 
 #include <SDL.h>
 
+#include "ClockSync.h"
 #include "FrameRateManager.h"
 #include "Hand.h"
 #include "HIRCP.h"
+#include "HIRCPFrameReader.h"
 #include "IObservable.h"
+#include "IPv4Address.h"
 #include "Network.h"
 #include "PlaybackRecorder.h"
 #include "PlaybackStreamer.h"
+#include "RobotSet.h"
+#include "RttEstimator.h"
 #include "TCPSocket.h"
+#include "TimingStats.h"
 
 class Window;
 
 class Panel : public IObservable
 {
 private:
+    /* Types */
+    enum FRAME_STAGE
+    {
+        STAGE_TRACKING = 0,
+        STAGE_NETWORK,
+        STAGE_RENDER,
+        STAGE_FRAME,
+        NUM_FRAME_STAGES,
+    };
+
+    enum ROBOT_PLAYBACK_REQUEST
+    {
+        ROBOT_NONE = 0,
+        ROBOT_PLAY,
+        ROBOT_LOOP,
+        ROBOT_PAUSE,
+        ROBOT_RESUME,
+        ROBOT_STOP,
+    };
+
+    /* Constants */
+    static const int NUM_STATS_REPLIES = HIRCPPacket::NUM_PROFILE_SECTIONS+2;
+
     /* Fields */
     SDL_Window *_window;
     SDL_Renderer *_renderer;
     std::unique_ptr<Hand> _hand;
     std::unique_ptr<TCPSocket> _socket;
     std::mutex _socket_mutex;
+    HIRCPFrameReader _frameReader;
     FrameRateManager _fpsManager;
     std::unique_ptr<PlaybackRecorder> _playbackRecorder;
     std::unique_ptr<PlaybackStreamer> _playbackStreamer;
-    bool _connected;
-    HIRCPPacket::FEEDBACK_MODE _mode;
+    std::atomic<bool> _connected;       // Written under _socket_mutex
+    std::atomic<HIRCPPacket::FEEDBACK_MODE> _mode;
+    std::atomic<bool> _modePending;     // MODE packet to send with a pose
+    bool _timedDack;
+    unsigned int _feedbackAge;
+    std::mutex _forceMutex;             // Guards the setpoints below
+    unsigned short _forceSetpoints[NUM_FINGERS];
+    bool _forceSetpointsSet;            // Sent on every connection
+    bool _forceSetpointsPending;
     int _cachedFPS;
+    TimingStats _frameStats[NUM_FRAME_STAGES];
+    TimingStats::Clock::time_point _lastProfileReport;
+    std::mutex _robotPlaybackMutex;
+    ROBOT_PLAYBACK_REQUEST _robotRequest;
+    std::string _robotFilePath;
+    bool _robotLoop;
+    HIRCPPacket::TRAJ_STATE _robotState;
+    TimingStats::Clock::time_point _lastRobotStatus;
+    IPv4Address _peer;                  // Reconnected to if the link is lost
+    std::thread _reconnectThread;
+    std::mutex _reconnectMutex;         // Guards the fields below
+    std::condition_variable _reconnectCondition;
+    bool _reconnecting;
+    bool _reconnectCancelled;
+    unsigned char _latestPose[HIRCPPacket::MAX_PAYLOAD_LEN];
+    bool _latestPoseValid;
+    RttEstimator _roundTrip;            // Measured by PING packets
+    unsigned int _pingsSent;
+    unsigned int _pongsReceived;
+    TimingStats::Clock::time_point _lastPing;
+    unsigned char _heldPacket[HIRCPPacket::MAX_PACKET_SIZE];
+    bool _heldValid;                    // Read past while draining replies
+    TimingStats::Clock::time_point _lastReceived;  // Latest read's arrival
+    unsigned char _statsReplies[NUM_STATS_REPLIES]
+        [HIRCPPacket::MAX_PAYLOAD_LEN]; // Profile, playback, then latency
+    int _statsNext;                     // STATS packet to send or answer
+    int _statsEnd;                      // STATS packets polled this round
+    bool _statsAwaiting;                // _statsNext sent, not answered yet
+    ClockSync _clock;                   // Robot's clock, from PONG packets
+    bool _stampedData;
+    TimingStats _uplinkStats;           // One-way latencies of PINGs
+    TimingStats _downlinkStats;         // and PONGs
+    TimingStats _sensorAgeStats;        // Age of DACK pressures on arrival
+    RobotSet _mirrors;                  // Sent the same poses, DATA only
+    std::thread _networkThread;         // Exchanges poses with the robot
+    std::mutex _poseMutex;              // Guards the fields below
+    std::condition_variable _poseCondition;
+    unsigned char _pose[HIRCPPacket::MAX_PAYLOAD_LEN];
+    bool _poseReady;                    // _pose handed over, not yet taken
+    bool _poseModeChanged;
+    bool _networkStopped;
+    unsigned char _pressure[NUM_FINGERS];  // From the latest DACK
+    TimingStats _exchangeStats;
+    unsigned int _posesSkipped;         // Replaced before being sent
+    std::atomic<bool> _reportPending;   // Report for the network thread
 
     /* Methods */
     bool _initialize();
     void _update(LeapData &leapData,
         FingerPressureStruct &fingerPressures);
     void _render();
+    void _network();
+    bool _exchange(const unsigned char *pose, bool modeChanged,
+        FingerPressureStruct &fingerPressures);
     bool _populateFingerPressureStruct(FingerPressureStruct &fingerPressures,
         HIRCPPacket packet);
+    bool _recvPacket(unsigned char *message);
+    bool _sendPing();
+    bool _drainReplies();
+    bool _takeReply(const unsigned char *message);
+    void _recordPong(const unsigned char *message);
+    void _recordStats(const unsigned char *message);
+    void _stampPose(unsigned char *payload);
+    static double _localMicros(TimingStats::Clock::time_point time);
+    int _open(const std::vector<IPv4Address> &candidates, int timeoutMs,
+        const unsigned char *pose);
+    bool _sendTRQ();
+    void _linkLost();
+    void _reconnect();
+    bool _stopReconnect();
+    void _reportProfile();
+    void _reportConnection();
+    bool _sendStats();
+    void _reportRobot();
+    void _reportPlayback(const unsigned char *payload);
+    void _reportLatency(const unsigned char *payload);
+    bool _sendForceSetpoints();
+    bool _serviceRobotPlayback();
+    bool _uploadTrajectory(const std::string &filePath, bool &uploaded);
+    bool _sendTrajectoryCommand(HIRCPPacket &packet, unsigned char *reply);
 
 public:
     /* Constructor */
@@ -71,7 +185,12 @@ public:
     /* Methods */
     void run();
     bool connect(char *ipAddressString);
+    int connect(const std::vector<std::string> &candidates);
+    int connect(const std::vector<IPv4Address> &candidates);
     bool disconnect();
+    bool isReconnecting();
+    int addMirrors(const std::vector<IPv4Address> &addresses);
+    void removeMirrors();
     bool send(HIRCPPacket &packet);
     bool recv(HIRCPPacket &packet);
     bool startRecording(char *filePath);
@@ -79,6 +198,12 @@ public:
     bool startStreaming(char *filePath);
     bool stopStreaming();
     bool setFeedbackMode(HIRCPPacket::FEEDBACK_MODE mode);
+    unsigned int getFeedbackAge();
+    bool setForceSetpoints(const unsigned short *setpoints);
+    double getRoundTrip();
+    bool startRobotPlayback(char *filePath, bool loop);
+    bool pauseRobotPlayback(bool pause);
+    bool stopRobotPlayback();
 };
 
 #endif /* _PANEL_H_ */
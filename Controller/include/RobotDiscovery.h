@@ -0,0 +1,82 @@
+//*****************************************************************************
+//
+// RobotDiscovery.h
+//
+// Keeps a table of the robots on the local network. A background thread
+// listens for the BEACON packets every robot broadcasts, so the robots are
+// known before the user asks to connect.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _ROBOTDISCOVERY_H_
+#define _ROBOTDISCOVERY_H_
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "HIRCP.h"
+#include "Network.h"
+
+class RobotDiscovery
+{
+public:
+    /* Types */
+    typedef std::chrono::steady_clock Clock;
+
+    struct Robot
+    {
+        unsigned short id;
+        unsigned int address;           // IPv4 address in host byte order
+        unsigned short port;
+        unsigned char capabilities;     // HIRCPPacket::CAPABILITY flags
+        Clock::time_point lastSeen;
+    };
+
+private:
+    /* Fields */
+    unsigned short _port;
+    int _sockfd;
+    std::thread _thread;
+    std::atomic<bool> _running;
+    std::mutex _robots_mutex;
+    std::map<unsigned short, Robot> _robots;    // By robot ID
+
+    /* Methods */
+    void _listen();
+    void _receive();
+    void _close();
+
+    /* Static methods */
+    static bool _parse(unsigned char *datagram, int len, unsigned int source,
+        Robot &robot);
+
+public:
+    /* Constants */
+    static const int EXPIRY_MS = 3500;  // Three beacons missed
+    static const int POLL_MS = 200;     // Longest stop() waits for the thread
+
+    /* Constructor */
+    RobotDiscovery(unsigned short port = HIRCPPacket::BEACON_PORT);
+
+    /* Destructor */
+    ~RobotDiscovery();
+
+    /* Methods */
+    bool start();
+    void stop();
+    std::vector<Robot> getRobots();
+};
+
+#endif /* _ROBOTDISCOVERY_H_ */
@@ -0,0 +1,91 @@
+//*****************************************************************************
+//
+// RobotSet.h
+//
+// Class that mirrors the controller's poses to a set of robots. Each pose is
+// encoded once and the same DATA packet is sent to every robot; a robot still
+// to answer the previous one is skipped rather than waited for, so a slow
+// robot never holds up the others.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _ROBOTSET_H_
+#define _ROBOTSET_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "EventLoop.h"
+#include "FastConnector.h"
+#include "FrameKernels.h"
+#include "HIRCP.h"
+#include "HIRCPFrameReader.h"
+#include "IPv4Address.h"
+#include "TCPSocket.h"
+#include "TimingStats.h"
+
+class RobotSet
+{
+private:
+    /* Types */
+    struct Robot
+    {
+        IPv4Address address;
+        std::unique_ptr<TCPSocket> socket;
+        int sockfd;                     // Watched, kept after a close
+        HIRCPFrameReader frameReader;
+        bool timedDack;
+        bool awaitingDack;              // DATA sent, its DACK not yet back
+        bool failed;                    // Dropped at the end of the update
+        TimingStats::Clock::time_point sentAt;
+        unsigned char pressure[NUM_FINGERS];
+        unsigned int feedbackAge;
+        unsigned int sent;
+        unsigned int skipped;           // Poses not sent, the DACK late
+        TimingStats ackStats;           // DATA to DACK, read a frame on
+    };
+
+    /* Fields */
+    std::mutex _robots_mutex;           // Guards the fields below
+    std::vector<std::unique_ptr<Robot>> _robots;
+    EventLoop _loop;                    // Watches every robot's socket
+    unsigned char _message[HIRCPPacket::MAX_PACKET_SIZE];
+
+    /* Methods */
+    void _receive(Robot &robot, int events);
+    void _drop(unsigned int index);
+
+    /* Static methods */
+    static std::string _name(IPv4Address address);
+
+public:
+    /* Constants */
+    static const int STALL_TIMEOUT_MS = 1000;  // DACK later than this drops
+
+    /* Constructor */
+    RobotSet();
+
+    /* Destructor */
+    ~RobotSet();
+
+    /* Methods */
+    bool add(IPv4Address address, FastConnector::Connection &connection);
+    void clear();
+    unsigned int size();
+    void update(unsigned char *payload);
+    void setMode(HIRCPPacket::FEEDBACK_MODE mode);
+    void getPressures(unsigned char *pressure);
+    void report();
+};
+
+#endif /* _ROBOTSET_H_ */
@@ -0,0 +1,47 @@
+//*****************************************************************************
+//
+// RttEstimator.h
+//
+// Class that smooths round-trip time samples, in microseconds, and their
+// variation, and derives from them how long to wait for a reply.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _RTTESTIMATOR_H_
+#define _RTTESTIMATOR_H_
+
+class RttEstimator
+{
+private:
+    /* Fields */
+    unsigned int _count;
+    double _smoothed;
+    double _variation;
+    double _last;
+
+public:
+    /* Constructor */
+    RttEstimator();
+
+    /* Destructor */
+    ~RttEstimator();
+
+    /* Methods */
+    void add(double micros);
+    void reset();
+    unsigned int getCount();
+    double getSmoothed();
+    double getVariation();
+    double getLast();
+    double getTimeout(double minMicros);
+};
+
+#endif /* _RTTESTIMATOR_H_ */
@@ -11,18 +11,59 @@
 // December 27, 2015
 //
 // Modified:
-// December 30, 2015
+// October 19, 2026
 //
 //*****************************************************************************
 #ifndef _TCPSOCKET_H_
 #define _TCPSOCKET_H_
 
+#include <chrono>
+
 #include "Network.h"
 #include "SocketBase.h"
 
 class TCPSocket : public SocketBase
 {
 public:
+    /* Types */
+    struct Profile
+    {
+        bool noDelay;       // Sends small segments at once (TCP_NODELAY)
+        bool quickAck;      // Acknowledges at once instead of delaying ACKs
+        int typeOfService;  // IP ToS byte (DSCP << 2), or -1 for the default
+        int sendBufferSize; // Bytes, or 0 for the default
+        int recvBufferSize; // Bytes, or 0 for the default
+    };
+
+    static const Profile DEFAULT_PROFILE;
+    static const Profile LOW_LATENCY_PROFILE;
+
+    enum CONNECT_STATUS
+    {
+        CONNECT_FAILED = -1,
+        CONNECT_PENDING = 0,
+        CONNECT_DONE = 1,
+    };
+
+private:
+    /* Types */
+    typedef std::chrono::steady_clock Clock;
+
+    /* Fields */
+    int _timeoutMs;
+    bool _timedOut;
+    Profile _profile;
+
+    /* Methods */
+    bool _wait(int events, Clock::time_point deadline, bool limited);
+    void _applyProfile();
+    void _rearmQuickAck();
+
+public:
+    /* Constants */
+    static const int NO_TIMEOUT = -1;
+    static const int DEFAULT_TIMEOUT_MS = 5000;
+
     /* Constructor */
     TCPSocket();
 
@@ -33,8 +74,20 @@ public:
     bool open();
     void close();
     bool connect(AddressBase<unsigned int> *address);
+    bool connect(AddressBase<unsigned int> *address, int timeoutMs);
+    CONNECT_STATUS startConnect(AddressBase<unsigned int> *address);
+    bool finishConnect();
     bool send(unsigned char *message, unsigned short len);
+    bool send(unsigned char *message, unsigned short len, int timeoutMs);
     bool recv(unsigned char *message, unsigned short len);
+    bool recv(unsigned char *message, unsigned short len, int timeoutMs);
+    int recvSome(unsigned char *message, unsigned short len, int timeoutMs);
+    void setTimeout(int timeoutMs);
+    int getTimeout();
+    bool hasTimedOut();
+    void setProfile(const Profile &profile);
+    Profile getProfile();
+    int getDescriptor();
 };
 
 #endif /* _TCPSOCKET_H_ */
@@ -0,0 +1,52 @@
+//*****************************************************************************
+//
+// TimingStats.h
+//
+// Class that collects the count, minimum, average and maximum of a series of
+// durations, in microseconds.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#ifndef _TIMINGSTATS_H_
+#define _TIMINGSTATS_H_
+
+#include <chrono>
+
+class TimingStats
+{
+private:
+    /* Fields */
+    unsigned int _count;
+    double _min;
+    double _max;
+    double _total;
+
+public:
+    /* Types */
+    typedef std::chrono::steady_clock Clock;
+
+    /* Constructor */
+    TimingStats();
+
+    /* Destructor */
+    ~TimingStats();
+
+    /* Methods */
+    void add(double micros);
+    void add(Clock::time_point begin, Clock::time_point end);
+    void reset();
+    unsigned int getCount();
+    double getMin();
+    double getAverage();
+    double getMax();
+};
+
+#endif /* _TIMINGSTATS_H_ */
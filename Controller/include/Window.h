@@ -28,6 +28,7 @@
 #include "Image.h"
 #include "IObserver.h"
 #include "Panel.h"
+#include "RobotDiscovery.h"
 
 #define WINDOW_WIDTH 1100
 #define WINDOW_HEIGHT 600
@@ -55,6 +56,10 @@ enum WindowEvents
 {
     EVENT_DISCONNECTED,
     EVENT_STOP_STREAMING,
+    EVENT_STOP_ROBOT_PLAYBACK,
+    EVENT_ROBOT_PLAYBACK_FAILED,
+    EVENT_RECONNECTING,
+    EVENT_RECONNECTED,
 };
 
 class Window : public IObserver
@@ -65,6 +70,7 @@ private:
     HWND _windowHandle;
     HMENU _menu;
     std::shared_ptr<Panel> _panel;
+    RobotDiscovery _discovery;
     unsigned short _width;
     unsigned short _height;
     const std::string _addressFilePath = "data/cache/IPAddresses.txt";
@@ -73,8 +79,10 @@ private:
     bool _initialize();
     void _terminate();
     void _processInput();
+    std::vector<std::string> _loadIPAddresses();
     bool _saveIPAddress(std::string ipAddress);
-    bool _getRemoteIPAddress(char *buf, int buflen);
+    bool _loadForceSetpoints(const char *filePath,
+        unsigned short *setpoints);
 
 public:
     /* Fields */
@@ -0,0 +1,91 @@
+//*****************************************************************************
+//
+// Backoff.cpp
+//
+// Delays between retries that double up to a limit, with jitter so that
+// several controllers retrying after the same outage do not stay in step.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "Backoff.h"
+
+//*****************************************************************************
+//
+//! Constructor for Backoff.
+//!
+//! \param initialMs the longest delay before the first retry in
+//!     milliseconds.
+//! \param maxMs the longest delay before any retry in milliseconds.
+//!
+//! \return None.
+//
+//*****************************************************************************
+Backoff::Backoff(int initialMs, int maxMs) : _initialMs(initialMs),
+    _maxMs(maxMs), _attempts(0), _random(std::random_device()())
+{
+
+}
+
+//*****************************************************************************
+//
+//! Gets the delay before the next retry. The limit doubles with every
+//! retry up to the maximum, and the delay is drawn between half the limit
+//! and the limit, so it never collapses to zero.
+//!
+//! \param None.
+//!
+//! \return Returns the delay in milliseconds.
+//
+//*****************************************************************************
+int Backoff::nextDelayMs()
+{
+    int limitMs = _initialMs;
+    for (int i=0; i<_attempts && limitMs < _maxMs; i++)
+    {
+        limitMs *= 2;
+    }
+    if (limitMs > _maxMs)
+    {
+        limitMs = _maxMs;
+    }
+    _attempts++;
+
+    std::uniform_int_distribution<int> jitter(0, limitMs - limitMs/2);
+    return limitMs/2 + jitter(_random);
+}
+
+//*****************************************************************************
+//
+//! Gets the number of delays handed out since the last reset.
+//!
+//! \param None.
+//!
+//! \return Returns the number of retries.
+//
+//*****************************************************************************
+int Backoff::getAttempts()
+{
+    return _attempts;
+}
+
+//*****************************************************************************
+//
+//! Starts over from the initial delay.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Backoff::reset()
+{
+    _attempts = 0;
+}
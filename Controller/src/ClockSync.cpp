@@ -0,0 +1,284 @@
+//*****************************************************************************
+//
+// ClockSync.cpp
+//
+// Class that relates the controller's clock to the robot's from timestamp
+// exchanges, as NTP does. Each exchange gives a sample of the offset
+// between the clocks; a line fitted through the samples with the shortest
+// round trips gives the offset and the drift. Times are in microseconds.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "ClockSync.h"
+
+#include <algorithm>
+#include <vector>
+
+//*****************************************************************************
+//
+//! Constructor for ClockSync. Starts with no samples.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+ClockSync::ClockSync()
+{
+    reset();
+}
+
+//*****************************************************************************
+//
+//! Empty destructor for ClockSync.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+ClockSync::~ClockSync()
+{
+
+}
+
+//*****************************************************************************
+//
+//! Adds a timestamp exchange and refits the clocks. The robot's clock is
+//! taken to have been read halfway through the round trip.
+//!
+//! \param localSent local clock when the request was sent.
+//! \param robotTime robot clock when it answered, wrapping at 32 bits.
+//! \param localReceived local clock when the answer arrived.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void ClockSync::add(double localSent, unsigned int robotTime,
+    double localReceived)
+{
+    const double WRAP = 4294967296.0;
+
+    //
+    // A reading far below the last one has wrapped around
+    //
+    if (!_samples.empty() && robotTime < _robotLast &&
+        _robotLast - robotTime > 0x80000000u)
+    {
+        _robotWraps += WRAP;
+    }
+    _robotLast = robotTime;
+    double robot = _robotWraps + robotTime;
+
+    Sample sample;
+    sample.local = (localSent + localReceived)/2;
+    sample.offset = robot - sample.local;
+    sample.delay = localReceived - localSent;
+    _samples.push_back(sample);
+    if (_samples.size() > MAX_SAMPLES)
+    {
+        _samples.pop_front();
+    }
+
+    _fit();
+
+    _uplink = robot - toRobot(localSent);
+    _downlink = toRobot(localReceived) - robot;
+}
+
+//*****************************************************************************
+//
+//! Discards every sample, as when connecting to another robot.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void ClockSync::reset()
+{
+    _samples.clear();
+    _robotLast = 0;
+    _robotWraps = 0;
+    _offset = 0;
+    _drift = 0;
+    _reference = 0;
+    _error = 0;
+    _uplink = 0;
+    _downlink = 0;
+}
+
+//*****************************************************************************
+//
+//! Checks whether the clocks have been compared.
+//!
+//! \param None.
+//!
+//! \return Returns \b true once a sample was added and \b false otherwise.
+//
+//*****************************************************************************
+bool ClockSync::isSynchronized()
+{
+    return !_samples.empty();
+}
+
+//*****************************************************************************
+//
+//! Converts a local time to the robot's clock.
+//!
+//! \param local the local time.
+//!
+//! \return Returns the robot time, not wrapped at 32 bits.
+//
+//*****************************************************************************
+double ClockSync::toRobot(double local)
+{
+    return local + _offset + _drift*(local - _reference);
+}
+
+//*****************************************************************************
+//
+//! Gets how far the robot's clock is ahead of the local clock at the
+//! latest sample.
+//!
+//! \param None.
+//!
+//! \return Returns the offset in microseconds.
+//
+//*****************************************************************************
+double ClockSync::getOffset()
+{
+    if (_samples.empty())
+    {
+        return 0;
+    }
+    double local = _samples.back().local;
+    return toRobot(local) - local;
+}
+
+//*****************************************************************************
+//
+//! Gets how much faster the robot's clock runs than the local clock.
+//!
+//! \param None.
+//!
+//! \return Returns the drift in parts per million.
+//
+//*****************************************************************************
+double ClockSync::getDriftPpm()
+{
+    return _drift*1e6;
+}
+
+//*****************************************************************************
+//
+//! Gets the most the offset can be wrong by, half the shortest round trip
+//! it was fitted to.
+//!
+//! \param None.
+//!
+//! \return Returns the error bound in microseconds.
+//
+//*****************************************************************************
+double ClockSync::getError()
+{
+    return _error;
+}
+
+//*****************************************************************************
+//
+//! Gets the one-way latency from the controller to the robot of the latest
+//! exchange.
+//!
+//! \param None.
+//!
+//! \return Returns the latency in microseconds.
+//
+//*****************************************************************************
+double ClockSync::getUplink()
+{
+    return _uplink;
+}
+
+//*****************************************************************************
+//
+//! Gets the one-way latency from the robot to the controller of the latest
+//! exchange.
+//!
+//! \param None.
+//!
+//! \return Returns the latency in microseconds.
+//
+//*****************************************************************************
+double ClockSync::getDownlink()
+{
+    return _downlink;
+}
+
+//*****************************************************************************
+//
+//! Fits the offset and drift to the half of the samples with the shortest
+//! round trips, whose offsets queueing disturbed least. Until the samples
+//! span MIN_DRIFT_SPAN_S, only the offset of the best sample is used.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void ClockSync::_fit()
+{
+    std::vector<Sample> best(_samples.begin(), _samples.end());
+    std::sort(best.begin(), best.end(),
+        [](const Sample &a, const Sample &b) { return a.delay < b.delay; });
+    best.resize((best.size() + 1)/2);
+
+    _error = best.front().delay/2;
+
+    double first = best.front().local;
+    double last = best.front().local;
+    double meanLocal = 0;
+    double meanOffset = 0;
+    for (const Sample &sample : best)
+    {
+        first = std::min(first, sample.local);
+        last = std::max(last, sample.local);
+        meanLocal += sample.local;
+        meanOffset += sample.offset;
+    }
+    meanLocal /= best.size();
+    meanOffset /= best.size();
+
+    if (last - first < MIN_DRIFT_SPAN_S*1e6)
+    {
+        _reference = best.front().local;
+        _offset = best.front().offset;
+        _drift = 0;
+        return;
+    }
+
+    //
+    // Least squares line through the offsets
+    //
+    double sumXY = 0;
+    double sumXX = 0;
+    for (const Sample &sample : best)
+    {
+        double x = sample.local - meanLocal;
+        sumXY += x*(sample.offset - meanOffset);
+        sumXX += x*x;
+    }
+
+    _reference = meanLocal;
+    _offset = meanOffset;
+    _drift = std::max(-MAX_DRIFT_PPM*1e-6,
+        std::min(MAX_DRIFT_PPM*1e-6, sumXY/sumXX));
+}
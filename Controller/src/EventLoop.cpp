@@ -0,0 +1,245 @@
+//*****************************************************************************
+//
+// EventLoop.cpp
+//
+// Waits on a set of sockets with poll() (WSAPoll() on Windows) and calls a
+// handler for each socket that becomes ready.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "EventLoop.h"
+
+//*****************************************************************************
+//
+//! Watches a socket for events. A socket can only be watched once.
+//!
+//! \param sockfd the socket to watch.
+//! \param events the EVENT flags to wait for. EVENT_ERROR is always reported.
+//! \param handler called with the socket and the EVENT flags that occurred.
+//!
+//! \return Returns \b true if the socket is now watched and \b false if it
+//! already was.
+//
+//*****************************************************************************
+bool EventLoop::add(int sockfd, int events, Handler handler)
+{
+    for (unsigned int i=0; i<_watches.size(); i++)
+    {
+        if (_watches[i].sockfd == sockfd)
+        {
+            return false;
+        }
+    }
+
+    Watch watch = { sockfd, events, handler };
+    _watches.push_back(watch);
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Changes the events a watched socket waits for.
+//!
+//! \param sockfd the watched socket.
+//! \param events the EVENT flags to wait for.
+//!
+//! \return Returns \b true if the socket is watched and \b false otherwise.
+//
+//*****************************************************************************
+bool EventLoop::modify(int sockfd, int events)
+{
+    for (unsigned int i=0; i<_watches.size(); i++)
+    {
+        if (_watches[i].sockfd == sockfd)
+        {
+            _watches[i].events = events;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//*****************************************************************************
+//
+//! Stops watching a socket. Safe to call from a handler.
+//!
+//! \param sockfd the watched socket.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void EventLoop::remove(int sockfd)
+{
+    for (unsigned int i=0; i<_watches.size(); i++)
+    {
+        if (_watches[i].sockfd == sockfd)
+        {
+            _watches.erase(_watches.begin()+i);
+            return;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Checks whether any socket is watched.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if no socket is watched and \b false otherwise.
+//
+//*****************************************************************************
+bool EventLoop::empty()
+{
+    return _watches.empty();
+}
+
+//*****************************************************************************
+//
+//! Waits for events on the watched sockets and calls the handler of each
+//! socket that is ready.
+//!
+//! \param timeoutMs the longest time to wait in milliseconds, or -1 to wait
+//! without a limit.
+//!
+//! \return Returns the number of handlers called, 0 on timeout and -1 on
+//! error.
+//
+//*****************************************************************************
+int EventLoop::runOnce(int timeoutMs)
+{
+    _pollfds.resize(_watches.size());
+    for (unsigned int i=0; i<_watches.size(); i++)
+    {
+        _pollfds[i].fd = _watches[i].sockfd;
+        _pollfds[i].events = _toPollEvents(_watches[i].events);
+        _pollfds[i].revents = 0;
+    }
+
+    int ready = network::poll(_pollfds.data(),
+        static_cast<unsigned int>(_pollfds.size()), timeoutMs);
+    if (ready <= 0)
+    {
+        return ready;
+    }
+
+    //
+    // Handlers may add or remove watches, so each ready socket is looked up
+    // again before its handler is called
+    //
+    int handled = 0;
+    for (unsigned int i=0; i<_pollfds.size(); i++)
+    {
+        int events = _fromPollEvents(_pollfds[i].revents);
+        if (events == 0)
+        {
+            continue;
+        }
+
+        for (unsigned int j=0; j<_watches.size(); j++)
+        {
+            if (_watches[j].sockfd == (int)_pollfds[i].fd)
+            {
+                Handler handler = _watches[j].handler;
+                handler((int)_pollfds[i].fd, events);
+                handled++;
+                break;
+            }
+        }
+    }
+
+    return handled;
+}
+
+//*****************************************************************************
+//
+//! Waits for events on a single socket.
+//!
+//! \param sockfd the socket.
+//! \param events the EVENT flags to wait for.
+//! \param timeoutMs the longest time to wait in milliseconds, or -1 to wait
+//! without a limit.
+//!
+//! \return Returns the EVENT flags that occurred, 0 on timeout and -1 on
+//! error.
+//
+//*****************************************************************************
+int EventLoop::wait(int sockfd, int events, int timeoutMs)
+{
+    struct pollfd pfd;
+    pfd.fd = sockfd;
+    pfd.events = _toPollEvents(events);
+    pfd.revents = 0;
+
+    int ready = network::poll(&pfd, 1, timeoutMs);
+    if (ready <= 0)
+    {
+        return ready;
+    }
+
+    return _fromPollEvents(pfd.revents);
+}
+
+//*****************************************************************************
+//
+//! Converts EVENT flags to poll() events.
+//!
+//! \param events the EVENT flags.
+//!
+//! \return Returns the poll() events.
+//
+//*****************************************************************************
+short EventLoop::_toPollEvents(int events)
+{
+    short pollEvents = 0;
+
+    if (events & EVENT_READ)
+    {
+        pollEvents |= POLLIN;
+    }
+    if (events & EVENT_WRITE)
+    {
+        pollEvents |= POLLOUT;
+    }
+
+    return pollEvents;
+}
+
+//*****************************************************************************
+//
+//! Converts the events poll() returned to EVENT flags. A hang-up is reported
+//! as readable as well, since recv() is how the closed connection is seen.
+//!
+//! \param revents the poll() events.
+//!
+//! \return Returns the EVENT flags.
+//
+//*****************************************************************************
+int EventLoop::_fromPollEvents(short revents)
+{
+    int events = 0;
+
+    if (revents & (POLLIN | POLLHUP))
+    {
+        events |= EVENT_READ;
+    }
+    if (revents & POLLOUT)
+    {
+        events |= EVENT_WRITE;
+    }
+    if (revents & (POLLERR | POLLHUP | POLLNVAL))
+    {
+        events |= EVENT_ERROR;
+    }
+
+    return events;
+}
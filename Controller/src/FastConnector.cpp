@@ -0,0 +1,337 @@
+//*****************************************************************************
+//
+// FastConnector.cpp
+//
+// Connects to whichever of several robot addresses answers first. Every
+// candidate is connected to at once without blocking, and the first to
+// complete the CRQ/ACK handshake is kept.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "FastConnector.h"
+
+#include <chrono>
+#include <cstring>
+
+//*****************************************************************************
+//
+//! Constructor for FastConnector. Connections get the socket's default
+//! timeout and profile until setSocketOptions() is called.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+FastConnector::FastConnector() :
+    _socketTimeoutMs(TCPSocket::DEFAULT_TIMEOUT_MS),
+    _profile(TCPSocket::DEFAULT_PROFILE)
+{
+
+}
+
+//*****************************************************************************
+//
+//! Sets the timeout and profile of the sockets opened by connect(), which
+//! the connection kept goes on using.
+//!
+//! \param timeoutMs the socket timeout in milliseconds, or
+//!     TCPSocket::NO_TIMEOUT.
+//! \param profile the socket options.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void FastConnector::setSocketOptions(int timeoutMs,
+    const TCPSocket::Profile &profile)
+{
+    _socketTimeoutMs = timeoutMs;
+    _profile = profile;
+}
+
+//*****************************************************************************
+//
+//! Connects to every address at once and keeps the first connection whose
+//! robot accepts the CRQ packet. Where several accept in the same round the
+//! earliest address wins, so addresses should be ranked best first. The
+//! other connections are closed. Only the first MAX_CANDIDATES addresses
+//! are tried.
+//!
+//! \param addresses the addresses and ports of the robots, best first.
+//! \param crq the CRQ packet, HIRCPPacket::MAX_PACKET_SIZE bytes.
+//! \param timeoutMs the longest time to wait in milliseconds.
+//! \param connection receives the connection kept.
+//!
+//! \return Returns \b true if a robot accepted and \b false otherwise.
+//
+//*****************************************************************************
+bool FastConnector::connect(const std::vector<IPv4Address> &addresses,
+    const unsigned char *crq, int timeoutMs, Connection &connection)
+{
+    std::vector<Attempt> attempts;
+    int winner = _run(addresses, crq, timeoutMs, false, attempts);
+    if (winner < 0)
+    {
+        return false;
+    }
+
+    //
+    // The other sockets close as the attempts go out of scope
+    //
+    Attempt &attempt = attempts[winner];
+    connection.socket = std::move(attempt.socket);
+    connection.frameReader = attempt.frameReader;
+    memcpy(connection.ack, attempt.ack, HIRCPPacket::MAX_PACKET_SIZE);
+    connection.candidate = winner;
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Connects to every address at once and keeps every connection whose
+//! robot accepts the CRQ packet within the time given. Only the first
+//! MAX_CANDIDATES addresses are tried.
+//!
+//! \param addresses the addresses and ports of the robots.
+//! \param crq the CRQ packet, HIRCPPacket::MAX_PACKET_SIZE bytes.
+//! \param timeoutMs the longest time to wait in milliseconds.
+//! \param connections receives the connections kept, in address order.
+//!
+//! \return Returns the number of robots that accepted.
+//
+//*****************************************************************************
+int FastConnector::connectAll(const std::vector<IPv4Address> &addresses,
+    const unsigned char *crq, int timeoutMs,
+    std::vector<Connection> &connections)
+{
+    std::vector<Attempt> attempts;
+    _run(addresses, crq, timeoutMs, true, attempts);
+
+    int accepted = 0;
+    for (unsigned int i=0; i<attempts.size(); i++)
+    {
+        Attempt &attempt = attempts[i];
+        if (!attempt.accepted)
+        {
+            continue;
+        }
+
+        Connection connection;
+        connection.socket = std::move(attempt.socket);
+        connection.frameReader = attempt.frameReader;
+        memcpy(connection.ack, attempt.ack, HIRCPPacket::MAX_PACKET_SIZE);
+        connection.candidate = static_cast<int>(i);
+        connections.push_back(std::move(connection));
+        accepted++;
+    }
+    return accepted;
+}
+
+//*****************************************************************************
+//
+//! Runs the handshakes with every address at once.
+//!
+//! \param addresses the addresses and ports of the robots, best first.
+//! \param crq the CRQ packet, HIRCPPacket::MAX_PACKET_SIZE bytes.
+//! \param timeoutMs the longest time to wait in milliseconds.
+//! \param all whether to wait for every handshake rather than the first to
+//!     be accepted.
+//! \param attempts receives one attempt per address tried.
+//!
+//! \return Returns the index of the earliest address accepted, or -1 if
+//! none was.
+//
+//*****************************************************************************
+int FastConnector::_run(const std::vector<IPv4Address> &addresses,
+    const unsigned char *crq, int timeoutMs, bool all,
+    std::vector<Attempt> &attempts)
+{
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::milliseconds(timeoutMs);
+
+    unsigned int count = static_cast<unsigned int>(addresses.size());
+    if (count > MAX_CANDIDATES)
+    {
+        count = MAX_CANDIDATES;
+    }
+
+    //
+    // Sized once, as the handlers hold references into it
+    //
+    attempts = std::vector<Attempt>(count);
+    EventLoop loop;
+
+    //
+    // Starts every connection before waiting on any
+    //
+    for (unsigned int i=0; i<count; i++)
+    {
+        Attempt &attempt = attempts[i];
+        attempt.handshaking = false;
+        attempt.accepted = false;
+
+        attempt.socket = std::unique_ptr<TCPSocket>(new TCPSocket());
+        attempt.socket->setTimeout(_socketTimeoutMs);
+        attempt.socket->setProfile(_profile);
+        if (!attempt.socket->open())
+        {
+            continue;
+        }
+
+        IPv4Address address = addresses[i];
+        TCPSocket::CONNECT_STATUS status =
+            attempt.socket->startConnect(&address);
+        if (status == TCPSocket::CONNECT_FAILED ||
+            (status == TCPSocket::CONNECT_DONE && !_sendCRQ(attempt, crq)))
+        {
+            continue;
+        }
+
+        loop.add(attempt.socket->getDescriptor(), attempt.handshaking ?
+            EventLoop::EVENT_READ : EventLoop::EVENT_WRITE,
+            [this, &attempt, &loop, crq](int sockfd, int)
+            {
+                _handle(attempt, loop, sockfd, crq);
+            });
+    }
+
+    //
+    // Runs the handshakes until one is accepted, or all of them are, all
+    // have failed or time is up
+    //
+    int winner = -1;
+    while ((all || winner < 0) && !loop.empty())
+    {
+        int remainingMs = static_cast<int>(std::chrono::duration_cast<
+            std::chrono::milliseconds>(deadline - Clock::now()).count());
+        if (remainingMs <= 0 ||
+            (loop.runOnce(remainingMs) < 0 &&
+            !network::isWouldBlock(network::getLastError())))
+        {
+            break;
+        }
+
+        for (unsigned int i=0; i<count; i++)
+        {
+            if (attempts[i].accepted)
+            {
+                winner = static_cast<int>(i);
+                break;
+            }
+        }
+    }
+
+    return winner;
+}
+
+//*****************************************************************************
+//
+//! Advances the handshake of an attempt whose socket is ready: sends the
+//! CRQ packet once connected, then reads until a whole reply arrives.
+//!
+//! \param attempt the attempt.
+//! \param loop the event loop watching its socket.
+//! \param sockfd its socket.
+//! \param crq the CRQ packet.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void FastConnector::_handle(Attempt &attempt, EventLoop &loop, int sockfd,
+    const unsigned char *crq)
+{
+    if (!attempt.handshaking)
+    {
+        if (!attempt.socket->finishConnect() || !_sendCRQ(attempt, crq))
+        {
+            _fail(attempt, loop, sockfd);
+            return;
+        }
+        loop.modify(sockfd, EventLoop::EVENT_READ);
+        return;
+    }
+
+    //
+    // The socket is readable, so recvSome() does not wait
+    //
+    unsigned char *space;
+    unsigned int len = attempt.frameReader.getSpace(space);
+    int received = attempt.socket->recvSome(space,
+        static_cast<unsigned short>(len), 0);
+    if (received <= 0)
+    {
+        _fail(attempt, loop, sockfd);
+        return;
+    }
+    attempt.frameReader.commit(received);
+
+    if (!attempt.frameReader.next(attempt.ack))
+    {
+        return;
+    }
+
+    HIRCPPacket ackPacket = HIRCPPacket::createEmptyPacket();
+    ackPacket.populate(attempt.ack, HIRCPPacket::MAX_PACKET_SIZE);
+    if (!ackPacket.isValid() || (ackPacket.getType() != HIRCPPacket::ACK))
+    {
+        _fail(attempt, loop, sockfd);
+        return;
+    }
+
+    loop.remove(sockfd);
+    attempt.accepted = true;
+}
+
+//*****************************************************************************
+//
+//! Sends the CRQ packet on a connected attempt.
+//!
+//! \param attempt the attempt.
+//! \param crq the CRQ packet.
+//!
+//! \return Returns \b true if the packet was sent and \b false otherwise.
+//
+//*****************************************************************************
+bool FastConnector::_sendCRQ(Attempt &attempt, const unsigned char *crq)
+{
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    memcpy(message, crq, HIRCPPacket::MAX_PACKET_SIZE);
+
+    //
+    // A new connection has room for one packet in its send buffer
+    //
+    if (!attempt.socket->send(message, HIRCPPacket::MAX_PACKET_SIZE, 0))
+    {
+        return false;
+    }
+
+    attempt.handshaking = true;
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Gives up on an attempt and closes its socket. The socket may already be
+//! closed by the operation that failed, so its descriptor is passed in.
+//!
+//! \param attempt the attempt.
+//! \param loop the event loop watching its socket.
+//! \param sockfd its socket.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void FastConnector::_fail(Attempt &attempt, EventLoop &loop, int sockfd)
+{
+    loop.remove(sockfd);
+    attempt.socket->close();
+}
@@ -0,0 +1,217 @@
+//*****************************************************************************
+//
+// FrameKernels.cpp
+//
+// Computations run on every frame, kept free of the Leap Motion, SDL and
+// Windows headers so they can be built and benchmarked on any platform
+// (see bench/).
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "FrameKernels.h"
+
+#include <cassert>
+#include <cmath>
+
+#include "HIRCP.h"
+
+//*****************************************************************************
+//
+//! Serializes finger and wrist angles into buffer, one byte each. Nothing
+//! is written to a buffer that is too small.
+//!
+//! \param totalAngle NUM_FINGERS finger angles in degrees.
+//! \param wristAngle wrist angle in degrees.
+//! \param buf the buffer to store serialized data.
+//! \param buflen the size of the buffer
+//!
+//! \return None.
+//
+//*****************************************************************************
+void FrameKernels::serializeAngles(const unsigned char *totalAngle,
+    unsigned char wristAngle, unsigned char *buf, unsigned int buflen)
+{
+    //
+    // Buffer needs to be at least this size
+    //
+    assert(buflen >= (unsigned int)HIRC_FRAME_LEN);
+    if (buflen < (unsigned int)HIRC_FRAME_LEN)
+    {
+        return;
+    }
+
+    //
+    // Serialize data
+    //
+    unsigned int bufIndex = 0;
+    for (int i=0; i<NUM_FINGERS; i++)
+    {
+        //
+        // Stores angle sequentially in buf
+        //
+        buf[bufIndex++] = totalAngle[i];
+    }
+    buf[bufIndex++] = wristAngle;
+}
+
+//*****************************************************************************
+//
+//! Expands an 8-bit grayscale image to RGBA, with RGB set to the same value
+//! to display grayscale and alpha set to opaque.
+//!
+//! \param gray pixels of the grayscale image.
+//! \param rgba buffer receiving 4 bytes per pixel.
+//! \param pixels number of pixels.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void FrameKernels::grayscaleToRGBA(const unsigned char *gray,
+    unsigned char *rgba, int pixels)
+{
+    for (int i=0; i<pixels; i++)
+    {
+        unsigned char value = gray[i];
+        rgba[4*i] = value;
+        rgba[4*i+1] = value;
+        rgba[4*i+2] = value;
+        rgba[4*i+3] = 0xFF;
+    }
+}
+
+//*****************************************************************************
+//
+//! Decodes the pressure readings of a DACK payload into pressure levels
+//! from 0 (none) to 255.
+//!
+//! \param payload DACK payload of HIRCPPacket::MAX_PAYLOAD_LEN bytes.
+//! \param timedDack \b true if the connection uses timed DACK packets.
+//! \param pressure receives NUM_FINGERS pressure levels.
+//!
+//! \return The age of the readings in microseconds for a timed DACK, and 0
+//! otherwise.
+//
+//*****************************************************************************
+unsigned int FrameKernels::decodeFingerPressures(const unsigned char *payload,
+    bool timedDack, unsigned char *pressure)
+{
+    const int BITS_PER_BYTE = 8;
+    //const int MIN_ENCODED_PRESSURE = 800;
+    const int MAX_ENCODED_PRESSURE[NUM_FINGERS] =
+        { 1020, 800, 930, 1030, 990 };
+    const float SENSOR_SCALING = 3.05;
+    unsigned int age = 0;
+
+    //
+    // A timed DACK packs 12-bit values two per three bytes, followed by the
+    // age of the readings
+    //
+    if (timedDack)
+    {
+        age = ((payload[8] << BITS_PER_BYTE) | payload[9]) *
+            HIRCPPacket::SENSOR_AGE_UNIT_US;
+    }
+
+    //
+    // Parses through payload and populates pressure levels
+    //
+    unsigned int bufIndex = 0;
+    for (int i=0; i<NUM_FINGERS; i++)
+    {
+        unsigned short encodedPressure = 0;
+        if (timedDack)
+        {
+            const unsigned char *pair = &payload[(i/2)*3];
+            encodedPressure = (i%2 == 0) ?
+                ((pair[0] << 4) | (pair[1] >> 4)) :
+                (((pair[1] & 0x0F) << BITS_PER_BYTE) | pair[2]);
+        }
+        else
+        {
+            encodedPressure += payload[bufIndex++];
+            encodedPressure <<= BITS_PER_BYTE;
+            encodedPressure += payload[bufIndex++];
+        }
+        assert((encodedPressure >= 0) && (encodedPressure <= 4096));
+
+        // Setting encodedPressure if limit exceeded
+        if (encodedPressure > MAX_ENCODED_PRESSURE[i])
+        {
+            encodedPressure = MAX_ENCODED_PRESSURE[i];
+        }
+        double multiplier = (double)(log10((double)(MAX_ENCODED_PRESSURE[i]
+            - encodedPressure + 1))) / SENSOR_SCALING;
+
+        pressure[i] = static_cast<unsigned char>(multiplier*255);
+    }
+
+    return age;
+}
+
+//*****************************************************************************
+//
+//! Appends one frame to a HIRC file (see hirc_file_format.txt).
+//!
+//! \param file the file, opened in binary mode.
+//! \param totalAngle NUM_FINGERS finger angles in degrees.
+//! \param wristAngle wrist angle in degrees.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void FrameKernels::writeHIRCFrame(std::ostream &file,
+    const unsigned char *totalAngle, unsigned char wristAngle)
+{
+    char frame[HIRC_FRAME_LEN];
+
+    for (int i=0; i<NUM_FINGERS; i++)
+    {
+        frame[i] = totalAngle[i];
+    }
+    frame[NUM_FINGERS] = wristAngle;
+
+    //
+    // One unformatted write instead of an insertion per byte
+    //
+    file.write(frame, HIRC_FRAME_LEN);
+}
+
+//*****************************************************************************
+//
+//! Reads the next frame of a HIRC file (see hirc_file_format.txt).
+//!
+//! \param file the file, opened in binary mode.
+//! \param totalAngle receives NUM_FINGERS finger angles in degrees.
+//! \param wristAngle receives the wrist angle in degrees.
+//!
+//! \return Returns \b true if a whole frame was read and \b false at the
+//! end of the file.
+//
+//*****************************************************************************
+bool FrameKernels::readHIRCFrame(std::istream &file, unsigned char *totalAngle,
+    unsigned char &wristAngle)
+{
+    char frame[HIRC_FRAME_LEN];
+
+    file.read(frame, HIRC_FRAME_LEN);
+    if (file.rdstate() & std::istream::eofbit)
+    {
+        return false;
+    }
+
+    for (int i=0; i<NUM_FINGERS; i++)
+    {
+        totalAngle[i] = frame[i];
+    }
+    wristAngle = frame[NUM_FINGERS];
+
+    return true;
+}
@@ -199,18 +199,21 @@ void HIRCPPacket::populate(unsigned char *buf, int len)
 //! Static method for creating a CRQ packet.
 //!
 //! \param mode FEEDBACK_MODE to set.
+//! \param options OPTION flags to request, or 0 for none.
 //!
 //! \return an HIRCP CRQ packet.
 //
 //*****************************************************************************
-HIRCPPacket HIRCPPacket::createCRQPacket(FEEDBACK_MODE mode)
+HIRCPPacket HIRCPPacket::createCRQPacket(FEEDBACK_MODE mode,
+    unsigned char options)
 {
     HIRCPPacket packet;
 
     packet.setType(TYPE::CRQ);
     unsigned char payload[MAX_PAYLOAD_LEN];
     payload[0]= (unsigned char)mode;
-    for (int i=1; i<MAX_PAYLOAD_LEN; i++)
+    payload[1]= options;
+    for (int i=2; i<MAX_PAYLOAD_LEN; i++)
     {
         payload[i] = 0;
     }
@@ -264,6 +267,192 @@ HIRCPPacket HIRCPPacket::createDATAPacket(unsigned char *payload, int len)
     return packet;
 }
 
+//*****************************************************************************
+//
+//! Static method for creating an FSET packet. Sets the pressure each finger
+//! holds in closed-loop mode, as a raw sensor reading; a setpoint of 0 leaves
+//! that finger unchanged.
+//!
+//! \param setpoints buffer holding one setpoint per finger, thumb first.
+//! \param count number of setpoints in the buffer, at most 5.
+//!
+//! \return an HIRCP FSET packet.
+//
+//*****************************************************************************
+HIRCPPacket HIRCPPacket::createFSETPacket(const unsigned short *setpoints,
+    int count)
+{
+    assert(count*2 <= FSET_PAYLOAD_LEN);
+
+    HIRCPPacket packet;
+
+    packet.setType(TYPE::FSET);
+    unsigned char payload[MAX_PAYLOAD_LEN];
+    for (int i=0; i<MAX_PAYLOAD_LEN; i++)
+    {
+        payload[i] = 0;
+    }
+    for (int i=0; i<count; i++)
+    {
+        payload[i*2] = (unsigned char)(setpoints[i] >> 8);
+        payload[i*2+1] = (unsigned char)(setpoints[i] & 0xFF);
+    }
+    packet.setPayload(payload, MAX_PAYLOAD_LEN);
+
+    return packet;
+}
+
+//*****************************************************************************
+//
+//! Static method for creating a STATS packet. The microcontroller replies
+//! with a STATS packet holding the statistics asked for.
+//!
+//! \param kind STATS_KIND to ask for.
+//! \param section firmware section, for PROFILE_STATS.
+//!
+//! \return an HIRCP STATS packet.
+//
+//*****************************************************************************
+HIRCPPacket HIRCPPacket::createSTATSPacket(STATS_KIND kind,
+    unsigned char section)
+{
+    HIRCPPacket packet;
+
+    packet.setType(TYPE::STATS);
+    unsigned char payload[MAX_PAYLOAD_LEN];
+    payload[0] = (unsigned char)kind;
+    payload[1] = section;
+    for (int i=2; i<MAX_PAYLOAD_LEN; i++)
+    {
+        payload[i] = 0;
+    }
+    packet.setPayload(payload, MAX_PAYLOAD_LEN);
+
+    return packet;
+}
+
+//*****************************************************************************
+//
+//! Static method for creating a TRAJ packet that starts uploading a
+//! trajectory. The microcontroller replies with a TRAJ packet.
+//!
+//! \param fps rate the frames were recorded at.
+//! \param frames number of frames that will follow.
+//!
+//! \return an HIRCP TRAJ packet.
+//
+//*****************************************************************************
+HIRCPPacket HIRCPPacket::createTRAJBeginPacket(unsigned char fps, int frames)
+{
+    assert(frames >= 0 && frames <= 0xFFFF);
+
+    HIRCPPacket packet = createTRAJPacket(TRAJ_BEGIN);
+    packet._payload[1] = fps;
+    packet._payload[2] = (unsigned char)(frames >> 8);
+    packet._payload[3] = (unsigned char)(frames & 0xFF);
+
+    return packet;
+}
+
+//*****************************************************************************
+//
+//! Static method for creating a TRAJ packet that carries one frame of an
+//! upload. Frames must be sent in order; they are not answered. The last
+//! byte makes the sum of the payload bytes zero.
+//!
+//! \param index position of the frame in the trajectory.
+//! \param frame buffer holding TRAJ_FRAME_LEN angles, thumb first.
+//!
+//! \return an HIRCP TRAJ packet.
+//
+//*****************************************************************************
+HIRCPPacket HIRCPPacket::createTRAJChunkPacket(int index,
+    const unsigned char *frame)
+{
+    assert(index >= 0 && index <= 0xFFFF);
+
+    HIRCPPacket packet = createTRAJPacket(TRAJ_CHUNK);
+    packet._payload[1] = (unsigned char)(index >> 8);
+    packet._payload[2] = (unsigned char)(index & 0xFF);
+    std::copy(frame, frame+TRAJ_FRAME_LEN, packet._payload+3);
+
+    unsigned char sum = 0;
+    for (int i=0; i<TRAJ_PAYLOAD_LEN-1; i++)
+    {
+        sum += packet._payload[i];
+    }
+    packet._payload[TRAJ_PAYLOAD_LEN-1] = (unsigned char)(0x100 - sum);
+
+    return packet;
+}
+
+//*****************************************************************************
+//
+//! Static method for creating a TRAJ packet that finishes an upload. The
+//! microcontroller replies with a TRAJ packet telling whether the
+//! trajectory was received intact.
+//!
+//! \param checksum trajectoryChecksum() of every frame sent.
+//!
+//! \return an HIRCP TRAJ packet.
+//
+//*****************************************************************************
+HIRCPPacket HIRCPPacket::createTRAJEndPacket(unsigned short checksum)
+{
+    HIRCPPacket packet = createTRAJPacket(TRAJ_END);
+    packet._payload[1] = (unsigned char)(checksum >> 8);
+    packet._payload[2] = (unsigned char)(checksum & 0xFF);
+
+    return packet;
+}
+
+//*****************************************************************************
+//
+//! Static method for creating a TRAJ packet that starts, or resumes, playing
+//! the uploaded trajectory. The microcontroller replies with a TRAJ packet.
+//!
+//! \param loop whether playback starts over at the end.
+//!
+//! \return an HIRCP TRAJ packet.
+//
+//*****************************************************************************
+HIRCPPacket HIRCPPacket::createTRAJPlayPacket(bool loop)
+{
+    const unsigned char LOOP = 0x01;
+
+    HIRCPPacket packet = createTRAJPacket(TRAJ_PLAY);
+    packet._payload[1] = loop ? LOOP : 0;
+
+    return packet;
+}
+
+//*****************************************************************************
+//
+//! Static method for creating a TRAJ packet with no arguments, such as
+//! TRAJ_PAUSE, TRAJ_STOP or TRAJ_STATUS. The microcontroller replies with a
+//! TRAJ packet.
+//!
+//! \param command TRAJ_COMMAND to send.
+//!
+//! \return an HIRCP TRAJ packet.
+//
+//*****************************************************************************
+HIRCPPacket HIRCPPacket::createTRAJPacket(TRAJ_COMMAND command)
+{
+    HIRCPPacket packet;
+
+    packet.setType(TYPE::TRAJ);
+    unsigned char payload[MAX_PAYLOAD_LEN];
+    payload[0] = (unsigned char)command;
+    for (int i=1; i<MAX_PAYLOAD_LEN; i++)
+    {
+        payload[i] = 0;
+    }
+    packet.setPayload(payload, MAX_PAYLOAD_LEN);
+
+    return packet;
+}
+
 //*****************************************************************************
 //
 //! Static method for creating a TRQ packet.
@@ -282,6 +471,35 @@ HIRCPPacket HIRCPPacket::createTRQPacket()
     return packet;
 }
 
+//*****************************************************************************
+//
+//! Static method for creating a PING packet. The microcontroller replies
+//! with a PONG packet carrying the same payload.
+//!
+//! \param sequence number of the PING on this connection.
+//! \param timestampUs controller clock when sent, in microseconds.
+//!
+//! \return an HIRCP PING packet.
+//
+//*****************************************************************************
+HIRCPPacket HIRCPPacket::createPINGPacket(unsigned short sequence,
+    unsigned int timestampUs)
+{
+    HIRCPPacket packet;
+
+    packet.setType(TYPE::PING);
+    unsigned char payload[MAX_PAYLOAD_LEN] = {};
+    payload[0] = (unsigned char)(sequence >> 8);
+    payload[1] = (unsigned char)sequence;
+    payload[2] = (unsigned char)(timestampUs >> 24);
+    payload[3] = (unsigned char)(timestampUs >> 16);
+    payload[4] = (unsigned char)(timestampUs >> 8);
+    payload[5] = (unsigned char)timestampUs;
+    packet.setPayload(payload, MAX_PAYLOAD_LEN);
+
+    return packet;
+}
+
 //*****************************************************************************
 //
 //! Static method for creating an empty packet.
@@ -299,3 +517,29 @@ HIRCPPacket HIRCPPacket::createEmptyPacket()
 
     return packet;
 }
+
+//*****************************************************************************
+//
+//! Computes the Fletcher-16 checksum of a trajectory, as carried by the
+//! TRAJ_END packet.
+//!
+//! \param frames buffer holding every frame in order.
+//! \param len size of the buffer.
+//!
+//! \return the checksum, second sum in the high byte.
+//
+//*****************************************************************************
+unsigned short HIRCPPacket::trajectoryChecksum(const unsigned char *frames,
+    int len)
+{
+    unsigned short sum1 = 0;
+    unsigned short sum2 = 0;
+
+    for (int i=0; i<len; i++)
+    {
+        sum1 = (sum1 + frames[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+
+    return (sum2 << 8) | sum1;
+}
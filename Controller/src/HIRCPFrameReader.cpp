@@ -0,0 +1,209 @@
+//*****************************************************************************
+//
+// HIRCPFrameReader.cpp
+//
+// Collects bytes received from the robot in a ring buffer and hands them out
+// as whole HIRCP packets, however TCP split or merged them.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "HIRCPFrameReader.h"
+
+#include "HIRCP.h"
+
+static_assert((HIRCPFrameReader::BUFFER_SIZE &
+    (HIRCPFrameReader::BUFFER_SIZE-1)) == 0,
+    "BUFFER_SIZE must be a power of two");
+
+//*****************************************************************************
+//
+//! Constructor for HIRCPFrameReader. Starts empty.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+HIRCPFrameReader::HIRCPFrameReader()
+{
+    reset();
+}
+
+//*****************************************************************************
+//
+//! Empties the reader and clears its count of discarded bytes. Called for
+//! every new connection.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void HIRCPFrameReader::reset()
+{
+    _head = 0;
+    _tail = 0;
+    _discarded = 0;
+}
+
+//*****************************************************************************
+//
+//! Finds where received bytes go. The space ends at the end of the buffer
+//! or at the oldest byte, so a read may need to be split in two when the
+//! buffer wraps.
+//!
+//! \param space set to the start of the free space.
+//!
+//! \return Returns the number of bytes that fit, 0 when the buffer is full.
+//
+//*****************************************************************************
+unsigned int HIRCPFrameReader::getSpace(unsigned char *&space)
+{
+    unsigned int free = BUFFER_SIZE - (_tail - _head);
+    unsigned int index = _tail & (BUFFER_SIZE-1);
+    unsigned int toEnd = BUFFER_SIZE - index;
+
+    space = &_buf[index];
+    return (free < toEnd) ? free : toEnd;
+}
+
+//*****************************************************************************
+//
+//! Adds bytes placed in the space getSpace() returned.
+//!
+//! \param len the number of bytes placed, at most the space returned.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void HIRCPFrameReader::commit(unsigned int len)
+{
+    _tail += len;
+}
+
+//*****************************************************************************
+//
+//! Takes the next whole packet out of the reader. Bytes that cannot start a
+//! packet, because they are not the HIRC constant followed by a known
+//! opcode, are discarded one at a time until the stream lines up again.
+//!
+//! \param packet buffer receiving HIRCPPacket::MAX_PACKET_SIZE bytes.
+//!
+//! \return Returns \b true if a packet was copied and \b false if more bytes
+//! are needed.
+//
+//*****************************************************************************
+bool HIRCPFrameReader::next(unsigned char *packet)
+{
+    unsigned int buffered;
+
+    while ((buffered = _tail - _head) > 0)
+    {
+        if (!_startsPacket(buffered))
+        {
+            _head++;
+            _discarded++;
+            continue;
+        }
+
+        //
+        // The start is good so far; waits for the rest of the packet
+        //
+        if (buffered < (unsigned int)HIRCPPacket::MAX_PACKET_SIZE)
+        {
+            return false;
+        }
+
+        for (int i=0; i<HIRCPPacket::MAX_PACKET_SIZE; i++)
+        {
+            packet[i] = _peek(i);
+        }
+        _head += HIRCPPacket::MAX_PACKET_SIZE;
+        return true;
+    }
+
+    return false;
+}
+
+//*****************************************************************************
+//
+//! Returns the number of bytes received but not yet handed out.
+//!
+//! \param None.
+//!
+//! \return Returns the number of bytes buffered.
+//
+//*****************************************************************************
+unsigned int HIRCPFrameReader::getBuffered()
+{
+    return _tail - _head;
+}
+
+//*****************************************************************************
+//
+//! Returns the number of bytes discarded while out of step since reset().
+//!
+//! \param None.
+//!
+//! \return Returns the number of bytes discarded.
+//
+//*****************************************************************************
+unsigned long HIRCPFrameReader::getDiscarded()
+{
+    return _discarded;
+}
+
+//*****************************************************************************
+//
+//! Reads a buffered byte without taking it out.
+//!
+//! \param offset the position counted from the oldest byte.
+//!
+//! \return Returns the byte.
+//
+//*****************************************************************************
+unsigned char HIRCPFrameReader::_peek(unsigned int offset)
+{
+    return _buf[(_head + offset) & (BUFFER_SIZE-1)];
+}
+
+//*****************************************************************************
+//
+//! Checks whether the oldest bytes can be the start of a packet. Only the
+//! bytes received so far are checked.
+//!
+//! \param buffered the number of bytes buffered.
+//!
+//! \return Returns \b true unless a byte rules out a packet starting here.
+//
+//*****************************************************************************
+bool HIRCPFrameReader::_startsPacket(unsigned int buffered)
+{
+    for (unsigned int i=0; i<(unsigned int)HIRCPPacket::HIRCP_CONSTANT_LEN &&
+        i<buffered; i++)
+    {
+        if (_peek(i) != HIRCPPacket::HIRCP_CONSTANT[i])
+        {
+            return false;
+        }
+    }
+
+    if (buffered > (unsigned int)HIRCPPacket::HIRCP_CONSTANT_LEN)
+    {
+        unsigned char opcode = _peek(HIRCPPacket::HIRCP_CONSTANT_LEN);
+        if (opcode < HIRCPPacket::CRQ || opcode >= HIRCPPacket::NUM_TYPES)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
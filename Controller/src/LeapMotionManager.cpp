@@ -18,6 +18,7 @@
 
 #include <cassert>
 
+#include "FrameKernels.h"
 #include "Window.h"
 
 //*****************************************************************************
@@ -101,13 +102,8 @@ bool LeapMotionManager::processFrame(LeapData &leapData)
         // Set image RGB to same value to display grayscale and set alpha to
         // opaque
         //
-        for (int i=0; i<imageSize; i++)
-        {
-            leapData.imageDataRGBA[4*i] = imageData[i];
-            leapData.imageDataRGBA[4*i+1] = imageData[i];
-            leapData.imageDataRGBA[4*i+2] = imageData[i];
-            leapData.imageDataRGBA[4*i+3] = 0xFF;
-        }
+        FrameKernels::grayscaleToRGBA(imageData, leapData.imageDataRGBA,
+            imageSize);
     }
     else
     {
@@ -300,31 +296,8 @@ bool LeapMotionManager::processFrame(LeapData &leapData)
 void LeapMotionManager::serialize(LeapData &leapAngles, unsigned char *buf,
     unsigned int buflen)
 {
-    //
-    // Buffer needs to be at least this size
-    //
-    const int BITS_PER_BYTE = 8;
-    int angleSize = sizeof(leapAngles.totalAngle[0]);
-    int wristSize = sizeof(leapAngles.wristAngle);
-    assert(buflen >= (unsigned int)(angleSize*NUM_FINGERS + wristSize));
-
-    //
-    // Serialize data
-    //
-    unsigned int bufIndex = 0;
-    for (int i=0; i<NUM_FINGERS; i++)
-    {
-        auto angle = leapAngles.totalAngle[i];
-
-        //
-        // Stores angle sequentially in buf
-        //
-        buf[bufIndex++] = angle;
-        //std::cout << static_cast<unsigned int>(buf[bufIndex - 1]) << " ";
-    }
-    buf[bufIndex++] = leapAngles.wristAngle;
-    //std::cout << static_cast<unsigned int>(buf[bufIndex - 1]) << std::endl;
-    //std::cout << std::endl;
+    FrameKernels::serializeAngles(leapAngles.totalAngle,
+        leapAngles.wristAngle, buf, buflen);
 }
 
 //*****************************************************************************
@@ -340,28 +313,7 @@ void LeapMotionManager::serialize(LeapData &leapAngles, unsigned char *buf,
 float LeapMotionManager::_calculateTotalAngle(Leap::Vector *vectors,
     unsigned int size, float scale)
 {
-    float angle = 0;
-
-    for (unsigned int i=0; i<size-1; i++)
-    {
-        float temp = vectors[i].angleTo(vectors[i+1])*scale;
-        angle += temp;
-        //
-        // Adds rotation to account for the case where the finger is pointed
-        // directly down
-        //
-        if (i==0 && (angle>40))
-        {
-            angle += 50;
-        }
-    }
-
-    if (angle > 255)
-    {
-        angle = 255;
-    }
-
-    return angle;
+    return FrameKernels::totalAngle(vectors, size, scale);
 }
 
 //*****************************************************************************
@@ -11,11 +11,16 @@
 // December 27, 2015
 //
 // Modified:
-// December 30, 2015
+// October 19, 2026
 //
 //*****************************************************************************
 #include "Network.h"
 
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#endif
+
 //*****************************************************************************
 //
 //! Initializes socket API.
@@ -57,3 +62,91 @@ void network::terminate()
     WSACleanup();
 #endif
 }
+
+//*****************************************************************************
+//
+//! Waits until one of the sockets is ready for the events requested in fds.
+//!
+//! \param fds the sockets and the events (POLLIN, POLLOUT) to wait for.
+//! \param nfds the number of entries in fds.
+//! \param timeoutMs the longest time to wait in milliseconds, or -1 to wait
+//! without a limit.
+//!
+//! \return Returns the number of sockets ready, 0 on timeout and -1 on
+//! error.
+//
+//*****************************************************************************
+int network::poll(struct pollfd *fds, unsigned int nfds, int timeoutMs)
+{
+#ifdef _WIN32
+    return WSAPoll(fds, nfds, timeoutMs);
+#else
+    return ::poll(fds, nfds, timeoutMs);
+#endif
+}
+
+//*****************************************************************************
+//
+//! Switches a socket between blocking and non-blocking mode.
+//!
+//! \param sockfd the socket.
+//! \param nonBlocking \b true for non-blocking mode.
+//!
+//! \return Returns \b true if the mode was set and \b false otherwise.
+//
+//*****************************************************************************
+bool network::setNonBlocking(int sockfd, bool nonBlocking)
+{
+#ifdef _WIN32
+    u_long mode = nonBlocking ? 1 : 0;
+    return (ioctlsocket(sockfd, FIONBIO, &mode) == 0);
+#else
+    int flags = fcntl(sockfd, F_GETFL, 0);
+    if (flags == -1)
+    {
+        return false;
+    }
+    flags = nonBlocking ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+    return (fcntl(sockfd, F_SETFL, flags) == 0);
+#endif
+}
+
+//*****************************************************************************
+//
+//! Returns the error code of the last failed socket call on this thread.
+//!
+//! \param None.
+//!
+//! \return Returns the error code.
+//
+//*****************************************************************************
+int network::getLastError()
+{
+#ifdef _WIN32
+    return WSAGetLastError();
+#else
+    return errno;
+#endif
+}
+
+//*****************************************************************************
+//
+//! Checks whether an error code only means that a non-blocking socket call
+//! has to wait, including a connection still in progress.
+//!
+//! \param error the error code returned by getLastError().
+//!
+//! \return Returns \b true if the call should be retried once the socket is
+//! ready and \b false if it failed.
+//
+//*****************************************************************************
+bool network::isWouldBlock(int error)
+{
+#ifdef _WIN32
+    return (error == WSAEWOULDBLOCK) || (error == WSAEINPROGRESS) ||
+        (error == WSAEINTR);
+#else
+    return (error == EWOULDBLOCK) || (error == EAGAIN) ||
+        (error == EINPROGRESS) || (error == EINTR);
+#endif
+}
@@ -16,10 +16,18 @@
 //*****************************************************************************
 #include "Panel.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
-#include <cmath>
+#include <vector>
 
+#include "Backoff.h"
+#include "EventLoop.h"
+#include "FastConnector.h"
+#include "FrameKernels.h"
 #include "IPv4Address.h"
 #include "LeapMotionManager.h"
 #include "Window.h"
@@ -36,8 +44,25 @@
 Panel::Panel(Window *window, SDL_Window *sdlWindow)
     : _window(sdlWindow), _renderer(nullptr), _hand(nullptr),
     _connected(false), _mode(HIRCPPacket::FEEDBACK_MODE::NORMAL_MODE),
-    _cachedFPS(0)
+    _modePending(false),
+    _timedDack(false), _feedbackAge(0), _forceSetpointsSet(false),
+    _forceSetpointsPending(false), _cachedFPS(0),
+    _lastProfileReport(TimingStats::Clock::now()),
+    _robotRequest(ROBOT_NONE), _robotLoop(false),
+    _robotState(HIRCPPacket::TRAJ_EMPTY),
+    _lastRobotStatus(TimingStats::Clock::now()), _reconnecting(false),
+    _reconnectCancelled(false), _latestPoseValid(false), _pingsSent(0),
+    _pongsReceived(0), _lastPing(TimingStats::Clock::now()),
+    _heldValid(false), _lastReceived(TimingStats::Clock::now()),
+    _statsNext(0), _statsEnd(0), _statsAwaiting(false), _stampedData(false),
+    _poseReady(false), _poseModeChanged(false), _networkStopped(false),
+    _posesSkipped(0), _reportPending(false)
 {
+    for (int i=0; i<NUM_FINGERS; i++)
+    {
+        _pressure[i] = 0;
+    }
+
     //
     // Initialize panel
     //
@@ -65,6 +90,8 @@ Panel::Panel(Window *window, SDL_Window *sdlWindow)
 //*****************************************************************************
 Panel::~Panel()
 {
+    _stopReconnect();
+
     if (_renderer != nullptr)
     {
         SDL_DestroyRenderer(_renderer);
@@ -83,10 +110,18 @@ Panel::~Panel()
 //*****************************************************************************
 void Panel::run()
 {
+    const int PROFILE_REPORT_PERIOD_S = 5;
+
     LeapMotionManager leap;
     LeapData leapData;
     FingerPressureStruct fingerPressures;
 
+    //
+    // The robot connected to is served from a thread of its own, so waiting
+    // on it never holds up a frame or the robots mirrored to
+    //
+    _networkThread = std::thread(&Panel::_network, this);
+
     //
     // Main panel logic
     //
@@ -97,6 +132,7 @@ void Panel::run()
         // Begins tracking fps
         //
         _fpsManager.beginFrame();
+        TimingStats::Clock::time_point frameBegin = TimingStats::Clock::now();
 
         //
         // Clears finger pressures
@@ -126,666 +162,2390 @@ void Panel::run()
         //
         leap.serialize(leapData, leapData.data, leapData._MAX_PAYLOAD);
 
-        if (_connected)
-        {
-            //
-            // Constructs a DATA packet to send over the network
-            //
-            HIRCPPacket sendPacket = HIRCPPacket::createDATAPacket(
-                leapData.data, leapData._MAX_PAYLOAD);
+        TimingStats::Clock::time_point stageBegin = TimingStats::Clock::now();
+        _frameStats[STAGE_TRACKING].add(frameBegin, stageBegin);
 
-            //
-            // Sends DATA packet to remote host
-            //
-            if (!send(sendPacket))
-            {
-                _socket->close();
-                _connected = false;
-                notify(EVENT_DISCONNECTED);
-                continue;
-            }
+        //
+        // A feedback mode chosen since the last frame goes to every robot.
+        // A robot connecting later gets it in its CRQ packet instead
+        //
+        bool modeChanged = _modePending.exchange(false);
+        if (modeChanged)
+        {
+            _mirrors.setMode(_mode);
+        }
 
-            //
-            // Constructs an empty packet to receive over the network
-            //
-            HIRCPPacket recvPacket = HIRCPPacket::createEmptyPacket();
+        //
+        // Sends the pose to any other robots, connected or not. They get it
+        // unstamped, as their clocks are not compared
+        //
+        _mirrors.update(leapData.data);
 
+        if (_connected)
+        {
             //
-            // Receives DATA from remote host
+            // Hands the pose to the network thread, in place of one it has
+            // yet to take, and takes the pressures of the latest DACK
             //
-            if (!recv(recvPacket))
             {
-                _socket->close();
-                _connected = false;
-                notify(EVENT_DISCONNECTED);
-                continue;
+                std::lock_guard<std::mutex> lock(_poseMutex);
+                if (_poseReady)
+                {
+                    _posesSkipped++;
+                }
+                std::copy(leapData.data, leapData.data +
+                    HIRCPPacket::MAX_PAYLOAD_LEN, _pose);
+                _poseReady = true;
+                _poseModeChanged = _poseModeChanged || modeChanged;
+                std::copy(_pressure, _pressure+NUM_FINGERS,
+                    fingerPressures.pressure);
             }
-
+            _poseCondition.notify_one();
+        }
+        else
+        {
             //
-            // Validate packet and take appropriate measures
+            // Only the newest pose is kept for when the link comes back
             //
-            if (!recvPacket.isValid() ||
-                (recvPacket.getType() != HIRCPPacket::DACK))
+            std::lock_guard<std::mutex> lock(_reconnectMutex);
+            if (_reconnecting)
             {
-                //
-                // TODO (Brandon): Create and send error packet
-                //
+                std::copy(leapData.data, leapData.data +
+                    HIRCPPacket::MAX_PAYLOAD_LEN, _latestPose);
+                _latestPoseValid = true;
             }
-
-            //
-            // Populates FingerPressureStruct with finger pressure information
-            //
-            _populateFingerPressureStruct(fingerPressures, recvPacket);
         }
+        _frameStats[STAGE_NETWORK].add(stageBegin, TimingStats::Clock::now());
+
+        //
+        // Each finger feels the hardest press on any robot
+        //
+        _mirrors.getPressures(fingerPressures.pressure);
 
         //
         // Updates model
         //
+        stageBegin = TimingStats::Clock::now();
         _update(leapData, fingerPressures);
 
         //
         // Updates GUI
         //
         _render();
+        _frameStats[STAGE_RENDER].add(stageBegin, TimingStats::Clock::now());
+        _frameStats[STAGE_FRAME].add(frameBegin, TimingStats::Clock::now());
+
+        //
+        // Reports frame timings together with the robot's own
+        //
+        if (TimingStats::Clock::now() - _lastProfileReport >=
+            std::chrono::seconds(PROFILE_REPORT_PERIOD_S))
+        {
+            _reportProfile();
+        }
 
         //
         // Ends frame and blocks until FPS elapses
         //
         _fpsManager.endFrame();
     }
+
+    {
+        std::lock_guard<std::mutex> lock(_poseMutex);
+        _networkStopped = true;
+    }
+    _poseCondition.notify_one();
+    _networkThread.join();
+
+    _stopReconnect();
 }
 
 //*****************************************************************************
 //
-//! Connects to remote host. Synchronized by mutex.
+//! Thread function that exchanges the poses run() hands over with the robot
+//! connected to. A pose is sent once the robot has answered the last, and
+//! the newest is taken, so the robot may be sent fewer poses than there are
+//! frames but is never sent a stale one. Calls _linkLost() when the
+//! connection fails.
 //!
-//! \param ipAddress the IPv4 address of the remote host.
+//! \param None.
 //!
-//! \return Returns \b true if the connection was established successfully and
-//! \b false otherwise.
+//! \return None.
 //
 //*****************************************************************************
-bool Panel::connect(char *ipAddressString)
+void Panel::_network()
 {
-    const int PORT = 5001;
+    unsigned char pose[HIRCPPacket::MAX_PAYLOAD_LEN];
+    FingerPressureStruct fingerPressures;
 
-    if (_connected)
+    std::unique_lock<std::mutex> lock(_poseMutex);
+    while (true)
     {
-        std::cout << "Already connected." << std::endl;
-        return false;
+        _poseCondition.wait(lock,
+            [this]() { return _poseReady || _networkStopped; });
+        if (_networkStopped)
+        {
+            return;
+        }
+
+        std::copy(_pose, _pose+HIRCPPacket::MAX_PAYLOAD_LEN, pose);
+        bool modeChanged = _poseModeChanged;
+        _poseReady = false;
+        _poseModeChanged = false;
+        lock.unlock();
+
+        for (int i=0; i<NUM_FINGERS; i++)
+        {
+            fingerPressures.pressure[i] = 0;
+        }
+
+        //
+        // A pose handed over just as the connection closed is dropped
+        //
+        bool exchanged = false;
+        TimingStats::Clock::time_point exchangeBegin =
+            TimingStats::Clock::now();
+        if (_connected)
+        {
+            exchanged = _exchange(pose, modeChanged, fingerPressures);
+            if (!exchanged)
+            {
+                _linkLost();
+            }
+            else if (_reportPending.exchange(false))
+            {
+                _reportConnection();
+            }
+        }
+        TimingStats::Clock::time_point exchangeEnd =
+            TimingStats::Clock::now();
+
+        lock.lock();
+        std::copy(fingerPressures.pressure,
+            fingerPressures.pressure+NUM_FINGERS, _pressure);
+        if (exchanged)
+        {
+            _exchangeStats.add(exchangeBegin, exchangeEnd);
+        }
     }
+}
+
+//*****************************************************************************
+//
+//! Carries out an exchange with the robot connected to: pending requests
+//! first, then the pose, whose DACK is waited for. Called from the network
+//! thread only.
+//!
+//! \param pose the DATA payload, HIRCPPacket::MAX_PAYLOAD_LEN bytes.
+//! \param modeChanged whether the feedback mode changed since the last pose.
+//! \param fingerPressures a structure receiving the pressures in the DACK.
+//!
+//! \return Returns \b false if the connection failed and \b true otherwise.
+//
+//*****************************************************************************
+bool Panel::_exchange(const unsigned char *pose, bool modeChanged,
+    FingerPressureStruct &fingerPressures)
+{
+    const int PING_PERIOD_MS = 500;
 
     //
-    // Constructs an IPv4 address from ip string
+    // Uploads, controls and monitors playback on the robot
     //
-    IPv4Address address(ipAddressString, PORT);
+    if (!_serviceRobotPlayback())
+    {
+        return false;
+    }
+
+    if (modeChanged)
+    {
+        HIRCPPacket modePacket = HIRCPPacket::createMODEPacket(_mode);
+        if (!send(modePacket))
+        {
+            return false;
+        }
+    }
 
     //
-    // Locks mutex protecting socket
+    // Sends force setpoints given since the last frame
     //
-    std::lock_guard<std::mutex> lock(_socket_mutex);
+    if (!_sendForceSetpoints())
+    {
+        return false;
+    }
 
     //
-    // Opens socket
+    // Keeps the connection open and measures its round trip. The
+    // PING goes ahead of the DATA packet so that the robot answers
+    // it ahead of the DACK
     //
-    if (!_socket->open())
+    if (TimingStats::Clock::now() - _lastPing >=
+        std::chrono::milliseconds(PING_PERIOD_MS))
     {
-        return false;
+        if (!_sendPing())
+        {
+            return false;
+        }
     }
 
     //
-    // Connects to remote host
+    // Polls the robot's statistics, answered along with the DACK
     //
-    if (!_socket->connect(&address))
+    if (!_sendStats())
     {
-        std::cout << "Unable to connect to " << ipAddressString << std::endl;
         return false;
     }
-    std::cout << "Connected to " << ipAddressString << std::endl;
 
     //
-    // Constructs a CRQ packet to send to remote host
+    // Constructs a DATA packet to send over the network
     //
-    HIRCPPacket crqPacket = HIRCPPacket::createCRQPacket(_mode);
-    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
-    crqPacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
-
-    std::cout << "Sending packet: ";
-    for (int i = 0; i < HIRCPPacket::MAX_PACKET_SIZE; i++)
+    unsigned char payload[HIRCPPacket::MAX_PAYLOAD_LEN];
+    std::copy(pose, pose+HIRCPPacket::MAX_PAYLOAD_LEN, payload);
     {
-        std::cout << static_cast<unsigned int>(message[i]) << " ";
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+        _stampPose(payload);
     }
-    std::cout << std::endl;
+    HIRCPPacket sendPacket = HIRCPPacket::createDATAPacket(payload,
+        HIRCPPacket::MAX_PAYLOAD_LEN);
 
     //
-    // Sends packet to remote host
+    // Sends DATA packet to remote host
     //
-    if (!_socket->send(message, HIRCPPacket::MAX_PACKET_SIZE))
+    if (!send(sendPacket))
     {
-        std::cout << "[ERROR] Panel::connect(): Send failed." << std::endl;
         return false;
     }
 
     //
-    // Creates an empty packet to store ACK received from remote host
+    // Constructs an empty packet to receive over the network
     //
-    HIRCPPacket ackPacket = HIRCPPacket::createEmptyPacket();
+    HIRCPPacket recvPacket = HIRCPPacket::createEmptyPacket();
 
     //
-    // Receives packet from remote host
+    // Receives DATA from remote host
     //
-    if (!_socket->recv(message, HIRCPPacket::MAX_PACKET_SIZE))
+    if (!recv(recvPacket))
     {
-        std::cout << "[ERROR] Panel::connect(): Receive failed." << std::endl;
         return false;
     }
 
-    std::cout << "Receiving packet: ";
-    for (int i = 0; i < HIRCPPacket::MAX_PACKET_SIZE; i++)
+    //
+    // Takes a PONG that came after the DACK now rather than a pose
+    // late, which would add the wait to its round trip. The robot's
+    // statistics are printed once the last STATS reply is in
+    //
+    if (!_drainReplies())
     {
-        std::cout << static_cast<unsigned int>(message[i]) << " ";
+        return false;
     }
-    std::cout << std::endl;
+    _reportRobot();
 
     //
-    // Populates packet with received data
+    // Validate packet and take appropriate measures
     //
-    ackPacket.populate(message, HIRCPPacket::MAX_PACKET_SIZE);
-
-    if (!ackPacket.isValid() || (ackPacket.getType() != HIRCPPacket::ACK))
+    if (!recvPacket.isValid() ||
+        (recvPacket.getType() != HIRCPPacket::DACK))
     {
         //
-        // Packet received was not an ACK packet so terminate connection
+        // TODO (Brandon): Create and send error packet
         //
-        _socket->close();
-
-        std::cout << "Connection rejected." << std::endl;
-        std::cout << "Disconnected from socket." << std::endl;
     }
 
-    _connected = true;
+    //
+    // Populates FingerPressureStruct with finger pressure information
+    //
+    _populateFingerPressureStruct(fingerPressures, recvPacket);
+
     return true;
+
 }
 
 //*****************************************************************************
 //
-//! Terminates connection to remote host. Synchronized by mutex.
+//! Connects to remote host. Synchronized by mutex.
 //!
-//! \param None.
+//! \param ipAddress the IPv4 address of the remote host.
 //!
-//! \return Returns \b true if the connection was closed successfully and \b
-//! false otherwise.
+//! \return Returns \b true if the connection was established successfully and
+//! \b false otherwise.
 //
 //*****************************************************************************
-bool Panel::disconnect()
+bool Panel::connect(char *ipAddressString)
 {
-    if (_connected)
-    {
-        //
-        // Locks mutex protecting socket
-        //
-        std::lock_guard<std::mutex> lock(_socket_mutex);
-
-        //
-        // Constructs a TRQ packet to send to remote host
-        //
-        HIRCPPacket trqPacket = HIRCPPacket::createTRQPacket();
-        unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
-        trqPacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
-
-        std::cout << "Sending packet: ";
-        for (int i = 0; i < HIRCPPacket::MAX_PACKET_SIZE; i++)
-        {
-            std::cout << static_cast<unsigned int>(message[i]) << " ";
-        }
-        std::cout << std::endl;
-
-        //
-        // Sends packet to remote host
-        //
-        if (!_socket->send(message, HIRCPPacket::MAX_PACKET_SIZE))
-        {
-            std::cout << "[ERROR] Panel::disconnect(): Send failed." <<
-                std::endl;
-            return false;
-        }
-
-        //
-        // Creates an empty packet to store ACK received from remote host
-        //
-        HIRCPPacket ackPacket = HIRCPPacket::createEmptyPacket();
-
-        //
-        // Receives packet from remote host
-        //
-        if (!_socket->recv(message, HIRCPPacket::MAX_PACKET_SIZE))
-        {
-            std::cout << "[ERROR] Panel::Disconnect(): Receive failed." <<
-                std::endl;
-            return false;
-        }
-
-        std::cout << "Receiving packet: ";
-        for (int i = 0; i < HIRCPPacket::MAX_PACKET_SIZE; i++)
-        {
-            std::cout << static_cast<unsigned int>(message[i]) << " ";
-        }
-        std::cout << std::endl;
-
-        //
-        // Populates packet with received data
-        //
-        ackPacket.populate(message, HIRCPPacket::MAX_PACKET_SIZE);
-
-        if (!ackPacket.isValid() || (ackPacket.getType() != HIRCPPacket::ACK))
-        {
-            //
-            // Packet received was not an ACK packet so terminate connection
-            //
-            std::cout << "Safe disconnection failed... forcing disconnect" <<
-                std::endl;
-        }
-
-        _socket->close();
-        _connected = false;
-
-        std::cout << "Disconnected from socket." << std::endl;
-
-        return true;
-    }
-    std::cout << "Not connected." << std::endl;
-    return false;
+    std::vector<std::string> candidates(1, std::string(ipAddressString));
+    return connect(candidates) == 0;
 }
 
 //*****************************************************************************
 //
-//! Sends data to remote host. Synchronized by mutex.
+//! Connects to whichever of the remote hosts accepts first, on the default
+//! port. Invalid addresses are skipped.
 //!
-//! \param packet HIRCP packet with data to send.
+//! \param candidates the IPv4 addresses of the remote hosts, best first.
 //!
-//! \return Returns \b true if the packet was sent successfully and \b false
-//! otherwise.
+//! \return Returns the index of the address connected to, or -1 if none
+//! accepted.
 //
 //*****************************************************************************
-bool Panel::send(HIRCPPacket &packet)
+int Panel::connect(const std::vector<std::string> &candidates)
 {
-    if (_connected)
-    {
-        //
-        // Locks mutex protecting socket
-        //
-        std::lock_guard<std::mutex> lock(_socket_mutex);
-        
-        //
-        // Get packet data
-        //
-        unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
-        packet.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+    const int PORT = 5001;
 
-        std::cout << "Sending packet: ";
-        for (int i=0; i<HIRCPPacket::MAX_PACKET_SIZE; i++)
+    //
+    // Constructs IPv4 addresses from the valid ip strings
+    //
+    std::vector<IPv4Address> addresses;
+    std::vector<int> indices;
+    for (unsigned int i=0; i<candidates.size(); i++)
+    {
+        char ipAddressString[IPv4Address::MAX_IP_ADDR_BUF_LEN];
+        if (candidates[i].size() > IPv4Address::MAX_IP_ADDR_LEN)
         {
-            std::cout << static_cast<unsigned int>(message[i]) << " ";
+            continue;
         }
-        std::cout << std::endl;
-
-        //
-        // Send packet data to remote host
-        //
-        if (!_socket->send(message, HIRCPPacket::MAX_PACKET_SIZE))
+        strcpy(ipAddressString, candidates[i].c_str());
+        if (!IPv4Address::validateIPAddress(ipAddressString))
         {
-            std::cout << "[ERROR] Panel::send(): Send failed." << std::endl;
-            return false;
+            continue;
         }
 
-        return true;
+        addresses.push_back(IPv4Address(ipAddressString, PORT));
+        indices.push_back(static_cast<int>(i));
     }
 
-    std::cout << "[WARNING] Panel::send(): Not connected." << std::endl;
-    return false;
+    int candidate = connect(addresses);
+    if (candidate < 0)
+    {
+        return -1;
+    }
+
+    int index = indices[candidate];
+    std::cout << "Connected to " << candidates[index] << std::endl;
+    return index;
 }
 
 //*****************************************************************************
 //
-//! Receives data from remote host. Synchronized by mutex.
+//! Connects to whichever of the remote hosts accepts first. Every address is
+//! tried at once, so an offline address costs nothing while another answers;
+//! where two answer together the earlier address wins. Should the link be
+//! lost, the same host is reconnected to in the background.
 //!
-//! \param packet HIRCP packet to hold received data.
+//! \param candidates the addresses and ports of the remote hosts, best
+//! first.
 //!
-//! \return Returns \b true if the packet was received successfully and \b
-//! false otherwise.
+//! \return Returns the index of the address connected to, or -1 if none
+//! accepted.
 //
 //*****************************************************************************
-bool Panel::recv(HIRCPPacket &packet)
+int Panel::connect(const std::vector<IPv4Address> &candidates)
 {
-    if (_connected)
+    const int CONNECT_TIMEOUT_MS = 3000;
+
+    if (_connected || isReconnecting())
+    {
+        std::cout << "Already connected." << std::endl;
+        return -1;
+    }
+
+    int candidate = _open(candidates, CONNECT_TIMEOUT_MS, nullptr);
+    if (candidate < 0)
+    {
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(_reconnectMutex);
+    _peer = candidates[candidate];
+    return candidate;
+}
+
+//*****************************************************************************
+//
+//! Checks whether a lost connection is being reestablished.
+//!
+//! \param None.
+//!
+//! \return Returns \b true while reconnecting and \b false otherwise.
+//
+//*****************************************************************************
+bool Panel::isReconnecting()
+{
+    std::lock_guard<std::mutex> lock(_reconnectMutex);
+    return _reconnecting;
+}
+
+//*****************************************************************************
+//
+//! Connects to every one of the remote hosts that accepts and mirrors the
+//! poses to them alongside the robot connected to. They are sent DATA and
+//! MODE packets only, in the current feedback mode, and are left out of
+//! reconnecting, pinging and robot playback.
+//!
+//! \param addresses the addresses and ports of the remote hosts.
+//!
+//! \return Returns the number of hosts added.
+//
+//*****************************************************************************
+int Panel::addMirrors(const std::vector<IPv4Address> &addresses)
+{
+    const int CONNECT_TIMEOUT_MS = 1000;
+
+    //
+    // The robot connected to is never mirrored to as well
+    //
+    std::vector<IPv4Address> candidates;
+    {
+        std::lock_guard<std::mutex> lock(_reconnectMutex);
+        for (IPv4Address address : addresses)
+        {
+            if (!_connected || address.getAddress() != _peer.getAddress() ||
+                address.getPort() != _peer.getPort())
+            {
+                candidates.push_back(address);
+            }
+        }
+    }
+
+    HIRCPPacket crqPacket = HIRCPPacket::createCRQPacket(_mode,
+        HIRCPPacket::TIMED_DACK);
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    crqPacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+    //
+    // The sockets are set up like the robot's, which the reconnect thread
+    // may be replacing
+    //
+    FastConnector connector;
     {
-        //
-        // Locks mutex protecting socket
-        //
         std::lock_guard<std::mutex> lock(_socket_mutex);
+        connector.setSocketOptions(_socket->getTimeout(),
+            _socket->getProfile());
+    }
+    std::vector<FastConnector::Connection> connections;
+    connector.connectAll(candidates, message, CONNECT_TIMEOUT_MS,
+        connections);
 
-        //
-        // Buffer to store packet data
-        //
-        unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    int added = 0;
+    for (unsigned int i=0; i<connections.size(); i++)
+    {
+        if (_mirrors.add(candidates[connections[i].candidate],
+            connections[i]))
+        {
+            added++;
+        }
+    }
+
+    if (added == 0)
+    {
+        std::cout << "Unable to mirror to any of " << candidates.size() <<
+            " addresses." << std::endl;
+    }
+    return added;
+}
+
+//*****************************************************************************
+//
+//! Stops mirroring the poses and disconnects from the hosts mirrored to.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::removeMirrors()
+{
+    _mirrors.clear();
+}
+
+//*****************************************************************************
+//
+//! Opens a connection to whichever of the remote hosts accepts the CRQ
+//! packet first, in the current feedback mode. The socket mutex is only held
+//! to hand over the connection, so frames keep going meanwhile.
+//!
+//! \param candidates the addresses and ports of the remote hosts, best
+//! first.
+//! \param timeoutMs the longest time to wait in milliseconds.
+//! \param pose a DATA payload to send first, or nullptr for none.
+//!
+//! \return Returns the index of the address connected to, or -1 if none
+//! accepted.
+//
+//*****************************************************************************
+int Panel::_open(const std::vector<IPv4Address> &candidates, int timeoutMs,
+    const unsigned char *pose)
+{
+    //
+    // Asks for DACKs sent ahead of actuation, stamped with the sensor age,
+    // and to stamp DATA packets with their send time
+    //
+    const unsigned char OPTIONS = HIRCPPacket::TIMED_DACK |
+        HIRCPPacket::STAMPED_DATA;
+
+    //
+    // Constructs a CRQ packet to send to remote host
+    //
+    HIRCPPacket crqPacket = HIRCPPacket::createCRQPacket(_mode, OPTIONS);
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    crqPacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+    std::cout << "Sending packet: ";
+    for (int i = 0; i < HIRCPPacket::MAX_PACKET_SIZE; i++)
+    {
+        std::cout << static_cast<unsigned int>(message[i]) << " ";
+    }
+    std::cout << std::endl;
+
+    //
+    // Connects and sends the CRQ packet to every remote host, the sockets
+    // set up like the one they replace
+    //
+    FastConnector connector;
+    {
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+        connector.setSocketOptions(_socket->getTimeout(),
+            _socket->getProfile());
+    }
+    FastConnector::Connection connection;
+    if (!connector.connect(candidates, message, timeoutMs, connection))
+    {
+        std::cout << "Unable to connect to any of " << candidates.size() <<
+            " addresses." << std::endl;
+        return -1;
+    }
+
+    std::cout << "Receiving packet: ";
+    for (int i = 0; i < HIRCPPacket::MAX_PACKET_SIZE; i++)
+    {
+        std::cout << static_cast<unsigned int>(connection.ack[i]) << " ";
+    }
+    std::cout << std::endl;
+
+    //
+    // Populates packet with received data
+    //
+    HIRCPPacket ackPacket = HIRCPPacket::createEmptyPacket();
+    ackPacket.populate(connection.ack, HIRCPPacket::MAX_PACKET_SIZE);
+
+    //
+    // Locks mutex protecting socket
+    //
+    std::lock_guard<std::mutex> lock(_socket_mutex);
+    _socket = std::move(connection.socket);
+    _frameReader = connection.frameReader;
+
+    //
+    // Firmware that predates the options grants none
+    //
+    unsigned char ackPayload[HIRCPPacket::MAX_PAYLOAD_LEN];
+    ackPacket.getPayload(ackPayload, HIRCPPacket::MAX_PAYLOAD_LEN);
+    _timedDack = (ackPayload[0] & HIRCPPacket::TIMED_DACK) != 0;
+    _stampedData = (ackPayload[0] & HIRCPPacket::STAMPED_DATA) != 0;
+    _feedbackAge = 0;
+    _robotState = HIRCPPacket::TRAJ_EMPTY;
+
+    //
+    // The robot starts from its default setpoints, so any given are sent
+    // again on the first frame
+    //
+    {
+        std::lock_guard<std::mutex> forceLock(_forceMutex);
+        _forceSetpointsPending = _forceSetpointsSet;
+    }
+    _roundTrip.reset();
+    _pingsSent = 0;
+    _pongsReceived = 0;
+
+    //
+    // The robot may have restarted since, so its clock is compared afresh,
+    // starting with the first frame
+    //
+    _lastPing = TimingStats::Clock::time_point();
+    _heldValid = false;
+    _lastReceived = TimingStats::Clock::now();
+    _statsNext = 0;
+    _statsEnd = 0;
+    _statsAwaiting = false;
+    _clock.reset();
+    _uplinkStats.reset();
+    _downlinkStats.reset();
+    _sensorAgeStats.reset();
+
+    //
+    // The pose goes out, and its DACK is taken, before the next frame can
+    // send one of its own
+    //
+    if (pose != nullptr)
+    {
+        unsigned char payload[HIRCPPacket::MAX_PAYLOAD_LEN];
+        std::copy(pose, pose+HIRCPPacket::MAX_PAYLOAD_LEN, payload);
+        _stampPose(payload);
+        HIRCPPacket dataPacket = HIRCPPacket::createDATAPacket(payload,
+            HIRCPPacket::MAX_PAYLOAD_LEN);
+        dataPacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+        if (!_socket->send(message, HIRCPPacket::MAX_PACKET_SIZE) ||
+            !_recvPacket(message))
+        {
+            std::cout << "[ERROR] Panel::_open(): Connection lost again." <<
+                std::endl;
+            _socket->close();
+            return -1;
+        }
+    }
+
+    _connected = true;
+    return connection.candidate;
+}
+
+//*****************************************************************************
+//
+//! Closes a connection that failed and starts reconnecting in the
+//! background. Playback on the robot ends with the connection. Called from
+//! the network thread only; a connection that disconnect() closed meanwhile is
+//! left closed.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_linkLost()
+{
+    {
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+        if (!_connected)
+        {
+            return;
+        }
+        _socket->close();
+        _connected = false;
+    }
+
+    if (_robotState == HIRCPPacket::TRAJ_PLAYING ||
+        _robotState == HIRCPPacket::TRAJ_PAUSED)
+    {
+        _robotState = HIRCPPacket::TRAJ_READY;
+        notify(EVENT_ROBOT_PLAYBACK_FAILED);
+    }
+
+    std::thread finished;
+    {
+        std::lock_guard<std::mutex> lock(_reconnectMutex);
+        if (_reconnecting)
+        {
+            return;
+        }
 
         //
-        // Receives packet from remote host
+        // The previous attempt has reconnected and is returning
         //
-        if (!_socket->recv(message, HIRCPPacket::MAX_PACKET_SIZE))
+        finished = std::move(_reconnectThread);
+        _reconnecting = true;
+        _reconnectCancelled = false;
+        _latestPoseValid = false;
+        _reconnectThread = std::thread(&Panel::_reconnect, this);
+    }
+    if (finished.joinable())
+    {
+        finished.join();
+    }
+
+    std::cout << "[WARNING] Panel::_linkLost(): Connection lost, "\
+        "reconnecting." << std::endl;
+    notify(EVENT_RECONNECTING);
+}
+
+//*****************************************************************************
+//
+//! Thread function that reconnects to the host last connected to, in the
+//! same feedback mode, after a delay that grows with every failed attempt.
+//! The newest pose captured meanwhile is sent first. Notifies
+//! EVENT_RECONNECTED on success and EVENT_DISCONNECTED on giving up.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_reconnect()
+{
+    const int RECONNECT_INITIAL_MS = 20;
+    const int RECONNECT_MAX_MS = 2000;
+    const int RECONNECT_MIN_TIMEOUT_MS = 200;
+    const int RECONNECT_MAX_TIMEOUT_MS = 1000;
+    const int RECONNECT_GIVE_UP_S = 30;
+
+    TimingStats::Clock::time_point lost = TimingStats::Clock::now();
+    Backoff backoff(RECONNECT_INITIAL_MS, RECONNECT_MAX_MS);
+
+    //
+    // A connection takes two round trips, the TCP handshake and the CRQ,
+    // each given as long as a reply on the lost connection was
+    //
+    int timeoutMs = RECONNECT_MAX_TIMEOUT_MS;
+    {
+        std::lock_guard<std::mutex> socketLock(_socket_mutex);
+        if (_roundTrip.getCount() > 0)
         {
-            std::cout << "[ERROR] Panel::recv(): Receive failed." << std::endl;
-            return false;
+            timeoutMs = static_cast<int>(2*_roundTrip.getTimeout(
+                RECONNECT_MIN_TIMEOUT_MS*1000.0/2)/1000);
+            timeoutMs = std::min(timeoutMs, RECONNECT_MAX_TIMEOUT_MS);
         }
+    }
 
+    std::unique_lock<std::mutex> lock(_reconnectMutex);
+    std::vector<IPv4Address> peer(1, _peer);
+
+    while (true)
+    {
         //
-        // Populates packet with received data
+        // Waits out the delay unless cancelled by disconnect()
         //
-        packet.populate(message, HIRCPPacket::MAX_PACKET_SIZE);
+        if (_reconnectCondition.wait_for(lock,
+            std::chrono::milliseconds(backoff.nextDelayMs()),
+            [this]() { return _reconnectCancelled; }))
+        {
+            _reconnecting = false;
+            return;
+        }
 
-        std::cout << "Receiving packet: ";
-        for (int i=0; i<HIRCPPacket::MAX_PACKET_SIZE; i++)
+        unsigned char pose[HIRCPPacket::MAX_PAYLOAD_LEN];
+        bool poseValid = _latestPoseValid;
+        std::copy(_latestPose, _latestPose+HIRCPPacket::MAX_PAYLOAD_LEN,
+            pose);
+        lock.unlock();
+
+        int candidate = _open(peer, timeoutMs,
+            poseValid ? pose : nullptr);
+
+        lock.lock();
+        long long elapsedMs = std::chrono::duration_cast<
+            std::chrono::milliseconds>(TimingStats::Clock::now() -
+            lost).count();
+        if (candidate >= 0)
         {
-            std::cout << static_cast<unsigned int>(message[i]) << " ";
+            _reconnecting = false;
+            lock.unlock();
+            std::cout << "[NOTICE] Panel::_reconnect(): Reconnected after " <<
+                elapsedMs << " ms and " << backoff.getAttempts() <<
+                " attempts." << std::endl;
+            notify(EVENT_RECONNECTED);
+            return;
         }
-        std::cout << std::endl;
 
-        return true;
+        if (_reconnectCancelled ||
+            elapsedMs >= RECONNECT_GIVE_UP_S*1000LL)
+        {
+            bool cancelled = _reconnectCancelled;
+            _reconnecting = false;
+            lock.unlock();
+            if (!cancelled)
+            {
+                std::cout << "[ERROR] Panel::_reconnect(): Gave up after " <<
+                    backoff.getAttempts() << " attempts." << std::endl;
+                notify(EVENT_DISCONNECTED);
+            }
+            return;
+        }
     }
-
-    std::cout << "[WARNING] Panel::recv(): Not connected." << std::endl;
-    return false;
 }
 
 //*****************************************************************************
 //
-//! Starts recording data stream to file.
+//! Cancels reconnecting, waiting for an attempt in progress to end.
 //!
-//! \param filePath path to file to save data stream to.
+//! \param None.
 //!
-//! \return Returns \b true if recording started successfully and \b false
+//! \return Returns \b true if the panel was reconnecting and \b false
 //! otherwise.
 //
 //*****************************************************************************
-bool Panel::startRecording(char *filePath)
+bool Panel::_stopReconnect()
 {
-    if (_playbackStreamer->isStreaming())
+    std::thread reconnectThread;
+    bool reconnecting;
     {
-        std::cout << "[ERROR] Panel::startRecording(): Cannot record while "\
-            "streaming." << std::endl;
-        return false;
+        std::lock_guard<std::mutex> lock(_reconnectMutex);
+        reconnecting = _reconnecting;
+        _reconnectCancelled = true;
+        reconnectThread = std::move(_reconnectThread);
+    }
+    _reconnectCondition.notify_all();
+
+    if (reconnectThread.joinable())
+    {
+        reconnectThread.join();
+    }
+    return reconnecting;
+}
+
+//*****************************************************************************
+//
+//! Terminates connection to remote host. The robot is sent a TRQ packet
+//! and its ACK waited for, but the connection is closed, and reconnecting
+//! cancelled, whether or not it answers. Synchronized by mutex.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if a connection was closed or reconnecting
+//! stopped and \b false if there was neither.
+//
+//*****************************************************************************
+bool Panel::disconnect()
+{
+    bool reconnecting = _stopReconnect();
+
+    //
+    // An attempt that succeeds as it is cancelled is disconnected here
+    //
+    bool connected;
+    {
+        //
+        // Locks mutex protecting socket
+        //
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+        connected = _connected;
+        if (connected)
+        {
+            _sendTRQ();
+
+            //
+            // Once cleared, the network thread leaves the connection closed
+            //
+            _socket->close();
+            _connected = false;
+        }
+    }
+
+    //
+    // A link lost before the mutex was taken started reconnecting again
+    //
+    reconnecting = _stopReconnect() || reconnecting;
+
+    if (connected)
+    {
+        std::cout << "Disconnected from socket." << std::endl;
+        return true;
+    }
+    if (reconnecting)
+    {
+        std::cout << "Stopped reconnecting." << std::endl;
+        return true;
+    }
+    std::cout << "Not connected." << std::endl;
+    return false;
+}
+
+//*****************************************************************************
+//
+//! Asks the robot to terminate the connection with a TRQ packet and waits
+//! for its ACK. The caller holds the socket mutex and closes the socket.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if the robot acknowledged and \b false otherwise.
+//
+//*****************************************************************************
+bool Panel::_sendTRQ()
+{
+    //
+    // Constructs a TRQ packet to send to remote host
+    //
+    HIRCPPacket trqPacket = HIRCPPacket::createTRQPacket();
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    trqPacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+    std::cout << "Sending packet: ";
+    for (int i = 0; i < HIRCPPacket::MAX_PACKET_SIZE; i++)
+    {
+        std::cout << static_cast<unsigned int>(message[i]) << " ";
+    }
+    std::cout << std::endl;
+
+    //
+    // Sends packet to remote host
+    //
+    if (!_socket->send(message, HIRCPPacket::MAX_PACKET_SIZE))
+    {
+        std::cout << "[ERROR] Panel::_sendTRQ(): Send failed." << std::endl;
+        return false;
+    }
+
+    //
+    // Receives packet from remote host
+    //
+    if (!_recvPacket(message))
+    {
+        std::cout << "[ERROR] Panel::_sendTRQ(): Receive failed." <<
+            std::endl;
+        return false;
+    }
+
+    std::cout << "Receiving packet: ";
+    for (int i = 0; i < HIRCPPacket::MAX_PACKET_SIZE; i++)
+    {
+        std::cout << static_cast<unsigned int>(message[i]) << " ";
+    }
+    std::cout << std::endl;
+
+    //
+    // Populates packet with received data
+    //
+    HIRCPPacket ackPacket = HIRCPPacket::createEmptyPacket();
+    ackPacket.populate(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+    if (!ackPacket.isValid() || (ackPacket.getType() != HIRCPPacket::ACK))
+    {
+        //
+        // Packet received was not an ACK packet so terminate connection
+        //
+        std::cout << "Safe disconnection failed... forcing disconnect" <<
+            std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Sends data to remote host. Synchronized by mutex.
+//!
+//! \param packet HIRCP packet with data to send.
+//!
+//! \return Returns \b true if the packet was sent successfully and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::send(HIRCPPacket &packet)
+{
+    if (_connected)
+    {
+        //
+        // Locks mutex protecting socket
+        //
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+        
+        //
+        // Get packet data
+        //
+        unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+        packet.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+        std::cout << "Sending packet: ";
+        for (int i=0; i<HIRCPPacket::MAX_PACKET_SIZE; i++)
+        {
+            std::cout << static_cast<unsigned int>(message[i]) << " ";
+        }
+        std::cout << std::endl;
+
+        //
+        // Send packet data to remote host
+        //
+        if (!_socket->send(message, HIRCPPacket::MAX_PACKET_SIZE))
+        {
+            std::cout << "[ERROR] Panel::send(): Send failed." << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    std::cout << "[WARNING] Panel::send(): Not connected." << std::endl;
+    return false;
+}
+
+//*****************************************************************************
+//
+//! Receives data from remote host. Synchronized by mutex.
+//!
+//! \param packet HIRCP packet to hold received data.
+//!
+//! \return Returns \b true if the packet was received successfully and \b
+//! false otherwise.
+//
+//*****************************************************************************
+bool Panel::recv(HIRCPPacket &packet)
+{
+    if (_connected)
+    {
+        //
+        // Locks mutex protecting socket
+        //
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+
+        //
+        // Buffer to store packet data
+        //
+        unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+
+        //
+        // Receives packet from remote host
+        //
+        if (!_recvPacket(message))
+        {
+            std::cout << "[ERROR] Panel::recv(): Receive failed." << std::endl;
+            return false;
+        }
+
+        //
+        // Populates packet with received data
+        //
+        packet.populate(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+        std::cout << "Receiving packet: ";
+        for (int i=0; i<HIRCPPacket::MAX_PACKET_SIZE; i++)
+        {
+            std::cout << static_cast<unsigned int>(message[i]) << " ";
+        }
+        std::cout << std::endl;
+
+        return true;
+    }
+
+    std::cout << "[WARNING] Panel::recv(): Not connected." << std::endl;
+    return false;
+}
+
+//*****************************************************************************
+//
+//! Receives the next whole packet through the frame reader, reading from
+//! the socket until one is complete or the socket's timeout elapses. PONG
+//! and STATS packets received meanwhile are taken in and skipped. The caller
+//! holds the socket mutex.
+//!
+//! \param message buffer receiving HIRCPPacket::MAX_PACKET_SIZE bytes.
+//!
+//! \return Returns \b true if a packet was received and \b false otherwise.
+//
+//*****************************************************************************
+bool Panel::_recvPacket(unsigned char *message)
+{
+    int timeoutMs = _socket->getTimeout();
+    TimingStats::Clock::time_point deadline = TimingStats::Clock::now() +
+        std::chrono::milliseconds(timeoutMs);
+    unsigned long discarded = _frameReader.getDiscarded();
+
+    //
+    // A packet read past while draining PONGs comes first
+    //
+    if (_heldValid)
+    {
+        std::copy(_heldPacket, _heldPacket+HIRCPPacket::MAX_PACKET_SIZE,
+            message);
+        _heldValid = false;
+        return true;
+    }
+
+    //
+    // Packets merged into an earlier read are already buffered. PONG and
+    // STATS packets answer no request of the caller's and are taken here
+    //
+    while (true)
+    {
+        if (_frameReader.next(message))
+        {
+            if (!_takeReply(message))
+            {
+                break;
+            }
+            continue;
+        }
+
+        int remainingMs = timeoutMs;
+        if (timeoutMs != TCPSocket::NO_TIMEOUT)
+        {
+            remainingMs = static_cast<int>(std::chrono::duration_cast<
+                std::chrono::milliseconds>(deadline -
+                TimingStats::Clock::now()).count());
+            if (remainingMs <= 0)
+            {
+                std::cout << "[ERROR] Panel::_recvPacket(): Timed out with "
+                    << _frameReader.getBuffered() << " bytes of a packet."
+                    << std::endl;
+                _socket->close();
+                return false;
+            }
+        }
+
+        unsigned char *space;
+        unsigned int len = _frameReader.getSpace(space);
+        int received = _socket->recvSome(space,
+            static_cast<unsigned short>(len), remainingMs);
+        if (received <= 0)
+        {
+            //
+            // recvSome() leaves the socket open when the robot closed it
+            //
+            _socket->close();
+            return false;
+        }
+        _lastReceived = TimingStats::Clock::now();
+        _frameReader.commit(received);
+    }
+
+    if (_frameReader.getDiscarded() != discarded)
+    {
+        std::cout << "[WARNING] Panel::_recvPacket(): Discarded " <<
+            _frameReader.getDiscarded() - discarded << " bytes out of step."
+            << std::endl;
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Sends a PING packet stamped with the current time. The PONG is not
+//! waited for; _recvPacket() or _drainReplies() records it when it arrives.
+//!
+//! \param None.
+//!
+//! \return Returns \b false if the connection failed and \b true otherwise.
+//
+//*****************************************************************************
+bool Panel::_sendPing()
+{
+    _lastPing = TimingStats::Clock::now();
+    unsigned int timestampUs = static_cast<unsigned int>(
+        static_cast<unsigned long long>(_localMicros(_lastPing)));
+
+    HIRCPPacket pingPacket = HIRCPPacket::createPINGPacket(
+        static_cast<unsigned short>(_pingsSent++), timestampUs);
+    return send(pingPacket);
+}
+
+//*****************************************************************************
+//
+//! Takes in the PONG and STATS packets that have arrived, without waiting
+//! for any. Reading stops at the first other packet, which _recvPacket()
+//! returns next. Synchronized by mutex.
+//!
+//! \param None.
+//!
+//! \return Returns \b false if the connection failed and \b true otherwise.
+//
+//*****************************************************************************
+bool Panel::_drainReplies()
+{
+    std::lock_guard<std::mutex> lock(_socket_mutex);
+
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    while (!_heldValid)
+    {
+        if (_frameReader.next(message))
+        {
+            if (!_takeReply(message))
+            {
+                std::copy(message, message+HIRCPPacket::MAX_PACKET_SIZE,
+                    _heldPacket);
+                _heldValid = true;
+                break;
+            }
+            continue;
+        }
+
+        if (EventLoop::wait(_socket->getDescriptor(), EventLoop::EVENT_READ,
+            0) <= 0)
+        {
+            break;
+        }
+
+        unsigned char *space;
+        unsigned int len = _frameReader.getSpace(space);
+        int received = _socket->recvSome(space,
+            static_cast<unsigned short>(len), 0);
+        if (received <= 0)
+        {
+            _socket->close();
+            return false;
+        }
+        _lastReceived = TimingStats::Clock::now();
+        _frameReader.commit(received);
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Takes in a PONG or STATS packet, which answer none of the requests that
+//! are waited for. The caller holds the socket mutex.
+//!
+//! \param message the packet, HIRCPPacket::MAX_PACKET_SIZE bytes.
+//!
+//! \return Returns \b true if the packet was taken and \b false if it is
+//! left to the caller.
+//
+//*****************************************************************************
+bool Panel::_takeReply(const unsigned char *message)
+{
+    switch (message[HIRCPPacket::HIRCP_CONSTANT_LEN])
+    {
+    case HIRCPPacket::PONG:
+        _recordPong(message);
+        return true;
+    case HIRCPPacket::STATS:
+        _recordStats(message);
+        return true;
+    default:
+        return false;
+    }
+}
+
+//*****************************************************************************
+//
+//! Adds the round trip of a PONG packet to the estimate. The caller holds
+//! the socket mutex.
+//!
+//! \param message the PONG packet, HIRCPPacket::MAX_PACKET_SIZE bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_recordPong(const unsigned char *message)
+{
+    const int BITS_PER_BYTE = 8;
+
+    const unsigned char *payload = message + HIRCPPacket::HIRCP_CONSTANT_LEN +
+        HIRCPPacket::OPCODE_LEN;
+    unsigned int sentUs = (static_cast<unsigned int>(payload[2]) <<
+        3*BITS_PER_BYTE) | (payload[3] << 2*BITS_PER_BYTE) |
+        (payload[4] << BITS_PER_BYTE) | payload[5];
+    unsigned int robotUs = (static_cast<unsigned int>(payload[6]) <<
+        3*BITS_PER_BYTE) | (payload[7] << 2*BITS_PER_BYTE) |
+        (payload[8] << BITS_PER_BYTE) | payload[9];
+    //
+    // Timed from the read that brought the PONG in, as it may be parsed
+    // after a DACK that arrived with it
+    //
+    double now = _localMicros(_lastReceived);
+    unsigned int nowUs = static_cast<unsigned int>(
+        static_cast<unsigned long long>(now));
+
+    //
+    // Unsigned subtraction copes with the clock wrapping
+    //
+    double roundTrip = static_cast<double>(nowUs - sentUs);
+    _roundTrip.add(roundTrip);
+    _pongsReceived++;
+
+    //
+    // Firmware without a clock to compare leaves the robot time zero
+    //
+    if (robotUs != 0)
+    {
+        _clock.add(now - roundTrip, robotUs, now);
+        _uplinkStats.add(_clock.getUplink());
+        _downlinkStats.add(_clock.getDownlink());
+    }
+}
+
+//*****************************************************************************
+//
+//! Stamps a DATA payload with the current time on the robot's clock, when
+//! the robot granted the stamped DATA option. The stamp is 0 until the
+//! clocks have been compared. The caller holds the socket mutex.
+//!
+//! \param payload the DATA payload, MAX_PAYLOAD_LEN bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_stampPose(unsigned char *payload)
+{
+    const int BITS_PER_BYTE = 8;
+
+    if (!_stampedData)
+    {
+        return;
+    }
+
+    unsigned int stamp = 0;
+    if (_clock.isSynchronized())
+    {
+        stamp = static_cast<unsigned int>(static_cast<unsigned long long>(
+            _clock.toRobot(_localMicros(TimingStats::Clock::now()))));
+
+        //
+        // 0 stands for no stamp
+        //
+        if (stamp == 0)
+        {
+            stamp = 1;
+        }
+    }
+
+    unsigned char *field = payload + HIRCPPacket::DATA_STAMP_OFFSET;
+    field[0] = static_cast<unsigned char>(stamp >> 3*BITS_PER_BYTE);
+    field[1] = static_cast<unsigned char>(stamp >> 2*BITS_PER_BYTE);
+    field[2] = static_cast<unsigned char>(stamp >> BITS_PER_BYTE);
+    field[3] = static_cast<unsigned char>(stamp);
+}
+
+//*****************************************************************************
+//
+//! Converts a clock reading to the microseconds the PING packets carry and
+//! the clocks are compared in.
+//!
+//! \param time the clock reading.
+//!
+//! \return Returns the microseconds since the clock's epoch.
+//
+//*****************************************************************************
+double Panel::_localMicros(TimingStats::Clock::time_point time)
+{
+    return static_cast<double>(std::chrono::duration_cast<
+        std::chrono::microseconds>(time.time_since_epoch()).count());
+}
+
+//*****************************************************************************
+//
+//! Starts recording data stream to file.
+//!
+//! \param filePath path to file to save data stream to.
+//!
+//! \return Returns \b true if recording started successfully and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::startRecording(char *filePath)
+{
+    if (_playbackStreamer->isStreaming())
+    {
+        std::cout << "[ERROR] Panel::startRecording(): Cannot record while "\
+            "streaming." << std::endl;
+        return false;
+    }
+
+    if (!_playbackRecorder->startRecording(filePath, _fpsManager.getFPS()))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Stops recording data stream and save file.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if recording stopped successfully and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::stopRecording()
+{
+    if (_playbackStreamer->isStreaming())
+    {
+        std::cout << "[ERROR] Panel::stopRecording(): Recording not started."\
+            << std::endl;
+        return false;
+    }
+
+    if (!_playbackRecorder->stopRecording())
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Starts streaming data from file.
+//!
+//! \param filePath path to file to stream data from.
+//!
+//! \return Returns \b true if streaming started successfully and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::startStreaming(char *filePath)
+{
+    if (_playbackRecorder->isRecording())
+    {
+        std::cout << "[ERROR] Panel::startStreaming(): Cannot stream while "\
+            "recording." << std::endl;
+        return false;
+    }
+
+    //
+    // Save the current FPS and start streaming with recorded FPS
+    //
+    _cachedFPS = _fpsManager.getFPS();
+    if (!_playbackStreamer->startStreaming(filePath))
+    {
+        return false;
+    }
+    _fpsManager.setFPS(_playbackStreamer->getStreamingFPS());
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Stops streaming data.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if streaming stopped successfully and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::stopStreaming()
+{
+    if (_playbackRecorder->isRecording())
+    {
+        std::cout << "[ERROR] Panel::stopStreaming(): Streaming not started."\
+            << std::endl;
+        return false;
+    }
+
+    if (!_playbackStreamer->stopStreaming())
+    {
+        return false;
+    }
+
+    //
+    // Reset FPS to cached value
+    //
+    _fpsManager.setFPS(_cachedFPS);
+    _cachedFPS = 0;
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Sets feedback mode. The MODE packet is sent by the network thread with
+//! the next pose, so the socket is only used from its thread.
+//!
+//! \param mode the FEEDBACK_MODE to set.
+//!
+//! \return Returns \b true if mode set successfully and \b false otherwise.
+//
+//*****************************************************************************
+bool Panel::setFeedbackMode(HIRCPPacket::FEEDBACK_MODE mode)
+{
+    if ((mode == HIRCPPacket::FEEDBACK_MODE::NORMAL_MODE
+        || mode == HIRCPPacket::FEEDBACK_MODE::CLOSED_LOOP_MODE
+        || mode == HIRCPPacket::FEEDBACK_MODE::HYBRID_MODE)
+        && _mode != mode)
+    {
+        _mode = mode;
+        _modePending = true;
+        return true;
+    }
+    std::cout << "[ERROR] Panel::setFeedbackMode(): Feedback mode could not "\
+        "be set!" << std::endl;
+    return false;
+}
+
+//*****************************************************************************
+//
+//! Gets the age of the pressures in the last DACK packet, when the robot
+//! was asked to report it.
+//!
+//! \param None.
+//!
+//! \return Age in microseconds, or 0 if the robot does not report it.
+//
+//*****************************************************************************
+unsigned int Panel::getFeedbackAge()
+{
+    return _feedbackAge;
+}
+
+//*****************************************************************************
+//
+//! Sets the pressure each finger holds in closed-loop feedback mode, and the
+//! most it may apply in force-limited mode. The setpoints are sent on the
+//! next frame, and again on every later connection. Synchronized by mutex.
+//!
+//! \param setpoints NUM_FINGERS pressures, thumb first, in the units of a
+//!     DACK packet. A setpoint of 0 leaves that finger's unchanged.
+//!
+//! \return Returns \b true if the setpoints were accepted and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::setForceSetpoints(const unsigned short *setpoints)
+{
+    std::lock_guard<std::mutex> lock(_forceMutex);
+    for (int i=0; i<NUM_FINGERS; i++)
+    {
+        if (setpoints[i] != 0)
+        {
+            _forceSetpoints[i] = setpoints[i];
+        }
+        else if (!_forceSetpointsSet)
+        {
+            _forceSetpoints[i] = 0;
+        }
+    }
+    _forceSetpointsSet = true;
+    _forceSetpointsPending = true;
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Gets the smoothed round-trip time to the robot, measured with PING
+//! packets. Synchronized by mutex.
+//!
+//! \param None.
+//!
+//! \return Round-trip time in microseconds, or 0 before the first PONG.
+//
+//*****************************************************************************
+double Panel::getRoundTrip()
+{
+    std::lock_guard<std::mutex> lock(_socket_mutex);
+    return _roundTrip.getSmoothed();
+}
+
+//*****************************************************************************
+//
+//! Uploads a recording to the robot and plays it there, on the robot's own
+//! timer. The upload happens on the next frame.
+//!
+//! \param filePath path to the HIRC file to play.
+//! \param loop whether playback starts over at the end of the file.
+//!
+//! \return Returns \b true if the request was accepted and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::startRobotPlayback(char *filePath, bool loop)
+{
+    if (!_connected)
+    {
+        std::cout << "[WARNING] Panel::startRobotPlayback(): Not connected."
+            << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_robotPlaybackMutex);
+    _robotFilePath = filePath;
+    _robotRequest = loop ? ROBOT_LOOP : ROBOT_PLAY;
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Pauses or resumes playback on the robot. Takes effect on the next frame.
+//!
+//! \param pause \b true to pause and \b false to resume.
+//!
+//! \return Returns \b true if the request was accepted and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::pauseRobotPlayback(bool pause)
+{
+    if (!_connected)
+    {
+        std::cout << "[WARNING] Panel::pauseRobotPlayback(): Not connected."
+            << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_robotPlaybackMutex);
+    _robotRequest = pause ? ROBOT_PAUSE : ROBOT_RESUME;
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Stops playback on the robot. Takes effect on the next frame.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if the request was accepted and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Panel::stopRobotPlayback()
+{
+    if (!_connected)
+    {
+        std::cout << "[WARNING] Panel::stopRobotPlayback(): Not connected."
+            << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_robotPlaybackMutex);
+    _robotRequest = ROBOT_STOP;
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Initializes the panel.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if the panel was initialized successfully and
+//! \b false otherwise.
+//
+//*****************************************************************************
+bool Panel::_initialize()
+{
+    int iRetVal = 0;
+
+    //
+    // Get the width and height 
+    //
+    int width, height;
+    SDL_GetWindowSize(_window, &width, &height);
+
+    //
+    // Creates renderer
+    //
+    _renderer = SDL_CreateRenderer(_window, -1, SDL_RENDERER_ACCELERATED |
+        SDL_RENDERER_TARGETTEXTURE);
+    if (_renderer == nullptr)
+    {
+        std::cerr << "[ERROR] Panel::_initialize(): SDL_CreateRenderer() "\
+            "failed. SDL Error " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    //
+    // Sets renderer to default to an Opaque black color on screen clear
+    //
+    iRetVal = SDL_SetRenderDrawColor(_renderer, 0x00, 0x00, 0x00,
+        SDL_ALPHA_OPAQUE);
+    if (iRetVal < 0)
+    {
+        std::cerr << "[ERROR] Panel::_initialize(): SDL_SetRenderDrawColor()"\
+            " failed. SDL Error " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    //
+    // Sets a device independent resolution for rendering
+    //
+    iRetVal = SDL_RenderSetLogicalSize(_renderer, width, height);
+    if (iRetVal < 0)
+    {
+        std::cerr << "[ERROR] Panel::_initialize(): "\
+            "SDL_RenderSetLogicalSize() failed. SDL Error " << SDL_GetError()
+            << std::endl;
+        return false;
+    }
+
+    //
+    // Creates hand model
+    //
+    _hand = std::unique_ptr<Hand>(new Hand(_renderer));
+
+    //
+    // Creates socket. A robot that stops answering for this long is taken as
+    // disconnected, which bounds how long the network thread can stall.
+    // The control stream uses the low-latency socket options.
+    //
+    const int NETWORK_TIMEOUT_MS = 1000;
+    _socket = std::unique_ptr<TCPSocket>(new TCPSocket());
+    _socket->setTimeout(NETWORK_TIMEOUT_MS);
+    _socket->setProfile(TCPSocket::LOW_LATENCY_PROFILE);
+
+    //
+    // Creates playback recorder and streamr
+    //
+    _playbackStreamer = std::unique_ptr<PlaybackStreamer>(
+        new PlaybackStreamer(_window));
+    _playbackRecorder = std::unique_ptr<PlaybackRecorder>(
+        new PlaybackRecorder(_window));
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Updates program logic. Called once per frame by run().
+//!
+//! \param leapData a structure containing leap data information.
+//! \param fingerPressures a structure containing finger pressure information.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_update(LeapData &leapData,
+    FingerPressureStruct &fingerPressures)
+{
+    _hand->update(leapData, fingerPressures);
+}
+
+//*****************************************************************************
+//
+//! Renders frame. Called once per frame by run().
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_render()
+{
+    //
+    // Clears screen
+    //
+    SDL_RenderClear(_renderer);
+
+    //
+    // Renders all images to screen
+    //
+    _hand->render();
+    _playbackRecorder->render();
+    _playbackStreamer->render();
+
+    //
+    // Updates screen (swaps screen buffers)
+    //
+    SDL_RenderPresent(_renderer);
+}
+
+//*****************************************************************************
+//
+//! Prints the frame timings collected since the last report and, when
+//! connected, has the network thread report the connection with its next
+//! exchange.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_reportProfile()
+{
+    const char *STAGE_NAMES[NUM_FRAME_STAGES] =
+        { "tracking", "network", "render", "frame" };
+
+    _lastProfileReport = TimingStats::Clock::now();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Controller timings (us)   count      min      avg      max"
+        << std::endl;
+    for (int i=0; i<NUM_FRAME_STAGES; i++)
+    {
+        std::cout << "  " << std::left << std::setw(22) << STAGE_NAMES[i]
+            << std::right << std::setw(7) << _frameStats[i].getCount()
+            << std::setw(9) << _frameStats[i].getMin()
+            << std::setw(9) << _frameStats[i].getAverage()
+            << std::setw(9) << _frameStats[i].getMax() << std::endl;
+        _frameStats[i].reset();
+    }
+    _mirrors.report();
+
+    if (_connected)
+    {
+        _reportPending = true;
+    }
+}
+
+//*****************************************************************************
+//
+//! Prints the exchanges with the robot connected to and the round trip and
+//! one-way latencies measured since the last report, then starts polling
+//! the robot for its own statistics. These are asked for one STATS packet
+//! an exchange and printed by _reportRobot() once all have been answered.
+//! Called from the network thread only.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_reportConnection()
+{
+    std::cout << std::fixed << std::setprecision(1);
+    {
+        std::lock_guard<std::mutex> lock(_poseMutex);
+        std::cout << "Exchanges (us)            count      min      avg"\
+            "      max" << std::endl;
+        std::cout << "  " << std::left << std::setw(22) << "DATA to DACK"
+            << std::right << std::setw(7) << _exchangeStats.getCount()
+            << std::setw(9) << _exchangeStats.getMin()
+            << std::setw(9) << _exchangeStats.getAverage()
+            << std::setw(9) << _exchangeStats.getMax() << std::endl;
+        if (_posesSkipped > 0)
+        {
+            std::cout << "  " << _posesSkipped << " poses replaced before "\
+                "being sent" << std::endl;
+        }
+        _exchangeStats.reset();
+        _posesSkipped = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(_socket_mutex);
+
+    std::cout << "Round trip (us)           count   smooth      dev     last"
+        << std::endl;
+    std::cout << "  " << std::left << std::setw(22) << "ping" << std::right
+        << std::setw(7) << _roundTrip.getCount()
+        << std::setw(9) << _roundTrip.getSmoothed()
+        << std::setw(9) << _roundTrip.getVariation()
+        << std::setw(9) << _roundTrip.getLast() << std::endl;
+    if (_pongsReceived < _pingsSent)
+    {
+        std::cout << "  " << _pingsSent - _pongsReceived << " of " <<
+            _pingsSent << " pings not answered yet" << std::endl;
+    }
+
+    //
+    // One-way latencies on the robot's clock as compared by the PINGs
+    //
+    if (_clock.isSynchronized())
+    {
+        TimingStats *ONE_WAY_STATS[] =
+            { &_uplinkStats, &_downlinkStats, &_sensorAgeStats };
+        const char *ONE_WAY_NAMES[] =
+            { "uplink (ping)", "downlink (pong)", "sensor age (DACK)" };
+        std::cout << "One-way latency (us)      count      min      "\
+            "avg      max" << std::endl;
+        for (int i=0; i<3; i++)
+        {
+            std::cout << "  " << std::left << std::setw(22) <<
+                ONE_WAY_NAMES[i] << std::right
+                << std::setw(7) << ONE_WAY_STATS[i]->getCount()
+                << std::setw(9) << ONE_WAY_STATS[i]->getMin()
+                << std::setw(9) << ONE_WAY_STATS[i]->getAverage()
+                << std::setw(9) << ONE_WAY_STATS[i]->getMax() << std::endl;
+            ONE_WAY_STATS[i]->reset();
+        }
+        std::cout << "  clock offset " << _clock.getOffset() << " us, "\
+            "drift " << _clock.getDriftPpm() << " ppm, within " <<
+            _clock.getError() << " us" << std::endl;
+    }
+
+    //
+    // A round the robot left unanswered is given up on
+    //
+    if (_statsNext < _statsEnd)
+    {
+        std::cout << "[WARNING] Panel::_reportConnection(): Robot answered " <<
+            _statsNext << " of " << _statsEnd << " STATS packets." <<
+            std::endl;
+    }
+    _statsNext = 0;
+    _statsEnd = _stampedData ? NUM_STATS_REPLIES : NUM_STATS_REPLIES-1;
+    _statsAwaiting = false;
+}
+
+//*****************************************************************************
+//
+//! Sends the next STATS packet of the round _reportConnection() started, once
+//! the last has been answered. The replies are taken in by _recvPacket() and
+//! _drainReplies() along with the frame's DACK, so polling never waits on
+//! the robot. Synchronized by mutex.
+//!
+//! \param None.
+//!
+//! \return Returns \b false if the connection failed and \b true otherwise.
+//
+//*****************************************************************************
+bool Panel::_sendStats()
+{
+    std::lock_guard<std::mutex> lock(_socket_mutex);
+    if (_statsAwaiting || _statsNext >= _statsEnd)
+    {
+        return true;
+    }
+
+    //
+    // The profile sections come first, then playback and latency
+    //
+    HIRCPPacket statsPacket = (_statsNext < HIRCPPacket::NUM_PROFILE_SECTIONS) ?
+        HIRCPPacket::createSTATSPacket(HIRCPPacket::PROFILE_STATS,
+        static_cast<unsigned char>(_statsNext)) :
+        (_statsNext == HIRCPPacket::NUM_PROFILE_SECTIONS) ?
+        HIRCPPacket::createSTATSPacket(HIRCPPacket::PLAYBACK_STATS) :
+        HIRCPPacket::createSTATSPacket(HIRCPPacket::LATENCY_STATS);
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    statsPacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+    if (!_socket->send(message, HIRCPPacket::MAX_PACKET_SIZE))
+    {
+        std::cout << "[ERROR] Panel::_sendStats(): Send failed." << std::endl;
+        return false;
+    }
+    _statsAwaiting = true;
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Keeps the answer to the STATS packet last sent. STATS packets nothing
+//! was asked for are ignored. The caller holds the socket mutex.
+//!
+//! \param message the STATS packet, HIRCPPacket::MAX_PACKET_SIZE bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_recordStats(const unsigned char *message)
+{
+    if (!_statsAwaiting)
+    {
+        return;
+    }
+
+    const unsigned char *payload = message + HIRCPPacket::HIRCP_CONSTANT_LEN +
+        HIRCPPacket::OPCODE_LEN;
+    std::copy(payload, payload+HIRCPPacket::MAX_PAYLOAD_LEN,
+        _statsReplies[_statsNext]);
+    _statsAwaiting = false;
+    _statsNext++;
+}
+
+//*****************************************************************************
+//
+//! Prints the robot's statistics once every STATS packet of the round has
+//! been answered. Synchronized by mutex.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Panel::_reportRobot()
+{
+    const char *SECTION_NAMES[HIRCPPacket::NUM_PROFILE_SECTIONS] =
+        { "receive", "parse", "servo", "i2c", "adc", "send" };
+    const double UNIT_US = HIRCPPacket::PROFILE_UNIT_NS/1000.0;
+    const int BITS_PER_BYTE = 8;
+
+    unsigned char replies[NUM_STATS_REPLIES][HIRCPPacket::MAX_PAYLOAD_LEN];
+    int replied;
+    {
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+        if (_statsEnd == 0 || _statsNext < _statsEnd)
+        {
+            return;
+        }
+        replied = _statsEnd;
+        std::copy(&_statsReplies[0][0], &_statsReplies[0][0] +
+            replied*HIRCPPacket::MAX_PAYLOAD_LEN, &replies[0][0]);
+        _statsNext = 0;
+        _statsEnd = 0;
     }
 
-    if (!_playbackRecorder->startRecording(filePath, _fpsManager.getFPS()))
+    //
+    // The robot's statistics cover the whole connection
+    //
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Robot timings (us)        count      min      avg      max"
+        << std::endl;
+    for (int i=0; i<HIRCPPacket::NUM_PROFILE_SECTIONS; i++)
     {
-        return false;
+        unsigned char *payload = replies[i];
+        if (payload[0] != i)
+        {
+            continue;
+        }
+
+        unsigned int count = (payload[1] << BITS_PER_BYTE) | payload[2];
+        unsigned int min = (payload[3] << BITS_PER_BYTE) | payload[4];
+        unsigned int avg = (payload[5] << BITS_PER_BYTE) | payload[6];
+        unsigned int max = (payload[7] << 2*BITS_PER_BYTE) |
+            (payload[8] << BITS_PER_BYTE) | payload[9];
+        std::cout << "  " << std::left << std::setw(22) << SECTION_NAMES[i]
+            << std::right << std::setw(7) << count
+            << std::setw(9) << min*UNIT_US
+            << std::setw(9) << avg*UNIT_US
+            << std::setw(9) << max*UNIT_US << std::endl;
     }
 
-    return true;
+    _reportPlayback(replies[HIRCPPacket::NUM_PROFILE_SECTIONS]);
+
+    if (replied > HIRCPPacket::NUM_PROFILE_SECTIONS+1)
+    {
+        _reportLatency(replies[HIRCPPacket::NUM_PROFILE_SECTIONS+1]);
+    }
 }
 
 //*****************************************************************************
 //
-//! Stops recording data stream and save file.
+//! Prints how the robot is playing back DATA packets: its buffer depth and
+//! delay, and how often the next pose was late or had to be discarded.
 //!
-//! \param None.
+//! \param payload the payload of a playback STATS packet.
 //!
-//! \return Returns \b true if recording stopped successfully and \b false
-//! otherwise.
+//! \return None.
 //
 //*****************************************************************************
-bool Panel::stopRecording()
+void Panel::_reportPlayback(const unsigned char *payload)
 {
-    if (_playbackStreamer->isStreaming())
-    {
-        std::cout << "[ERROR] Panel::stopRecording(): Recording not started."\
-            << std::endl;
-        return false;
-    }
-
-    if (!_playbackRecorder->stopRecording())
-    {
-        return false;
-    }
+    const int BITS_PER_BYTE = 8;
 
-    return true;
+    unsigned int underruns = (payload[0] << BITS_PER_BYTE) | payload[1];
+    unsigned int overruns = (payload[2] << BITS_PER_BYTE) | payload[3];
+    unsigned int target = payload[4];
+    unsigned int depth = payload[5];
+    unsigned int jitter = (payload[6] << BITS_PER_BYTE) | payload[7];
+    unsigned int delay = (payload[8] << BITS_PER_BYTE) | payload[9];
+
+    std::cout << "Robot playback            depth   target   jitter    delay"
+        << std::endl;
+    std::cout << "  " << std::left << std::setw(22) << "jitter buffer (us)"
+        << std::right << std::setw(7) << depth
+        << std::setw(9) << target*HIRCPPacket::PLAYBACK_PERIOD_US
+        << std::setw(9) << jitter*HIRCPPacket::PLAYBACK_UNIT_US
+        << std::setw(9) << delay*HIRCPPacket::PLAYBACK_UNIT_US << std::endl;
+    std::cout << "  " << underruns << " underruns, " << overruns <<
+        " overruns" << std::endl;
 }
 
 //*****************************************************************************
 //
-//! Starts streaming data from file.
+//! Prints the one-way latency of stamped DATA packets as the robot measured
+//! it, and how long the robot held the poses before applying them.
 //!
-//! \param filePath path to file to stream data from.
+//! \param payload the payload of a latency STATS packet.
 //!
-//! \return Returns \b true if streaming started successfully and \b false
-//! otherwise.
+//! \return None.
 //
 //*****************************************************************************
-bool Panel::startStreaming(char *filePath)
+void Panel::_reportLatency(const unsigned char *payload)
 {
-    if (_playbackRecorder->isRecording())
-    {
-        std::cout << "[ERROR] Panel::startStreaming(): Cannot stream while "\
-            "recording." << std::endl;
-        return false;
-    }
+    const int BITS_PER_BYTE = 8;
 
     //
-    // Save the current FPS and start streaming with recorded FPS
+    // The latencies are signed, as a poor clock estimate can make them
+    // negative
     //
-    _cachedFPS = _fpsManager.getFPS();
-    if (!_playbackStreamer->startStreaming(filePath))
+    int field[5];
+    for (int i=0; i<5; i++)
     {
-        return false;
+        field[i] = (payload[2*i] << BITS_PER_BYTE) | payload[2*i + 1];
+    }
+    for (int i=1; i<4; i++)
+    {
+        field[i] = static_cast<short>(field[i]);
     }
-    _fpsManager.setFPS(_playbackStreamer->getStreamingFPS());
 
-    return true;
+    std::cout << "Robot latency (us)        count      min      avg      max"
+        << std::endl;
+    std::cout << "  " << std::left << std::setw(22) << "uplink (DATA)"
+        << std::right << std::setw(7) << field[0]
+        << std::setw(9) << field[1]*HIRCPPacket::LATENCY_UNIT_US
+        << std::setw(9) << field[2]*HIRCPPacket::LATENCY_UNIT_US
+        << std::setw(9) << field[3]*HIRCPPacket::LATENCY_UNIT_US << std::endl;
+    std::cout << "  " << std::left << std::setw(22) << "hold before apply"
+        << std::right << std::setw(7) << "" << std::setw(9) << ""
+        << std::setw(9) << field[4]*HIRCPPacket::LATENCY_UNIT_US << std::endl;
 }
 
 //*****************************************************************************
 //
-//! Stops streaming data.
+//! Sends the force setpoints in an FSET packet if they were given since
+//! they were last sent.
 //!
 //! \param None.
 //!
-//! \return Returns \b true if streaming stopped successfully and \b false
-//! otherwise.
+//! \return Returns \b false if the connection failed and \b true otherwise.
 //
 //*****************************************************************************
-bool Panel::stopStreaming()
+bool Panel::_sendForceSetpoints()
 {
-    if (_playbackRecorder->isRecording())
-    {
-        std::cout << "[ERROR] Panel::stopStreaming(): Streaming not started."\
-            << std::endl;
-        return false;
-    }
-
-    if (!_playbackStreamer->stopStreaming())
+    unsigned short setpoints[NUM_FINGERS];
     {
-        return false;
+        std::lock_guard<std::mutex> lock(_forceMutex);
+        if (!_forceSetpointsPending)
+        {
+            return true;
+        }
+        std::copy(_forceSetpoints, _forceSetpoints+NUM_FINGERS, setpoints);
+        _forceSetpointsPending = false;
     }
 
-    //
-    // Reset FPS to cached value
-    //
-    _fpsManager.setFPS(_cachedFPS);
-    _cachedFPS = 0;
-
-    return true;
+    HIRCPPacket fsetPacket = HIRCPPacket::createFSETPacket(setpoints,
+        NUM_FINGERS);
+    return send(fsetPacket);
 }
 
 //*****************************************************************************
 //
-//! Sets feedback mode.
+//! Carries out the pending robot playback request, then polls the robot
+//! for its progress while a trajectory is playing. Notifies
+//! EVENT_STOP_ROBOT_PLAYBACK when playback ends on its own and
+//! EVENT_ROBOT_PLAYBACK_FAILED when the robot refuses a request.
 //!
-//! \param mode the FEEDBACK_MODE to set.
+//! \param None.
 //!
-//! \return Returns \b true if mode set successfully and \b false otherwise.
+//! \return Returns \b false if the connection failed and \b true otherwise.
 //
 //*****************************************************************************
-bool Panel::setFeedbackMode(HIRCPPacket::FEEDBACK_MODE mode)
+bool Panel::_serviceRobotPlayback()
 {
-    if (mode == HIRCPPacket::FEEDBACK_MODE::NORMAL_MODE
-        && _mode != HIRCPPacket::FEEDBACK_MODE::NORMAL_MODE)
+    const int STATUS_PERIOD_MS = 500;
+    const int BITS_PER_BYTE = 8;
+
+    ROBOT_PLAYBACK_REQUEST request;
+    std::string filePath;
     {
-        if (_connected)
+        std::lock_guard<std::mutex> lock(_robotPlaybackMutex);
+        request = _robotRequest;
+        filePath = _robotFilePath;
+        _robotRequest = ROBOT_NONE;
+    }
+
+    unsigned char reply[HIRCPPacket::MAX_PAYLOAD_LEN] = {0};
+    bool ok = true;
+
+    switch (request)
+    {
+    case ROBOT_PLAY:
+    case ROBOT_LOOP:
+    {
+        bool uploaded = false;
+        if (!_uploadTrajectory(filePath, uploaded))
         {
-            HIRCPPacket modePacket = HIRCPPacket::createMODEPacket(mode);
-            if (!send(modePacket))
-            {
-                _socket->close();
-                _connected = false;
-                notify(EVENT_DISCONNECTED);
-                return false;
-            }
+            return false;
         }
-        _mode = HIRCPPacket::FEEDBACK_MODE::NORMAL_MODE;
-        return true;
+        if (!uploaded)
+        {
+            ok = false;
+            break;
+        }
+
+        _robotLoop = (request == ROBOT_LOOP);
+        HIRCPPacket playPacket = HIRCPPacket::createTRAJPlayPacket(
+            _robotLoop);
+        if (!_sendTrajectoryCommand(playPacket, reply))
+        {
+            return false;
+        }
+        ok = (reply[1] == HIRCPPacket::TRAJ_OK);
+        break;
     }
-    else if (mode == HIRCPPacket::FEEDBACK_MODE::CLOSED_LOOP_MODE
-        && _mode != HIRCPPacket::FEEDBACK_MODE::CLOSED_LOOP_MODE)
+    case ROBOT_PAUSE:
+    case ROBOT_RESUME:
+    case ROBOT_STOP:
     {
-        if (_connected)
+        //
+        // Resuming keeps the loop setting playback was started with
+        //
+        HIRCPPacket commandPacket = (request == ROBOT_PAUSE) ?
+            HIRCPPacket::createTRAJPacket(HIRCPPacket::TRAJ_PAUSE) :
+            (request == ROBOT_RESUME) ?
+            HIRCPPacket::createTRAJPlayPacket(_robotLoop) :
+            HIRCPPacket::createTRAJPacket(HIRCPPacket::TRAJ_STOP);
+        if (!_sendTrajectoryCommand(commandPacket, reply))
         {
-            HIRCPPacket modePacket = HIRCPPacket::createMODEPacket(mode);
-            if (!send(modePacket))
-            {
-                _socket->close();
-                _connected = false;
-                notify(EVENT_DISCONNECTED);
-                return false;
-            }
+            return false;
         }
-        _mode = HIRCPPacket::FEEDBACK_MODE::CLOSED_LOOP_MODE;
+        ok = (reply[1] == HIRCPPacket::TRAJ_OK);
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (!ok)
+    {
+        std::cout << "[ERROR] Panel::_serviceRobotPlayback(): Playback "\
+            "request failed (result " << static_cast<unsigned int>(reply[1])
+            << ")." << std::endl;
+        notify(EVENT_ROBOT_PLAYBACK_FAILED);
         return true;
     }
-    std::cout << "[ERROR] Panel::setFeedbackMode(): Feedback mode could not "\
-        "be set!" << std::endl;
-    return false;
+
+    //
+    // Monitors progress while the robot owns the hand
+    //
+    if ((_robotState != HIRCPPacket::TRAJ_PLAYING &&
+        _robotState != HIRCPPacket::TRAJ_PAUSED) ||
+        (TimingStats::Clock::now() - _lastRobotStatus <
+        std::chrono::milliseconds(STATUS_PERIOD_MS)))
+    {
+        return true;
+    }
+    _lastRobotStatus = TimingStats::Clock::now();
+
+    HIRCPPacket statusPacket = HIRCPPacket::createTRAJPacket(
+        HIRCPPacket::TRAJ_STATUS);
+    if (!_sendTrajectoryCommand(statusPacket, reply))
+    {
+        return false;
+    }
+
+    unsigned int frame = (reply[3] << BITS_PER_BYTE) | reply[4];
+    unsigned int frames = (reply[5] << BITS_PER_BYTE) | reply[6];
+    unsigned int loops = (reply[7] << BITS_PER_BYTE) | reply[8];
+    std::cout << "[NOTICE] Panel::_serviceRobotPlayback(): Robot playing "\
+        "frame " << frame+1 << " of " << frames << ", loop " << loops+1 <<
+        "." << std::endl;
+
+    if (_robotState == HIRCPPacket::TRAJ_READY)
+    {
+        notify(EVENT_STOP_ROBOT_PLAYBACK);
+    }
+
+    return true;
 }
 
 //*****************************************************************************
 //
-//! Initializes the panel.
+//! Uploads an HIRC file to the robot. Frames are sent in chunks of one
+//! frame each, then the robot checks the whole trajectory against its
+//! checksum.
 //!
-//! \param None.
+//! \param filePath path to the HIRC file.
+//! \param uploaded set to \b true if the robot holds the trajectory.
 //!
-//! \return Returns \b true if the panel was initialized successfully and
-//! \b false otherwise.
+//! \return Returns \b false if the connection failed and \b true otherwise.
 //
 //*****************************************************************************
-bool Panel::_initialize()
+bool Panel::_uploadTrajectory(const std::string &filePath, bool &uploaded)
 {
-    int iRetVal = 0;
+    const int CHUNKS_PER_SEND = 64;
 
-    //
-    // Get the width and height 
-    //
-    int width, height;
-    SDL_GetWindowSize(_window, &width, &height);
+    uploaded = false;
 
     //
-    // Creates renderer
+    // Reads the header and every frame of the file
     //
-    _renderer = SDL_CreateRenderer(_window, -1, SDL_RENDERER_ACCELERATED |
-        SDL_RENDERER_TARGETTEXTURE);
-    if (_renderer == nullptr)
+    std::ifstream file(filePath, std::ifstream::binary);
+    char hircBuf[HIRCPPacket::HIRCP_CONSTANT_LEN];
+    char fps = 0;
+    file.read(hircBuf, HIRCPPacket::HIRCP_CONSTANT_LEN);
+    file.read(&fps, 1);
+    if (!file || std::string(hircBuf, HIRCPPacket::HIRCP_CONSTANT_LEN) !=
+        HIRCPPacket::HIRCP_CONSTANT_STRING)
     {
-        std::cerr << "[ERROR] Panel::_initialize(): SDL_CreateRenderer() "\
-            "failed. SDL Error " << SDL_GetError() << std::endl;
-        return false;
+        std::cout << "[ERROR] Panel::_uploadTrajectory(): Not an HIRC file!"
+            << std::endl;
+        return true;
     }
 
-    //
-    // Sets renderer to default to an Opaque black color on screen clear
-    //
-    iRetVal = SDL_SetRenderDrawColor(_renderer, 0x00, 0x00, 0x00,
-        SDL_ALPHA_OPAQUE);
-    if (iRetVal < 0)
+    std::vector<unsigned char> frames;
+    char frameBuf[HIRCPPacket::TRAJ_FRAME_LEN];
+    while (file.read(frameBuf, HIRCPPacket::TRAJ_FRAME_LEN))
     {
-        std::cerr << "[ERROR] Panel::_initialize(): SDL_SetRenderDrawColor()"\
-            " failed. SDL Error " << SDL_GetError() << std::endl;
-        return false;
+        frames.insert(frames.end(), frameBuf,
+            frameBuf+HIRCPPacket::TRAJ_FRAME_LEN);
+    }
+    int numFrames = static_cast<int>(frames.size())/
+        HIRCPPacket::TRAJ_FRAME_LEN;
+    if (numFrames == 0 || numFrames > HIRCPPacket::TRAJ_MAX_FRAMES)
+    {
+        std::cout << "[ERROR] Panel::_uploadTrajectory(): File has " <<
+            numFrames << " frames, the robot holds 1 to " <<
+            HIRCPPacket::TRAJ_MAX_FRAMES << "." << std::endl;
+        return true;
     }
 
     //
-    // Sets a device independent resolution for rendering
+    // Ends any playback in progress, which would refuse the upload
     //
-    iRetVal = SDL_RenderSetLogicalSize(_renderer, width, height);
-    if (iRetVal < 0)
+    unsigned char reply[HIRCPPacket::MAX_PAYLOAD_LEN];
+    HIRCPPacket stopPacket = HIRCPPacket::createTRAJPacket(
+        HIRCPPacket::TRAJ_STOP);
+    HIRCPPacket beginPacket = HIRCPPacket::createTRAJBeginPacket(
+        static_cast<unsigned char>(fps), numFrames);
+    if (!_sendTrajectoryCommand(stopPacket, reply) ||
+        !_sendTrajectoryCommand(beginPacket, reply))
     {
-        std::cerr << "[ERROR] Panel::_initialize(): "\
-            "SDL_RenderSetLogicalSize() failed. SDL Error " << SDL_GetError()
-            << std::endl;
         return false;
     }
+    if (reply[1] != HIRCPPacket::TRAJ_OK)
+    {
+        return true;
+    }
 
     //
-    // Creates hand model
+    // Chunks are not answered, so they are sent back to back
     //
-    _hand = std::unique_ptr<Hand>(new Hand(_renderer));
+    for (int first=0; first<numFrames; first+=CHUNKS_PER_SEND)
+    {
+        unsigned char message[CHUNKS_PER_SEND*HIRCPPacket::MAX_PACKET_SIZE];
+        int len = 0;
+        for (int i=first; i<numFrames && i<first+CHUNKS_PER_SEND; i++)
+        {
+            HIRCPPacket chunkPacket = HIRCPPacket::createTRAJChunkPacket(i,
+                &frames[i*HIRCPPacket::TRAJ_FRAME_LEN]);
+            chunkPacket.getData(message+len, HIRCPPacket::MAX_PACKET_SIZE);
+            len += HIRCPPacket::MAX_PACKET_SIZE;
+        }
 
-    //
-    // Creates socket
-    //
-    _socket = std::unique_ptr<TCPSocket>(new TCPSocket());
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+        if (!_socket->send(message, static_cast<unsigned short>(len)))
+        {
+            std::cout << "[ERROR] Panel::_uploadTrajectory(): Send failed."
+                << std::endl;
+            return false;
+        }
+    }
 
-    //
-    // Creates playback recorder and streamr
-    //
-    _playbackStreamer = std::unique_ptr<PlaybackStreamer>(
-        new PlaybackStreamer(_window));
-    _playbackRecorder = std::unique_ptr<PlaybackRecorder>(
-        new PlaybackRecorder(_window));
+    HIRCPPacket endPacket = HIRCPPacket::createTRAJEndPacket(
+        HIRCPPacket::trajectoryChecksum(frames.data(),
+        static_cast<int>(frames.size())));
+    if (!_sendTrajectoryCommand(endPacket, reply))
+    {
+        return false;
+    }
+
+    uploaded = (reply[1] == HIRCPPacket::TRAJ_OK);
+    std::cout << "[NOTICE] Panel::_uploadTrajectory(): Uploaded " <<
+        numFrames << " frames at " << static_cast<int>(fps) << " fps, result "
+        << static_cast<unsigned int>(reply[1]) << "." << std::endl;
 
     return true;
 }
 
 //*****************************************************************************
 //
-//! Updates program logic. Called once per frame by run().
+//! Sends a TRAJ packet and waits for the robot's answer to it. Replies to
+//! packets sent earlier from other threads are skipped.
 //!
-//! \param leapData a structure containing leap data information.
-//! \param fingerPressures a structure containing finger pressure information.
+//! \param packet TRAJ packet to send.
+//! \param reply buffer of MAX_PAYLOAD_LEN bytes to store the answer.
 //!
-//! \return None.
+//! \return Returns \b false if the connection failed and \b true otherwise.
 //
 //*****************************************************************************
-void Panel::_update(LeapData &leapData,
-    FingerPressureStruct &fingerPressures)
+bool Panel::_sendTrajectoryCommand(HIRCPPacket &packet, unsigned char *reply)
 {
-    _hand->update(leapData, fingerPressures);
-}
+    const int MAX_SKIPPED = 4;
 
-//*****************************************************************************
-//
-//! Renders frame. Called once per frame by run().
-//!
-//! \param None.
-//!
-//! \return None.
-//
-//*****************************************************************************
-void Panel::_render()
-{
-    //
-    // Clears screen
-    //
-    SDL_RenderClear(_renderer);
+    unsigned char payload[HIRCPPacket::MAX_PAYLOAD_LEN];
+    packet.getPayload(payload, HIRCPPacket::MAX_PAYLOAD_LEN);
 
-    //
-    // Renders all images to screen
-    //
-    _hand->render();
-    _playbackRecorder->render();
-    _playbackStreamer->render();
+    if (!send(packet))
+    {
+        return false;
+    }
 
-    //
-    // Updates screen (swaps screen buffers)
-    //
-    SDL_RenderPresent(_renderer);
+    for (int i=0; i<=MAX_SKIPPED; i++)
+    {
+        HIRCPPacket replyPacket = HIRCPPacket::createEmptyPacket();
+        if (!recv(replyPacket))
+        {
+            return false;
+        }
+
+        replyPacket.getPayload(reply, HIRCPPacket::MAX_PAYLOAD_LEN);
+        if (replyPacket.isValid() &&
+            (replyPacket.getType() == HIRCPPacket::TRAJ) &&
+            (reply[0] == payload[0]))
+        {
+            _robotState = static_cast<HIRCPPacket::TRAJ_STATE>(reply[2]);
+            return true;
+        }
+    }
+
+    std::cout << "[ERROR] Panel::_sendTrajectoryCommand(): No answer from "\
+        "robot." << std::endl;
+    return false;
 }
 
 //*****************************************************************************
@@ -802,46 +2562,28 @@ void Panel::_render()
 bool Panel::_populateFingerPressureStruct(FingerPressureStruct
     &fingerPressures, HIRCPPacket packet)
 {
-    const int BITS_PER_BYTE = 8;
-    //const int MIN_ENCODED_PRESSURE = 800;
-    const int MAX_ENCODED_PRESSURE[NUM_FINGERS] =
-        { 1020, 800, 930, 1030, 990 };
-    const float SENSOR_SCALING = 3.05;
-
     //
     // Buffer needs to be at least this size
     //
-    int pressureSize = sizeof(unsigned short);
     const unsigned int buflen = packet.MAX_PAYLOAD_LEN;
     unsigned char buf[buflen];
     packet.getPayload(buf, buflen);
-    assert(buflen >= (unsigned int)pressureSize*NUM_FINGERS);
+    assert(buflen >= (unsigned int)sizeof(unsigned short)*NUM_FINGERS);
 
-    //
-    // Parses through buf and populate structure
-    //
-    unsigned int bufIndex = 0;
-    for (int i=0; i<NUM_FINGERS; i++)
+    unsigned int age = FrameKernels::decodeFingerPressures(buf, _timedDack,
+        fingerPressures.pressure);
+    if (_timedDack)
     {
-        unsigned short encodedPressure = 0;
-        encodedPressure += buf[bufIndex++];
-        encodedPressure <<= BITS_PER_BYTE;
-        encodedPressure += buf[bufIndex++];
-        assert((encodedPressure >= 0) && (encodedPressure <= 4096));
-		
-        // Setting encodedPressure if limit exceeded
-        if (encodedPressure > MAX_ENCODED_PRESSURE[i])
-        {
-            encodedPressure = MAX_ENCODED_PRESSURE[i];
-        }
-        double multiplier = (double)(log10((double)(MAX_ENCODED_PRESSURE[i]
-            - encodedPressure + 1))) / SENSOR_SCALING;
-
-        fingerPressures.pressure[i] =
-            static_cast<unsigned char>(multiplier*255);
-        /*std::cout << "pressure = "
-            << static_cast<unsigned int>(fingerPressures.pressure[i])
-            << std::endl;*/
+        _feedbackAge = age;
+
+        //
+        // The pressures are older still by the time they arrive
+        //
+        std::lock_guard<std::mutex> lock(_socket_mutex);
+        if (_clock.isSynchronized())
+        {
+            _sensorAgeStats.add(age + _clock.getDownlink());
+        }
     }
 
     return true;
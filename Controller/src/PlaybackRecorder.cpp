@@ -21,6 +21,7 @@
 
 #include <SDL_ttf.h>
 
+#include "FrameKernels.h"
 #include "Window.h"
 
 //*****************************************************************************
@@ -252,17 +253,10 @@ void PlaybackRecorder::update(LeapData &leapData)
     }
 
     //
-    // Appends finger rotation data to file
+    // Appends finger and wrist rotation data to file
     //
-    for (int i=0; i<NUM_FINGERS; i++)
-    {
-        _file << leapData.totalAngle[i];
-    }
-
-    //
-    // Appends wrist rotation data to file
-    //
-    _file << leapData.wristAngle;
+    FrameKernels::writeHIRCFrame(_file, leapData.totalAngle,
+        leapData.wristAngle);
 }
 
 //*****************************************************************************
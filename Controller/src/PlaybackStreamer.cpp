@@ -21,6 +21,7 @@
 
 #include <SDL_ttf.h>
 
+#include "FrameKernels.h"
 #include "Window.h"
 
 //*****************************************************************************
@@ -261,13 +262,13 @@ void PlaybackStreamer::update(LeapData &leapData)
         return;
     }
 
-    char angleData[NUM_FINGERS+1]; // NUM_FINGERS + WRIST
-    _file.read(angleData, NUM_FINGERS+1);
+    unsigned char totalAngle[NUM_FINGERS];
+    unsigned char wristAngle;
 
     //
     // File streaming complete
     //
-    if (_file.rdstate() & std::fstream::eofbit)
+    if (!FrameKernels::readHIRCFrame(_file, totalAngle, wristAngle))
     {
         notify(EVENT_STOP_STREAMING);
         return;
@@ -294,12 +295,11 @@ void PlaybackStreamer::update(LeapData &leapData)
     //
     // Updates struct with recorded data for playback streaming
     //
-    int i;
-    for (i=0; i<NUM_FINGERS; i++)
+    for (int i=0; i<NUM_FINGERS; i++)
     {
-        leapData.totalAngle[i] = angleData[i];
+        leapData.totalAngle[i] = totalAngle[i];
     }
-    leapData.wristAngle = angleData[i];
+    leapData.wristAngle = wristAngle;
 }
 
 //*****************************************************************************
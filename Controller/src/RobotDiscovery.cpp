@@ -0,0 +1,315 @@
+//*****************************************************************************
+//
+// RobotDiscovery.cpp
+//
+// Keeps a table of the robots on the local network. A background thread
+// listens for the BEACON packets every robot broadcasts, so the robots are
+// known before the user asks to connect.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "RobotDiscovery.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "EventLoop.h"
+
+//*****************************************************************************
+//
+//! Constructor for RobotDiscovery. Nothing is received until start() is
+//! called.
+//!
+//! \param port the UDP port the beacons are sent to.
+//!
+//! \return None.
+//
+//*****************************************************************************
+RobotDiscovery::RobotDiscovery(unsigned short port) : _port(port),
+    _sockfd(0), _running(false)
+{
+
+}
+
+//*****************************************************************************
+//
+//! Destructor for RobotDiscovery. Stops the background thread.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+RobotDiscovery::~RobotDiscovery()
+{
+    stop();
+}
+
+//*****************************************************************************
+//
+//! Opens the beacon socket and starts listening in a background thread.
+//! The socket API must already be initialized.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if the listener was started and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool RobotDiscovery::start()
+{
+    if (_running)
+    {
+        return true;
+    }
+
+    if ((_sockfd = socket(AF_INET, SOCK_DGRAM, 0)) == -1)
+    {
+        _sockfd = 0;
+        std::cerr << "[ERROR] RobotDiscovery::start(): Socket could not be "\
+            "opened." << std::endl;
+        return false;
+    }
+
+    //
+    // Lets other listeners on this computer receive the beacons as well
+    //
+    int reuse = 1;
+    setsockopt(_sockfd, SOL_SOCKET, SO_REUSEADDR, (char*)&reuse,
+        sizeof(reuse));
+
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(_port);
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(_sockfd, (struct sockaddr*)&address, sizeof(address)) != 0)
+    {
+        std::cerr << "[ERROR] RobotDiscovery::start(): Could not listen on "\
+            "port " << _port << "." << std::endl;
+        _close();
+        return false;
+    }
+
+    if (!network::setNonBlocking(_sockfd, true))
+    {
+        std::cerr << "[ERROR] RobotDiscovery::start(): Socket could not be "\
+            "set to non-blocking mode." << std::endl;
+        _close();
+        return false;
+    }
+
+    _running = true;
+    _thread = std::thread(&RobotDiscovery::_listen, this);
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Stops the background thread and closes the beacon socket. Returns
+//! within POLL_MS.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotDiscovery::stop()
+{
+    _running = false;
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+    _close();
+}
+
+//*****************************************************************************
+//
+//! Gets the robots heard from within EXPIRY_MS. Idle robots come before
+//! busy ones, and robots otherwise in order of their IDs.
+//!
+//! \param None.
+//!
+//! \return Returns the robots.
+//
+//*****************************************************************************
+std::vector<RobotDiscovery::Robot> RobotDiscovery::getRobots()
+{
+    std::vector<Robot> robots;
+    Clock::time_point expired = Clock::now() -
+        std::chrono::milliseconds(EXPIRY_MS);
+
+    {
+        std::lock_guard<std::mutex> lock(_robots_mutex);
+        std::map<unsigned short, Robot>::iterator it = _robots.begin();
+        while (it != _robots.end())
+        {
+            if (it->second.lastSeen < expired)
+            {
+                it = _robots.erase(it);
+                continue;
+            }
+            robots.push_back(it->second);
+            ++it;
+        }
+    }
+
+    //
+    // The map already orders robots by ID
+    //
+    std::stable_sort(robots.begin(), robots.end(),
+        [](const Robot &a, const Robot &b)
+        {
+            return !(a.capabilities & HIRCPPacket::CAPABILITY_BUSY) &&
+                (b.capabilities & HIRCPPacket::CAPABILITY_BUSY);
+        });
+
+    return robots;
+}
+
+//*****************************************************************************
+//
+//! Background thread. Receives beacons until stop() is called.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotDiscovery::_listen()
+{
+    while (_running)
+    {
+        //
+        // Wakes up now and then to notice stop()
+        //
+        int events = EventLoop::wait(_sockfd, EventLoop::EVENT_READ, POLL_MS);
+        if (events > 0)
+        {
+            _receive();
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Reads every waiting datagram and records the robots they come from.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotDiscovery::_receive()
+{
+    //
+    // Room for one byte more than a beacon, to notice longer datagrams
+    //
+    unsigned char datagram[HIRCPPacket::MAX_PACKET_SIZE+1];
+
+    while (true)
+    {
+        struct sockaddr_in source;
+        socklen_t sourceLen = sizeof(source);
+        int len = static_cast<int>(recvfrom(_sockfd, (char*)datagram,
+            sizeof(datagram), 0, (struct sockaddr*)&source, &sourceLen));
+        if (len < 0)
+        {
+            return;
+        }
+
+        Robot robot;
+        if (!_parse(datagram, len, ntohl(source.sin_addr.s_addr), robot))
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(_robots_mutex);
+        _robots[robot.id] = robot;
+    }
+}
+
+//*****************************************************************************
+//
+//! Closes the beacon socket.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotDiscovery::_close()
+{
+    if (_sockfd == 0)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    closesocket(_sockfd);
+#elif __unix__
+    ::close(_sockfd);
+#endif
+    _sockfd = 0;
+}
+
+//*****************************************************************************
+//
+//! Decodes a BEACON packet (see hircp_specifications_rev2.txt, Section 3.9).
+//!
+//! \param datagram the datagram received.
+//! \param len the length of the datagram.
+//! \param source the address it came from, in host byte order.
+//! \param robot receives the robot it describes.
+//!
+//! \return Returns \b true if the datagram is a beacon and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool RobotDiscovery::_parse(unsigned char *datagram, int len,
+    unsigned int source, Robot &robot)
+{
+    if (len != HIRCPPacket::MAX_PACKET_SIZE)
+    {
+        return false;
+    }
+
+    HIRCPPacket packet = HIRCPPacket::createEmptyPacket();
+    packet.populate(datagram, len);
+    if (packet.getType() != HIRCPPacket::BEACON)
+    {
+        return false;
+    }
+
+    unsigned char payload[HIRCPPacket::MAX_PAYLOAD_LEN];
+    packet.getPayload(payload, HIRCPPacket::MAX_PAYLOAD_LEN);
+    if (payload[0] != HIRCPPacket::BEACON_VERSION)
+    {
+        return false;
+    }
+
+    robot.id = static_cast<unsigned short>((payload[1] << 8) | payload[2]);
+    robot.address = (static_cast<unsigned int>(payload[3]) << 24) |
+        (payload[4] << 16) | (payload[5] << 8) | payload[6];
+    robot.port = static_cast<unsigned short>((payload[7] << 8) | payload[8]);
+    robot.capabilities = payload[9];
+    robot.lastSeen = Clock::now();
+
+    //
+    // A robot that does not know its address is where the beacon came from
+    //
+    if (robot.address == 0)
+    {
+        robot.address = source;
+    }
+
+    return true;
+}
@@ -0,0 +1,419 @@
+//*****************************************************************************
+//
+// RobotSet.cpp
+//
+// Class that mirrors the controller's poses to a set of robots. Each pose is
+// encoded once and the same DATA packet is sent to every robot; a robot still
+// to answer the previous one is skipped rather than waited for, so a slow
+// robot never holds up the others.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "RobotSet.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+//*****************************************************************************
+//
+//! Constructor for RobotSet. Starts with no robots.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+RobotSet::RobotSet()
+{
+
+}
+
+//*****************************************************************************
+//
+//! Destructor for RobotSet. Disconnects from every robot.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+RobotSet::~RobotSet()
+{
+    clear();
+}
+
+//*****************************************************************************
+//
+//! Adds a robot that accepted a CRQ packet. Synchronized by mutex.
+//!
+//! \param address the address and port of the robot.
+//! \param connection the connection made by FastConnector, whose socket is
+//!     taken.
+//!
+//! \return Returns \b true if the robot was added and \b false otherwise.
+//
+//*****************************************************************************
+bool RobotSet::add(IPv4Address address,
+    FastConnector::Connection &connection)
+{
+    std::unique_ptr<Robot> robot(new Robot());
+    robot->address = address;
+    robot->socket = std::move(connection.socket);
+    robot->sockfd = robot->socket->getDescriptor();
+    robot->frameReader = connection.frameReader;
+    robot->awaitingDack = false;
+    robot->failed = false;
+    robot->feedbackAge = 0;
+    robot->sent = 0;
+    robot->skipped = 0;
+    for (int i=0; i<NUM_FINGERS; i++)
+    {
+        robot->pressure[i] = 0;
+    }
+
+    //
+    // Firmware that predates the options grants none
+    //
+    HIRCPPacket ackPacket = HIRCPPacket::createEmptyPacket();
+    ackPacket.populate(connection.ack, HIRCPPacket::MAX_PACKET_SIZE);
+    unsigned char ackPayload[HIRCPPacket::MAX_PAYLOAD_LEN];
+    ackPacket.getPayload(ackPayload, HIRCPPacket::MAX_PAYLOAD_LEN);
+    robot->timedDack = (ackPayload[0] & HIRCPPacket::TIMED_DACK) != 0;
+
+    std::lock_guard<std::mutex> lock(_robots_mutex);
+    Robot *watched = robot.get();
+    if (!_loop.add(robot->sockfd, EventLoop::EVENT_READ,
+        [this, watched](int, int events)
+        {
+            _receive(*watched, events);
+        }))
+    {
+        std::cout << "[ERROR] RobotSet::add(): Could not watch " <<
+            _name(address) << "." << std::endl;
+        return false;
+    }
+    _robots.push_back(std::move(robot));
+
+    std::cout << "Mirroring to " << _name(address) << "." << std::endl;
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Disconnects from every robot. Each is sent a TRQ packet without waiting
+//! for its ACK. Synchronized by mutex.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotSet::clear()
+{
+    std::lock_guard<std::mutex> lock(_robots_mutex);
+
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    HIRCPPacket trqPacket = HIRCPPacket::createTRQPacket();
+    trqPacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+    for (unsigned int i=0; i<_robots.size(); i++)
+    {
+        Robot &robot = *_robots[i];
+        _loop.remove(robot.sockfd);
+        robot.socket->send(message, HIRCPPacket::MAX_PACKET_SIZE, 0);
+        robot.socket->close();
+    }
+    _robots.clear();
+}
+
+//*****************************************************************************
+//
+//! Gets the number of robots mirrored to. Synchronized by mutex.
+//!
+//! \param None.
+//!
+//! \return Returns the number of robots.
+//
+//*****************************************************************************
+unsigned int RobotSet::size()
+{
+    std::lock_guard<std::mutex> lock(_robots_mutex);
+    return static_cast<unsigned int>(_robots.size());
+}
+
+//*****************************************************************************
+//
+//! Takes in whatever DACK packets have arrived, then sends a pose to every
+//! robot that has answered the last. Never waits on a robot: one whose DACK
+//! is late misses the pose, and one whose DACK is later than
+//! STALL_TIMEOUT_MS is dropped. Synchronized by mutex.
+//!
+//! \param payload the DATA payload, HIRCPPacket::MAX_PAYLOAD_LEN bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotSet::update(unsigned char *payload)
+{
+    std::lock_guard<std::mutex> lock(_robots_mutex);
+    if (_robots.empty())
+    {
+        return;
+    }
+
+    //
+    // Reads every socket with data waiting
+    //
+    _loop.runOnce(0);
+
+    //
+    // Encodes the pose once for every robot
+    //
+    HIRCPPacket dataPacket = HIRCPPacket::createDATAPacket(payload,
+        HIRCPPacket::MAX_PAYLOAD_LEN);
+    dataPacket.getData(_message, HIRCPPacket::MAX_PACKET_SIZE);
+
+    TimingStats::Clock::time_point now = TimingStats::Clock::now();
+    for (unsigned int i=0; i<_robots.size(); i++)
+    {
+        Robot &robot = *_robots[i];
+        if (robot.failed)
+        {
+            continue;
+        }
+
+        if (robot.awaitingDack)
+        {
+            if (now - robot.sentAt >
+                std::chrono::milliseconds(STALL_TIMEOUT_MS))
+            {
+                std::cout << "[WARNING] RobotSet::update(): " <<
+                    _name(robot.address) << " stopped answering." <<
+                    std::endl;
+                robot.failed = true;
+                continue;
+            }
+            robot.skipped++;
+            continue;
+        }
+
+        //
+        // The DACK holds the robot to one pose in flight, so the send buffer
+        // always has room unless the link is gone
+        //
+        if (!robot.socket->send(_message, HIRCPPacket::MAX_PACKET_SIZE, 0))
+        {
+            std::cout << "[WARNING] RobotSet::update(): Send to " <<
+                _name(robot.address) << " failed." << std::endl;
+            robot.failed = true;
+            continue;
+        }
+        robot.awaitingDack = true;
+        robot.sentAt = now;
+        robot.sent++;
+    }
+
+    //
+    // Drops the robots that failed, newest first so indices hold
+    //
+    for (unsigned int i=static_cast<unsigned int>(_robots.size()); i>0; i--)
+    {
+        if (_robots[i-1]->failed)
+        {
+            _drop(i-1);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Sets the feedback mode of every robot. The robots do not answer MODE
+//! packets. Synchronized by mutex.
+//!
+//! \param mode the FEEDBACK_MODE to set.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotSet::setMode(HIRCPPacket::FEEDBACK_MODE mode)
+{
+    std::lock_guard<std::mutex> lock(_robots_mutex);
+
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    HIRCPPacket modePacket = HIRCPPacket::createMODEPacket(mode);
+    modePacket.getData(message, HIRCPPacket::MAX_PACKET_SIZE);
+
+    for (unsigned int i=static_cast<unsigned int>(_robots.size()); i>0; i--)
+    {
+        Robot &robot = *_robots[i-1];
+        if (!robot.socket->send(message, HIRCPPacket::MAX_PACKET_SIZE, 0))
+        {
+            std::cout << "[WARNING] RobotSet::setMode(): Send to " <<
+                _name(robot.address) << " failed." << std::endl;
+            _drop(i-1);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Gets the greatest pressure on each finger across the robots, from their
+//! latest DACK packets. Synchronized by mutex.
+//!
+//! \param pressure array of NUM_FINGERS pressures, raised where a robot's
+//!     is greater.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotSet::getPressures(unsigned char *pressure)
+{
+    std::lock_guard<std::mutex> lock(_robots_mutex);
+    for (unsigned int i=0; i<_robots.size(); i++)
+    {
+        for (int j=0; j<NUM_FINGERS; j++)
+        {
+            if (_robots[i]->pressure[j] > pressure[j])
+            {
+                pressure[j] = _robots[i]->pressure[j];
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Prints how each robot kept up since the last report, then starts the
+//! counts over. Synchronized by mutex.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotSet::report()
+{
+    std::lock_guard<std::mutex> lock(_robots_mutex);
+    if (_robots.empty())
+    {
+        return;
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Mirrors (us)               sent  skipped      min      "\
+        "avg      max      age" << std::endl;
+    for (unsigned int i=0; i<_robots.size(); i++)
+    {
+        Robot &robot = *_robots[i];
+        std::cout << "  " << std::left << std::setw(22) <<
+            _name(robot.address) << std::right
+            << std::setw(7) << robot.sent
+            << std::setw(9) << robot.skipped
+            << std::setw(9) << robot.ackStats.getMin()
+            << std::setw(9) << robot.ackStats.getAverage()
+            << std::setw(9) << robot.ackStats.getMax()
+            << std::setw(9) << robot.feedbackAge << std::endl;
+        robot.sent = 0;
+        robot.skipped = 0;
+        robot.ackStats.reset();
+    }
+}
+
+//*****************************************************************************
+//
+//! Reads what a robot has sent and takes in its DACK packets. Anything else
+//! is ignored. A robot whose connection failed is marked to be dropped.
+//!
+//! \param robot the robot whose socket is ready.
+//! \param events the EventLoop::EVENT flags that occurred.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotSet::_receive(Robot &robot, int events)
+{
+    (void)events;
+
+    unsigned char *space;
+    unsigned int len = robot.frameReader.getSpace(space);
+    int received = robot.socket->recvSome(space,
+        static_cast<unsigned short>(len), 0);
+    if (received <= 0)
+    {
+        if (received == 0)
+        {
+            std::cout << "[WARNING] RobotSet::_receive(): " <<
+                _name(robot.address) << " closed the connection." <<
+                std::endl;
+        }
+        robot.failed = true;
+        return;
+    }
+    robot.frameReader.commit(received);
+
+    unsigned char message[HIRCPPacket::MAX_PACKET_SIZE];
+    while (robot.frameReader.next(message))
+    {
+        HIRCPPacket packet = HIRCPPacket::createEmptyPacket();
+        packet.populate(message, HIRCPPacket::MAX_PACKET_SIZE);
+        if (!packet.isValid() || packet.getType() != HIRCPPacket::DACK ||
+            !robot.awaitingDack)
+        {
+            continue;
+        }
+
+        unsigned char payload[HIRCPPacket::MAX_PAYLOAD_LEN];
+        packet.getPayload(payload, HIRCPPacket::MAX_PAYLOAD_LEN);
+        robot.feedbackAge = FrameKernels::decodeFingerPressures(payload,
+            robot.timedDack, robot.pressure);
+        robot.ackStats.add(robot.sentAt, TimingStats::Clock::now());
+        robot.awaitingDack = false;
+    }
+}
+
+//*****************************************************************************
+//
+//! Closes a robot's connection and removes it. The caller holds the mutex.
+//!
+//! \param index the robot's index.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RobotSet::_drop(unsigned int index)
+{
+    Robot &robot = *_robots[index];
+    _loop.remove(robot.sockfd);
+    robot.socket->close();
+    std::cout << "Stopped mirroring to " << _name(robot.address) << "." <<
+        std::endl;
+    _robots.erase(_robots.begin()+index);
+}
+
+//*****************************************************************************
+//
+//! Formats an address for messages.
+//!
+//! \param address the address and port.
+//!
+//! \return Returns the address in dotted notation with its port.
+//
+//*****************************************************************************
+std::string RobotSet::_name(IPv4Address address)
+{
+    unsigned int value = address.getAddress();
+    std::ostringstream name;
+    name << ((value >> 24) & 0xFF) << "." << ((value >> 16) & 0xFF) << "." <<
+        ((value >> 8) & 0xFF) << "." << (value & 0xFF) << ":" <<
+        address.getPort();
+    return name.str();
+}
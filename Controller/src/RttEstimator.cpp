@@ -0,0 +1,169 @@
+//*****************************************************************************
+//
+// RttEstimator.cpp
+//
+// Class that smooths round-trip time samples, in microseconds, and their
+// variation, and derives from them how long to wait for a reply.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "RttEstimator.h"
+
+#include <cmath>
+
+//*****************************************************************************
+//
+//! Constructor for RttEstimator. Starts with no samples.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+RttEstimator::RttEstimator()
+    : _count(0), _smoothed(0), _variation(0), _last(0)
+{
+
+}
+
+//*****************************************************************************
+//
+//! Empty destructor for RttEstimator.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+RttEstimator::~RttEstimator()
+{
+
+}
+
+//*****************************************************************************
+//
+//! Adds a round-trip time. Smooths it as TCP does (RFC 6298): the average
+//! moves an eighth of the way to each sample and the mean deviation a
+//! quarter of the way.
+//!
+//! \param micros the round-trip time in microseconds.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RttEstimator::add(double micros)
+{
+    const double ALPHA = 1.0/8;
+    const double BETA = 1.0/4;
+
+    if (_count == 0)
+    {
+        _smoothed = micros;
+        _variation = micros/2;
+    }
+    else
+    {
+        _variation = (1 - BETA)*_variation +
+            BETA*std::fabs(_smoothed - micros);
+        _smoothed = (1 - ALPHA)*_smoothed + ALPHA*micros;
+    }
+    _last = micros;
+    _count++;
+}
+
+//*****************************************************************************
+//
+//! Discards every sample.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void RttEstimator::reset()
+{
+    _count = 0;
+    _smoothed = 0;
+    _variation = 0;
+    _last = 0;
+}
+
+//*****************************************************************************
+//
+//! Gets the number of samples added.
+//!
+//! \param None.
+//!
+//! \return Returns the number of samples.
+//
+//*****************************************************************************
+unsigned int RttEstimator::getCount()
+{
+    return _count;
+}
+
+//*****************************************************************************
+//
+//! Gets the smoothed round-trip time.
+//!
+//! \param None.
+//!
+//! \return Returns the round-trip time in microseconds, 0 without samples.
+//
+//*****************************************************************************
+double RttEstimator::getSmoothed()
+{
+    return _smoothed;
+}
+
+//*****************************************************************************
+//
+//! Gets the smoothed mean deviation of the round-trip time.
+//!
+//! \param None.
+//!
+//! \return Returns the deviation in microseconds, 0 without samples.
+//
+//*****************************************************************************
+double RttEstimator::getVariation()
+{
+    return _variation;
+}
+
+//*****************************************************************************
+//
+//! Gets the latest round-trip time.
+//!
+//! \param None.
+//!
+//! \return Returns the round-trip time in microseconds, 0 without samples.
+//
+//*****************************************************************************
+double RttEstimator::getLast()
+{
+    return _last;
+}
+
+//*****************************************************************************
+//
+//! Gets how long to wait for a reply before taking it as lost: the smoothed
+//! round-trip time plus four deviations.
+//!
+//! \param minMicros the shortest wait to return.
+//!
+//! \return Returns the wait in microseconds, minMicros without samples.
+//
+//*****************************************************************************
+double RttEstimator::getTimeout(double minMicros)
+{
+    double timeout = _smoothed + 4*_variation;
+    return timeout > minMicros ? timeout : minMicros;
+}
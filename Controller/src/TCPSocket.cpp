@@ -11,13 +11,31 @@
 // December 27, 2015
 //
 // Modified:
-// January 9, 2016
+// October 19, 2026
 //
 //*****************************************************************************
 #include "TCPSocket.h"
 
+#include <cstring>
 #include <iostream>
-#include <winsock2.h>
+
+#include "EventLoop.h"
+
+//
+// Socket options left to the operating system
+//
+const TCPSocket::Profile TCPSocket::DEFAULT_PROFILE = { false, false, -1, 0,
+    0 };
+
+//
+// Socket options for the control stream. Each packet is 15 bytes and only
+// the newest pose matters, so segments leave at once, ACKs are not held
+// back, the packets are marked Expedited Forwarding (DSCP 46, which Wi-Fi
+// maps to the voice queue) and small buffers keep stale packets from
+// piling up behind a slow link.
+//
+const TCPSocket::Profile TCPSocket::LOW_LATENCY_PROFILE = { true, true, 0xB8,
+    4096, 4096 };
 
 //*****************************************************************************
 //
@@ -28,7 +46,8 @@
 //! \return None.
 //
 //*****************************************************************************
-TCPSocket::TCPSocket()
+TCPSocket::TCPSocket() : _timeoutMs(DEFAULT_TIMEOUT_MS), _timedOut(false),
+    _profile(DEFAULT_PROFILE)
 {
     _sockfd = 0;
 }
@@ -49,7 +68,9 @@ TCPSocket::~TCPSocket()
 
 //*****************************************************************************
 //
-//! Creates and opens a TCP streaming socket.
+//! Creates and opens a TCP streaming socket in non-blocking mode with the
+//! options of the socket's profile. Every operation then waits at most for
+//! its timeout.
 //!
 //! \param None.
 //!
@@ -79,6 +100,23 @@ bool TCPSocket::open()
         return false;
     }
 
+    //
+    // Operations wait for the socket with EventLoop instead of blocking
+    //
+    if (!network::setNonBlocking(_sockfd, true))
+    {
+        std::cerr << "[ERROR] TCPSocket::open(): Socket could not be set to "\
+            "non-blocking mode." << std::endl;
+        close();
+        return false;
+    }
+
+    //
+    // Buffer sizes must be set before connecting to take effect
+    //
+    _applyProfile();
+
+    _timedOut = false;
     return true;
 }
 
@@ -93,6 +131,11 @@ bool TCPSocket::open()
 //*****************************************************************************
 void TCPSocket::close()
 {
+    if (_sockfd == 0)
+    {
+        return;
+    }
+
 #ifdef _WIN32
     //
     // Windows uses closesocket() instead of close()
@@ -109,7 +152,7 @@ void TCPSocket::close()
 
 //*****************************************************************************
 //
-//! Establishes a TCP connection to remote host.
+//! Establishes a TCP connection to remote host within the socket's timeout.
 //!
 //! \param address in which to attempt TCP connection.
 //!
@@ -118,6 +161,64 @@ void TCPSocket::close()
 //
 //*****************************************************************************
 bool TCPSocket::connect(AddressBase<unsigned int> *address)
+{
+    return connect(address, _timeoutMs);
+}
+
+//*****************************************************************************
+//
+//! Establishes a TCP connection to remote host.
+//!
+//! \param address in which to attempt TCP connection.
+//! \param timeoutMs the longest time to wait in milliseconds, or NO_TIMEOUT.
+//!
+//! \return Returns \b true if the connection was established and \b
+//! false otherwise.
+//
+//*****************************************************************************
+bool TCPSocket::connect(AddressBase<unsigned int> *address, int timeoutMs)
+{
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::milliseconds(timeoutMs);
+    _timedOut = false;
+
+    CONNECT_STATUS status = startConnect(address);
+    if (status == CONNECT_PENDING)
+    {
+        if (_wait(EventLoop::EVENT_WRITE, deadline, timeoutMs >= 0) &&
+            finishConnect())
+        {
+            return true;
+        }
+        close();
+    }
+
+    if (status != CONNECT_DONE)
+    {
+        std::cerr << "[ERROR] TCPSocket::connect(): Failed to connect to "\
+            "remote host" << (_timedOut ? " (timed out)." : ".") <<
+            std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+//
+//! Starts a TCP connection to remote host without waiting for it. A pending
+//! connection completes once the socket becomes writable, which the caller
+//! waits for before calling finishConnect().
+//!
+//! \param address in which to attempt TCP connection.
+//!
+//! \return Returns CONNECT_DONE if the connection was established,
+//! CONNECT_PENDING if it is under way and CONNECT_FAILED otherwise, in which
+//! case the socket is closed.
+//
+//*****************************************************************************
+TCPSocket::CONNECT_STATUS TCPSocket::startConnect(
+    AddressBase<unsigned int> *address)
 {
     //
     // Constructs sockaddr_in structure to use for connecting
@@ -129,13 +230,42 @@ bool TCPSocket::connect(AddressBase<unsigned int> *address)
     serv_addr.sin_port = htons(address->getPort());
     serv_addr.sin_addr.s_addr = htonl((int)address->getAddress());
 
-    //
-    // Connects to remote host designated by address
-    //
-    if (::connect(_sockfd, (struct sockaddr*)&serv_addr, serv_addr_len))
+    if (::connect(_sockfd, (struct sockaddr*)&serv_addr, serv_addr_len) == 0)
+    {
+        return CONNECT_DONE;
+    }
+
+    if (network::isWouldBlock(network::getLastError()))
+    {
+        return CONNECT_PENDING;
+    }
+
+    close();
+    return CONNECT_FAILED;
+}
+
+//*****************************************************************************
+//
+//! Completes a connection started by startConnect() once the socket has
+//! become writable, taking its outcome from SO_ERROR.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if the connection was established and \b false
+//! otherwise, in which case the socket is closed.
+//
+//*****************************************************************************
+bool TCPSocket::finishConnect()
+{
+    int error = 0;
+    socklen_t error_len = sizeof(error);
+    if (getsockopt(_sockfd, SOL_SOCKET, SO_ERROR, (char*)&error, &error_len))
+    {
+        error = network::getLastError();
+    }
+
+    if (error != 0)
     {
-        std::cerr << "[ERROR] TCPSocket::connect(): Failed to connect to "\
-            "remote host." << std::endl;
         close();
         return false;
     }
@@ -145,7 +275,7 @@ bool TCPSocket::connect(AddressBase<unsigned int> *address)
 
 //*****************************************************************************
 //
-//! Sends the entire message to remote host.
+//! Sends the entire message to remote host within the socket's timeout.
 //!
 //! \param message buffer containing message to send.
 //! \param len length of the buffer.
@@ -156,12 +286,55 @@ bool TCPSocket::connect(AddressBase<unsigned int> *address)
 //*****************************************************************************
 bool TCPSocket::send(unsigned char *message, unsigned short len)
 {
-    // TODO (Brandon): Implement
-    if (::send(_sockfd, reinterpret_cast<char*>(message), len, 0) == -1)
+    return send(message, len, _timeoutMs);
+}
+
+//*****************************************************************************
+//
+//! Sends the entire message to remote host.
+//!
+//! \param message buffer containing message to send.
+//! \param len length of the buffer.
+//! \param timeoutMs the longest time to wait in milliseconds, or NO_TIMEOUT.
+//!
+//! \return Returns \b true if the message was sent successfully and \b
+//! false otherwise.
+//
+//*****************************************************************************
+bool TCPSocket::send(unsigned char *message, unsigned short len,
+    int timeoutMs)
+{
+#ifdef MSG_NOSIGNAL
+    const int FLAGS = MSG_NOSIGNAL;
+#else
+    const int FLAGS = 0;
+#endif
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::milliseconds(timeoutMs);
+    _timedOut = false;
+
+    unsigned short sent = 0;
+    while (sent < len)
     {
-        close();
-        std::cerr << "[ERROR] TCPSocket::send(): send failed." << std::endl;
-        return false;
+        int iRetVal = ::send(_sockfd, reinterpret_cast<char*>(message+sent),
+            len-sent, FLAGS);
+        if (iRetVal > 0)
+        {
+            sent += iRetVal;
+            continue;
+        }
+
+        //
+        // Waits for room in the send buffer
+        //
+        if (iRetVal == 0 || !network::isWouldBlock(network::getLastError())
+            || !_wait(EventLoop::EVENT_WRITE, deadline, timeoutMs >= 0))
+        {
+            close();
+            std::cerr << "[ERROR] TCPSocket::send(): send failed" <<
+                (_timedOut ? " (timed out)." : ".") << std::endl;
+            return false;
+        }
     }
 
     return true;
@@ -169,7 +342,8 @@ bool TCPSocket::send(unsigned char *message, unsigned short len)
 
 //*****************************************************************************
 //
-//! Receives the entire message from remote host.
+//! Receives the entire message from remote host within the socket's
+//! timeout.
 //!
 //! \param message buffer to store message to be received.
 //! \param len length of the buffer.
@@ -180,13 +354,339 @@ bool TCPSocket::send(unsigned char *message, unsigned short len)
 //*****************************************************************************
 bool TCPSocket::recv(unsigned char *message, unsigned short len)
 {
-    // TODO (Brandon): Implement
-    if (::recv(_sockfd, reinterpret_cast<char*>(message), len, 0) == -1)
+    return recv(message, len, _timeoutMs);
+}
+
+//*****************************************************************************
+//
+//! Receives the entire message from remote host. A connection closed by the
+//! remote host before the message is complete counts as a failure.
+//!
+//! \param message buffer to store message to be received.
+//! \param len length of the buffer.
+//! \param timeoutMs the longest time to wait in milliseconds, or NO_TIMEOUT.
+//!
+//! \return Returns \b true if the message was received successfully and \b
+//! false otherwise.
+//
+//*****************************************************************************
+bool TCPSocket::recv(unsigned char *message, unsigned short len,
+    int timeoutMs)
+{
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::milliseconds(timeoutMs);
+    _timedOut = false;
+
+    unsigned short received = 0;
+    while (received < len)
     {
-        close();
-        std::cerr << "[ERROR] TCPSocket::recv(): recv failed." << std::endl;
-        return false;
+        int iRetVal = ::recv(_sockfd,
+            reinterpret_cast<char*>(message+received), len-received, 0);
+        if (iRetVal > 0)
+        {
+            received += iRetVal;
+            _rearmQuickAck();
+            continue;
+        }
+
+        //
+        // Waits for more data to arrive
+        //
+        if (iRetVal == 0 || !network::isWouldBlock(network::getLastError())
+            || !_wait(EventLoop::EVENT_READ, deadline, timeoutMs >= 0))
+        {
+            close();
+            std::cerr << "[ERROR] TCPSocket::recv(): recv failed" <<
+                (_timedOut ? " (timed out)." : (iRetVal == 0) ?
+                " (connection closed)." : ".") << std::endl;
+            return false;
+        }
     }
 
     return true;
 }
+
+//*****************************************************************************
+//
+//! Receives whatever the remote host has sent, up to the size of the
+//! buffer, waiting for the first byte to arrive.
+//!
+//! \param message buffer to store message to be received.
+//! \param len length of the buffer.
+//! \param timeoutMs the longest time to wait in milliseconds, or NO_TIMEOUT.
+//!
+//! \return Returns the number of bytes received, 0 if the remote host closed
+//! the connection and -1 on failure or timeout.
+//
+//*****************************************************************************
+int TCPSocket::recvSome(unsigned char *message, unsigned short len,
+    int timeoutMs)
+{
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::milliseconds(timeoutMs);
+    _timedOut = false;
+
+    while (true)
+    {
+        int iRetVal = ::recv(_sockfd, reinterpret_cast<char*>(message), len,
+            0);
+        if (iRetVal >= 0)
+        {
+            _rearmQuickAck();
+            return iRetVal;
+        }
+
+        if (!network::isWouldBlock(network::getLastError()) ||
+            !_wait(EventLoop::EVENT_READ, deadline, timeoutMs >= 0))
+        {
+            close();
+            std::cerr << "[ERROR] TCPSocket::recvSome(): recv failed" <<
+                (_timedOut ? " (timed out)." : ".") << std::endl;
+            return -1;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Sets the timeout used by connect(), send() and recv() when none is given.
+//!
+//! \param timeoutMs the timeout in milliseconds, or NO_TIMEOUT.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void TCPSocket::setTimeout(int timeoutMs)
+{
+    _timeoutMs = timeoutMs;
+}
+
+//*****************************************************************************
+//
+//! Returns the timeout used by connect(), send() and recv() when none is
+//! given.
+//!
+//! \param None.
+//!
+//! \return Returns the timeout in milliseconds, or NO_TIMEOUT.
+//
+//*****************************************************************************
+int TCPSocket::getTimeout()
+{
+    return _timeoutMs;
+}
+
+//*****************************************************************************
+//
+//! Checks whether the last operation failed because its timeout elapsed.
+//!
+//! \param None.
+//!
+//! \return Returns \b true if the last operation timed out and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool TCPSocket::hasTimedOut()
+{
+    return _timedOut;
+}
+
+//*****************************************************************************
+//
+//! Sets the socket options applied by open(). A socket that is already open
+//! keeps its options until it is reopened.
+//!
+//! \param profile the socket options, such as LOW_LATENCY_PROFILE.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void TCPSocket::setProfile(const Profile &profile)
+{
+    _profile = profile;
+}
+
+//*****************************************************************************
+//
+//! Returns the socket options applied by open().
+//!
+//! \param None.
+//!
+//! \return Returns the socket's profile.
+//
+//*****************************************************************************
+TCPSocket::Profile TCPSocket::getProfile()
+{
+    return _profile;
+}
+
+//*****************************************************************************
+//
+//! Returns the socket descriptor, for watching the socket with an EventLoop.
+//!
+//! \param None.
+//!
+//! \return Returns the socket descriptor, or 0 if the socket is closed.
+//
+//*****************************************************************************
+int TCPSocket::getDescriptor()
+{
+    return _sockfd;
+}
+
+//*****************************************************************************
+//
+//! Waits until the socket is ready or the deadline passes.
+//!
+//! \param events the EventLoop::EVENT flags to wait for.
+//! \param deadline the time to give up at.
+//! \param limited \b false to ignore the deadline.
+//!
+//! \return Returns \b true if the socket is ready and \b false on timeout
+//! or error.
+//
+//*****************************************************************************
+bool TCPSocket::_wait(int events, Clock::time_point deadline, bool limited)
+{
+    while (true)
+    {
+        int timeoutMs = NO_TIMEOUT;
+        if (limited)
+        {
+            Clock::duration remaining = deadline - Clock::now();
+            if (remaining <= Clock::duration::zero())
+            {
+                _timedOut = true;
+                return false;
+            }
+
+            //
+            // Rounds up so the wait never ends just short of the deadline
+            //
+            timeoutMs = static_cast<int>(std::chrono::duration_cast<
+                std::chrono::milliseconds>(remaining +
+                std::chrono::milliseconds(1) - Clock::duration(1)).count());
+        }
+
+        //
+        // WSAPoll() on Windows before 10 version 2004 does not report a
+        // refused connection, so such a connect() lasts until the deadline
+        //
+        int ready = EventLoop::wait(_sockfd, events, timeoutMs);
+        if (ready > 0)
+        {
+            return true;
+        }
+        if (ready < 0 && !network::isWouldBlock(network::getLastError()))
+        {
+            return false;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Applies the options of the socket's profile. An option the platform
+//! rejects is reported and skipped, since the socket still works without
+//! it.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void TCPSocket::_applyProfile()
+{
+    int value;
+
+    if (_profile.noDelay)
+    {
+        value = 1;
+        if (setsockopt(_sockfd, IPPROTO_TCP, TCP_NODELAY, (char*)&value,
+            sizeof(value)))
+        {
+            std::cout << "[WARNING] TCPSocket::_applyProfile(): TCP_NODELAY "\
+                "not set." << std::endl;
+        }
+    }
+
+    //
+    // Windows ignores IP_TOS unless the DisableUserTOSSetting registry value
+    // is cleared; a QoS policy marks the packets instead
+    //
+    if (_profile.typeOfService >= 0)
+    {
+        value = _profile.typeOfService;
+        if (setsockopt(_sockfd, IPPROTO_IP, IP_TOS, (char*)&value,
+            sizeof(value)))
+        {
+            std::cout << "[WARNING] TCPSocket::_applyProfile(): IP_TOS not "\
+                "set." << std::endl;
+        }
+    }
+
+    if (_profile.sendBufferSize > 0)
+    {
+        value = _profile.sendBufferSize;
+        if (setsockopt(_sockfd, SOL_SOCKET, SO_SNDBUF, (char*)&value,
+            sizeof(value)))
+        {
+            std::cout << "[WARNING] TCPSocket::_applyProfile(): SO_SNDBUF "\
+                "not set." << std::endl;
+        }
+    }
+
+    if (_profile.recvBufferSize > 0)
+    {
+        value = _profile.recvBufferSize;
+        if (setsockopt(_sockfd, SOL_SOCKET, SO_RCVBUF, (char*)&value,
+            sizeof(value)))
+        {
+            std::cout << "[WARNING] TCPSocket::_applyProfile(): SO_RCVBUF "\
+                "not set." << std::endl;
+        }
+    }
+
+#if defined(_WIN32) && defined(SIO_TCP_SET_ACK_FREQUENCY)
+    //
+    // Windows 8 and later acknowledge every segment once the ACK frequency
+    // is 1, which lasts for the life of the socket
+    //
+    if (_profile.quickAck)
+    {
+        DWORD frequency = 1;
+        DWORD bytesReturned = 0;
+        if (WSAIoctl(_sockfd, SIO_TCP_SET_ACK_FREQUENCY, &frequency,
+            sizeof(frequency), NULL, 0, &bytesReturned, NULL, NULL))
+        {
+            std::cout << "[WARNING] TCPSocket::_applyProfile(): ACK "\
+                "frequency not set." << std::endl;
+        }
+    }
+#else
+    _rearmQuickAck();
+#endif
+}
+
+//*****************************************************************************
+//
+//! Turns delayed ACKs off for the socket's next segments if its profile
+//! asks for quick ACKs. Linux drops back to delayed ACKs on its own, so
+//! this is repeated after every receive. Does nothing on platforms without
+//! TCP_QUICKACK.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void TCPSocket::_rearmQuickAck()
+{
+#ifdef TCP_QUICKACK
+    if (_profile.quickAck)
+    {
+        int value = 1;
+        setsockopt(_sockfd, IPPROTO_TCP, TCP_QUICKACK, &value, sizeof(value));
+    }
+#endif
+}
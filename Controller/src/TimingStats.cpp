@@ -0,0 +1,158 @@
+//*****************************************************************************
+//
+// TimingStats.cpp
+//
+// Class that collects the count, minimum, average and maximum of a series of
+// durations, in microseconds.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+#include "TimingStats.h"
+
+//*****************************************************************************
+//
+//! Constructor for TimingStats. Starts with no samples.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+TimingStats::TimingStats()
+    : _count(0), _min(0), _max(0), _total(0)
+{
+
+}
+
+//*****************************************************************************
+//
+//! Empty destructor for TimingStats.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+TimingStats::~TimingStats()
+{
+
+}
+
+//*****************************************************************************
+//
+//! Adds a duration.
+//!
+//! \param micros the duration in microseconds.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void TimingStats::add(double micros)
+{
+    if (_count == 0 || micros < _min)
+    {
+        _min = micros;
+    }
+    if (_count == 0 || micros > _max)
+    {
+        _max = micros;
+    }
+    _total += micros;
+    _count++;
+}
+
+//*****************************************************************************
+//
+//! Adds the duration between two clock readings.
+//!
+//! \param begin clock reading at the start.
+//! \param end clock reading at the end.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void TimingStats::add(Clock::time_point begin, Clock::time_point end)
+{
+    add(std::chrono::duration<double, std::micro>(end - begin).count());
+}
+
+//*****************************************************************************
+//
+//! Discards every duration added.
+//!
+//! \param None.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void TimingStats::reset()
+{
+    _count = 0;
+    _min = 0;
+    _max = 0;
+    _total = 0;
+}
+
+//*****************************************************************************
+//
+//! Gets the number of durations added.
+//!
+//! \param None.
+//!
+//! \return The number of durations added since the last reset.
+//
+//*****************************************************************************
+unsigned int TimingStats::getCount()
+{
+    return _count;
+}
+
+//*****************************************************************************
+//
+//! Gets the shortest duration.
+//!
+//! \param None.
+//!
+//! \return The shortest duration in microseconds, or 0 if there are none.
+//
+//*****************************************************************************
+double TimingStats::getMin()
+{
+    return _min;
+}
+
+//*****************************************************************************
+//
+//! Gets the average duration.
+//!
+//! \param None.
+//!
+//! \return The average duration in microseconds, or 0 if there are none.
+//
+//*****************************************************************************
+double TimingStats::getAverage()
+{
+    return (_count == 0) ? 0 : _total/_count;
+}
+
+//*****************************************************************************
+//
+//! Gets the longest duration.
+//!
+//! \param None.
+//!
+//! \return The longest duration in microseconds, or 0 if there are none.
+//
+//*****************************************************************************
+double TimingStats::getMax()
+{
+    return _max;
+}
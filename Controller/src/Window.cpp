@@ -17,7 +17,6 @@
 #include "Window.h"
 
 #include <Commdlg.h> /* OPENFILENAME */
-#include <cassert>
 #include <fstream>
 #include <iostream>
 #include <thread>
@@ -26,7 +25,6 @@
 #include <SDL_syswm.h>
 
 #include "IPv4Address.h"
-#include "TCPSocket.h"
 
 #include "resource.h"
 
@@ -99,6 +97,15 @@ Window::~Window()
 //*****************************************************************************
 bool Window::run()
 {
+    //
+    // Listens for robots, so auto-connect knows where they are
+    //
+    if (!_discovery.start())
+    {
+        std::cerr << "[WARNING] Window::run(): Robot discovery unavailable."
+            << std::endl;
+    }
+
     //
     // Creates panel
     //
@@ -122,6 +129,7 @@ bool Window::run()
     // Wait for thread to finish
     //
     panelThread.join();
+    _discovery.stop();
 
     return true;
 }
@@ -256,45 +264,66 @@ void Window::_processInput()
                         MAKEINTRESOURCE(IDD_CONNECT), NULL,
                         Window::ConnectDlgProcRouter, (LPARAM)(this));
                     break;
-                case ID_FILE_AUTO:
+                case ID_FILE_QUICK:
                 {
                     //
-                    // File -> Auto-connect
+                    // File -> Quick connect
                     //
-                    char ipAddress[IPv4Address::MAX_IP_ADDR_BUF_LEN];
-
-                    // Fetch IP address from server
-                    if (!_getRemoteIPAddress(ipAddress,
-                        IPv4Address::MAX_IP_ADDR_BUF_LEN))
+                    std::vector<std::string> ipAddresses = _loadIPAddresses();
+                    int connected = _panel->connect(ipAddresses);
+                    if (connected < 0)
                     {
                         //
                         // Creates daemon thread
                         //
                         std::thread messageBoxThread(messageBoxTask,
                             _windowHandle,
-                            "Unable to fetch IP address from server",
-                            "Auto-connect failed");
+                            "Unable to connect to any saved address",
+                            "Quick connect failed");
                         messageBoxThread.detach();
                         break;
                     }
 
-                    if (!IPv4Address::validateIPAddress(ipAddress))
+                    _saveIPAddress(ipAddresses[connected]);
+                    EnableMenuItem(_menu, ID_FILE_DISCONNECT, MF_ENABLED);
+                    EnableMenuItem(_menu, ID_FILE_CONNECT, MF_GRAYED);
+                    EnableMenuItem(_menu, ID_FILE_QUICK, MF_GRAYED);
+                    EnableMenuItem(_menu, ID_FILE_AUTO, MF_GRAYED);
+                    break;
+                }
+                case ID_FILE_AUTO:
+                {
+                    //
+                    // File -> Auto-connect
+                    //
+                    // Robots found by their beacons, idle ones first
+                    std::vector<RobotDiscovery::Robot> robots =
+                        _discovery.getRobots();
+                    if (robots.empty())
                     {
                         //
                         // Creates daemon thread
                         //
                         std::thread messageBoxThread(messageBoxTask,
                             _windowHandle,
-                            "Invalid IP address found from server",
+                            "No robots found on the local network",
                             "Auto-connect failed");
                         messageBoxThread.detach();
                         break;
                     }
 
+                    std::vector<IPv4Address> addresses;
+                    for (unsigned int i=0; i<robots.size(); i++)
+                    {
+                        addresses.push_back(IPv4Address(robots[i].address,
+                            robots[i].port));
+                    }
+
                     //
                     // Connect to remote host
                     //
-                    if (!_panel->connect(ipAddress))
+                    int connected = _panel->connect(addresses);
+                    if (connected < 0)
                     {
                         //
                         // Creates daemon thread
@@ -306,13 +335,58 @@ void Window::_processInput()
                         messageBoxThread.detach();
                         break;
                     }
+                    std::cout << "Auto-connected to robot " << std::hex <<
+                        robots[connected].id << std::dec << std::endl;
 
                     EnableMenuItem(_menu, ID_FILE_DISCONNECT, MF_ENABLED);
                     EnableMenuItem(_menu, ID_FILE_CONNECT, MF_GRAYED);
+                    EnableMenuItem(_menu, ID_FILE_QUICK, MF_GRAYED);
                     EnableMenuItem(_menu, ID_FILE_AUTO, MF_GRAYED);
-                    EndDialog(_windowHandle, 0);
                     break;
                 }
+                case ID_FILE_MIRROR:
+                {
+                    //
+                    // File -> Mirror to idle robots
+                    //
+                    // Robots found by their beacons, less those in use
+                    std::vector<RobotDiscovery::Robot> robots =
+                        _discovery.getRobots();
+                    std::vector<IPv4Address> addresses;
+                    for (unsigned int i=0; i<robots.size(); i++)
+                    {
+                        if (!(robots[i].capabilities &
+                            HIRCPPacket::CAPABILITY_BUSY))
+                        {
+                            addresses.push_back(IPv4Address(
+                                robots[i].address, robots[i].port));
+                        }
+                    }
+
+                    if (addresses.empty() ||
+                        _panel->addMirrors(addresses) == 0)
+                    {
+                        //
+                        // Creates daemon thread
+                        //
+                        std::thread messageBoxThread(messageBoxTask,
+                            _windowHandle,
+                            "No idle robots could be mirrored to",
+                            "Mirroring failed");
+                        messageBoxThread.detach();
+                        break;
+                    }
+
+                    EnableMenuItem(_menu, ID_FILE_UNMIRROR, MF_ENABLED);
+                    break;
+                }
+                case ID_FILE_UNMIRROR:
+                    //
+                    // File -> Stop mirroring
+                    //
+                    _panel->removeMirrors();
+                    EnableMenuItem(_menu, ID_FILE_UNMIRROR, MF_GRAYED);
+                    break;
                 case ID_FILE_DISCONNECT:
                     //
                     // File -> Disconnect
@@ -320,6 +394,7 @@ void Window::_processInput()
                     _panel->disconnect();
                     EnableMenuItem(_menu, ID_FILE_DISCONNECT, MF_GRAYED);
                     EnableMenuItem(_menu, ID_FILE_CONNECT, MF_ENABLED);
+                    EnableMenuItem(_menu, ID_FILE_QUICK, MF_ENABLED);
                     EnableMenuItem(_menu, ID_FILE_AUTO, MF_ENABLED);
                     break;
                 case ID_FILE_QUIT:
@@ -434,6 +509,7 @@ void Window::_processInput()
                     }
                     EnableMenuItem(_menu, ID_OPTIONS_NORMALMODE, MF_GRAYED);
                     EnableMenuItem(_menu, ID_OPTIONS_CLOSED, MF_ENABLED);
+                    EnableMenuItem(_menu, ID_OPTIONS_HYBRID, MF_ENABLED);
                     break;
                 case ID_OPTIONS_CLOSED:
                     //
@@ -445,6 +521,118 @@ void Window::_processInput()
                     }
                     EnableMenuItem(_menu, ID_OPTIONS_NORMALMODE, MF_ENABLED);
                     EnableMenuItem(_menu, ID_OPTIONS_CLOSED, MF_GRAYED);
+                    EnableMenuItem(_menu, ID_OPTIONS_HYBRID, MF_ENABLED);
+                    break;
+                case ID_OPTIONS_HYBRID:
+                    //
+                    // Options -> Force-limited mode
+                    //
+                    if (!_panel->setFeedbackMode(HIRCPPacket::HYBRID_MODE))
+                    {
+                        return;
+                    }
+                    EnableMenuItem(_menu, ID_OPTIONS_NORMALMODE, MF_ENABLED);
+                    EnableMenuItem(_menu, ID_OPTIONS_CLOSED, MF_ENABLED);
+                    EnableMenuItem(_menu, ID_OPTIONS_HYBRID, MF_GRAYED);
+                    break;
+                case ID_OPTIONS_FORCESETPOINTS:
+                {
+                    //
+                    // Options -> Force setpoints...
+                    //
+                    OPENFILENAME openFileName;
+                    char filePathBuf[MAX_PATH] = "";
+
+                    ZeroMemory(&openFileName, sizeof(openFileName));
+
+                    openFileName.lStructSize = sizeof(openFileName);
+                    openFileName.hwndOwner = _windowHandle;
+                    openFileName.lpstrFilter = "Text Files (*.txt)\0*.txt\0"\
+                        "All Files (*.*)\0*.*\0";
+                    openFileName.lpstrFile = filePathBuf;
+                    openFileName.nMaxFile = MAX_PATH;
+                    openFileName.lpstrDefExt = "txt";
+                    openFileName.Flags = OFN_EXPLORER | OFN_PATHMUSTEXIST |
+                        OFN_HIDEREADONLY;
+
+                    if (!GetOpenFileName(&openFileName))
+                    {
+                        break;
+                    }
+
+                    unsigned short setpoints[NUM_FINGERS];
+                    if (!_loadForceSetpoints(filePathBuf, setpoints) ||
+                        !_panel->setForceSetpoints(setpoints))
+                    {
+                        //
+                        // Creates daemon thread
+                        //
+                        std::thread messageBoxThread(messageBoxTask,
+                            _windowHandle,
+                            "The file must hold one setpoint per finger",
+                            "Force setpoints not set");
+                        messageBoxThread.detach();
+                    }
+                    break;
+                }
+                case ID_OPTIONS_ROBOTPLAY:
+                case ID_OPTIONS_ROBOTLOOP:
+                {
+                    //
+                    // Options -> Play on Robot / Loop on Robot
+                    //
+                    bool loop = (LOWORD(event.syswm.msg->msg.win.wParam) ==
+                        ID_OPTIONS_ROBOTLOOP);
+                    OPENFILENAME openFileName;
+                    char filePathBuf[MAX_PATH] = "";
+
+                    ZeroMemory(&openFileName, sizeof(openFileName));
+
+                    openFileName.lStructSize = sizeof(openFileName);
+                    openFileName.hwndOwner = _windowHandle;
+                    openFileName.lpstrFilter = "HIRC Files (*.hirc)\0*.hirc\0"\
+                        "All Files (*.*)\0*.*\0";
+                    openFileName.lpstrFile = filePathBuf;
+                    openFileName.nMaxFile = MAX_PATH;
+                    openFileName.lpstrDefExt = "hirc";
+                    openFileName.Flags = OFN_EXPLORER | OFN_PATHMUSTEXIST |
+                        OFN_HIDEREADONLY;
+
+                    if (GetOpenFileName(&openFileName) &&
+                        _panel->startRobotPlayback(filePathBuf, loop))
+                    {
+                        CheckMenuItem(_menu, ID_OPTIONS_ROBOTPAUSE,
+                            MF_UNCHECKED);
+                        EnableMenuItem(_menu, ID_OPTIONS_ROBOTPAUSE,
+                            MF_ENABLED);
+                        EnableMenuItem(_menu, ID_OPTIONS_ROBOTSTOP,
+                            MF_ENABLED);
+                    }
+
+                    break;
+                }
+                case ID_OPTIONS_ROBOTPAUSE:
+                {
+                    //
+                    // Options -> Pause on Robot, checked while paused
+                    //
+                    bool paused = (GetMenuState(_menu, ID_OPTIONS_ROBOTPAUSE,
+                        MF_BYCOMMAND) & MF_CHECKED) != 0;
+                    if (_panel->pauseRobotPlayback(!paused))
+                    {
+                        CheckMenuItem(_menu, ID_OPTIONS_ROBOTPAUSE,
+                            paused ? MF_UNCHECKED : MF_CHECKED);
+                    }
+                    break;
+                }
+                case ID_OPTIONS_ROBOTSTOP:
+                    //
+                    // Options -> Stop on Robot
+                    //
+                    _panel->stopRobotPlayback();
+                    CheckMenuItem(_menu, ID_OPTIONS_ROBOTPAUSE, MF_UNCHECKED);
+                    EnableMenuItem(_menu, ID_OPTIONS_ROBOTPAUSE, MF_GRAYED);
+                    EnableMenuItem(_menu, ID_OPTIONS_ROBOTSTOP, MF_GRAYED);
                     break;
                 default:
                     break;
@@ -461,208 +649,125 @@ void Window::_processInput()
 
 //*****************************************************************************
 //
-//! Save IP address to file.
+//! Loads force setpoints from a text file holding one pressure per finger,
+//! thumb first, separated by whitespace.
 //!
-//! \param ipAddress IP address to save.
+//! \param filePath path to the file.
+//! \param setpoints array of NUM_FINGERS to store the setpoints in.
 //!
-//! \return Returns \b true if the address was saved successfully and \b false
+//! \return Returns \b true if every setpoint was read and \b false
 //! otherwise.
 //
 //*****************************************************************************
-bool Window::_saveIPAddress(std::string ipAddress)
+bool Window::_loadForceSetpoints(const char *filePath,
+    unsigned short *setpoints)
 {
-    //
-    // Opens a file stream to save IP address to file
-    //
-    std::ofstream addressFile;
-    addressFile.open(_addressFilePath, std::ios::app);
-    if (!addressFile.is_open())
+    const long MAX_SETPOINT = 0xFFFF;
+
+    std::ifstream setpointFile;
+    setpointFile.open(filePath);
+    if (!setpointFile.is_open())
     {
-        std::cerr << "[ERROR] Panel::_saveIPAddress(): Unable to open file."
-            << std::endl;
+        std::cerr << "[ERROR] Window::_loadForceSetpoints(): Unable to open "\
+            "file." << std::endl;
         return false;
     }
 
-    //
-    // Save IP address to file
-    //
-    addressFile << ipAddress << std::endl;
+    for (int i=0; i<NUM_FINGERS; i++)
+    {
+        long setpoint;
+        if (!(setpointFile >> setpoint) || setpoint < 0 ||
+            setpoint > MAX_SETPOINT)
+        {
+            std::cerr << "[ERROR] Window::_loadForceSetpoints(): Setpoint " <<
+                i+1 << " is missing or out of range." << std::endl;
+            return false;
+        }
+        setpoints[i] = static_cast<unsigned short>(setpoint);
+    }
 
-    addressFile.close();
     return true;
 }
 
 //*****************************************************************************
 //
-//! Fetches IP address of remote host.
+//! Loads the saved IP addresses, ranked by recent success.
 //!
-//! \param buf buffer to store the fetched IP address.
-//! \param buflen size of buffer.
+//! \param None.
 //!
-//! \return Returns \b true if the address was fetched successfully and \b
-//! false otherwise.
+//! \return Returns the saved IP addresses, the most recently connected to
+//! first.
 //
 //*****************************************************************************
-bool Window::_getRemoteIPAddress(char *buf, int buflen)
+std::vector<std::string> Window::_loadIPAddresses()
 {
-    assert(buflen >= IPv4Address::MAX_IP_ADDR_BUF_LEN);
-    struct hostent *he;
-    struct in_addr **addr_list;
-    char *hostName = "robotarm.net23.net";
-    char *http_request_format = "GET /fetch_ip.php?id=1 HTTP/1.1\r\n"
-                                "Host: %s\r\n"
-                                "\r\n";
+    std::vector<std::string> ipAddresses;
 
     //
-    // Populate hostent structure with IP address information
-    //
-    if ((he = gethostbyname(hostName)) == NULL) 
-    {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Could not locate"\
-            " host." << std::endl;
-        return false;
-    }
-    addr_list = (struct in_addr**)he->h_addr_list;
-     
+    // Opens file stream to read saved IP addresses
     //
-    // Iterate through list of IP addresses and use first one found
-    //
-    char hostAddress[IPv4Address::MAX_IP_ADDR_BUF_LEN];
-    bool hostAddressFound = false;
-    for(int i=0; addr_list[i]!=NULL; i++) 
-    {
-        //The first IP address that matches;
-        strncpy_s(hostAddress, inet_ntoa(*addr_list[i]),
-            IPv4Address::MAX_IP_ADDR_BUF_LEN);
-        hostAddressFound = true;
-    }
-    //std::cout << "Host address = " << hostAddress << std::endl;
-
-    //
-    // Check if an IP address was found
-    //
-    if (!hostAddressFound)
-    {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Host address not"\
-            " found." << std::endl;
-        return false;
-    }
-
-    //
-    // Validate IP address
-    //
-    if (!IPv4Address::validateIPAddress(hostAddress))
-    {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Invalid host "\
-            "address found." << std::endl;
-        return false;
-    }
-
-    //
-    // Creates and opens socket
-    //
-    TCPSocket socket;
-    if (!socket.open())
-    {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Could not open "\
-            "socket." << std::endl;
-        return false;
-    }
-
-    //
-    // Connects to host
-    //
-    const int HTTP_PORT = 80;
-    IPv4Address ipAddress(hostAddress, HTTP_PORT);
-    if (!socket.connect(&ipAddress))
-    {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Could not "\
-            "connect to host." << std::endl;
-        return false;
-    }
-
-    //
-    // Send HTTP request to host
-    //
-    const int MAX_HTTP_BUF_LEN = 256;
-    char http_request[MAX_HTTP_BUF_LEN];
-    sprintf_s(http_request, http_request_format, hostName);
-    //std::cout << "HTTP REQUEST\n" << http_request << std::endl;
-    if (!socket.send((unsigned char*)http_request, MAX_HTTP_BUF_LEN))
+    std::ifstream addressFile;
+    addressFile.open(_addressFilePath);
+    if (!addressFile.is_open())
     {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Could not "\
-            "send HTTP request to host." << std::endl;
-        return false;
+        std::cerr << "[ERROR] Window::_loadIPAddresses(): Unable to open "\
+            "file." << std::endl;
+        return ipAddresses;
     }
 
-    //
-    // Receive HTTP response from host
-    //
-    char http_response[MAX_HTTP_BUF_LEN];
-    if (!socket.recv((unsigned char*)http_response, MAX_HTTP_BUF_LEN))
+    std::string ipAddress;
+    while (getline(addressFile, ipAddress))
     {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Could not "\
-            "receive HTTP response from host." << std::endl;
-        return false;
+        if (!ipAddress.empty())
+        {
+            ipAddresses.push_back(ipAddress);
+        }
     }
-    //std::cout << "HTTP RESPONSE\n" << http_response << std::endl;
 
-    //
-    // Find Content-Length header
-    //
-    int pos = 0;
-    std::string httpResponseString(http_response);
-    std::string contentLengthHeader("Content-Length: ");
-    if ((pos = httpResponseString.find(contentLengthHeader)) ==
-        std::string::npos)
-    {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Content-Length "\
-            "header not present in HTTP response." << std::endl;
-        return false;
-    }
-    httpResponseString.erase(0, pos+contentLengthHeader.length());
+    addressFile.close();
+    return ipAddresses;
+}
 
-    //
-    // Get Content-Length value
-    //
-    std::string CRLF("\r\n");
-    if ((pos = httpResponseString.find(CRLF)) == std::string::npos)
-    {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Content-Length "\
-            "value not present in HTTP response." << std::endl;
-        return false;
-    }
-    std::string contentLengthString = httpResponseString.substr(0, pos);
-    int contentLength = atoi(contentLengthString.c_str());
+//*****************************************************************************
+//
+//! Save IP address to file as the most recently connected to, ahead of the
+//! other saved addresses, which keeps the file ranked by recent success.
+//!
+//! \param ipAddress IP address to save.
+//!
+//! \return Returns \b true if the address was saved successfully and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool Window::_saveIPAddress(std::string ipAddress)
+{
+    std::vector<std::string> ipAddresses = _loadIPAddresses();
 
     //
-    // Get HTTP response body
+    // Opens a file stream to save IP addresses to file
     //
-    std::string httpHeaderBodyDelimiter("\r\n\r\n");
-    if ((pos = httpResponseString.find(httpHeaderBodyDelimiter)) ==
-        std::string::npos)
+    std::ofstream addressFile;
+    addressFile.open(_addressFilePath, std::ios::trunc);
+    if (!addressFile.is_open())
     {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): Body not present"\
-            " in HTTP response." << std::endl;
+        std::cerr << "[ERROR] Panel::_saveIPAddress(): Unable to open file."
+            << std::endl;
         return false;
     }
-    httpResponseString.erase(0, pos+httpHeaderBodyDelimiter.length());
-    std::string httpResponseBody = httpResponseString.substr(0, contentLength);
-    std::cout << "HTTP RESPONSE BODY\n" << httpResponseBody << std::endl;
 
     //
-    // Get IP address from HTTP response body
+    // Save IP address to file, followed by the others in their order
     //
-    std::string colonDelimiter(":");
-    if ((pos = httpResponseBody.find(colonDelimiter)) == std::string::npos)
+    addressFile << ipAddress << std::endl;
+    for (unsigned int i=0; i<ipAddresses.size(); i++)
     {
-        std::cout << "[ERROR] Window::_getRemoteIPAddress(): HTTP response "\
-            "body mal-formed." << std::endl;
-        return false;
+        if (ipAddresses[i] != ipAddress)
+        {
+            addressFile << ipAddresses[i] << std::endl;
+        }
     }
-    std::string ipAddressString = httpResponseBody.substr(0, pos);
-    strncpy_s(buf, buflen, ipAddressString.c_str(), buflen);
 
+    addressFile.close();
     return true;
 }
 
@@ -761,27 +866,15 @@ BOOL CALLBACK Window::ConnectDlgProc(HWND hwnd, UINT msg, WPARAM wParam,
     case WM_INITDIALOG:
     {
         //
-        // Opens file stream to read saved IP addresses
+        // Populates combo box with list of saved IP addresses, the most
+        // recently connected to first
         //
-        std::string ipAddress;
-        std::ifstream addressFile;
-        addressFile.open(_addressFilePath);
-        if (!addressFile.is_open())
-        {
-            std::cerr << "[ERROR] Panel::ConnectDlgProc(): Unable to open "\
-                "file." << std::endl;
-            return FALSE;
-        }
-
-        //
-        // Populates combo box with list of saved IP addresses
-        //
-        while (getline(addressFile, ipAddress))
+        std::vector<std::string> ipAddresses = _loadIPAddresses();
+        for (unsigned int i=0; i<ipAddresses.size(); i++)
         {
             SendDlgItemMessage(hwnd, IDC_COMBO, CB_ADDSTRING, 0,
-                (LPARAM)ipAddress.c_str());
+                (LPARAM)ipAddresses[i].c_str());
         }
-        addressFile.close();
 
         //
         // Sets minimum drop down size to 5 elements and centers window
@@ -827,18 +920,12 @@ BOOL CALLBACK Window::ConnectDlgProc(HWND hwnd, UINT msg, WPARAM wParam,
                     }
 
                     //
-                    // Insert IP address into combo box and save IP address if
-                    // it does not exist in combo box already
+                    // Save IP address as the most recently connected to
                     //
-                    if (SendDlgItemMessage(hwnd, IDC_COMBO, CB_FINDSTRINGEXACT,
-                        -1, (LPARAM)addressInput) == CB_ERR)
-                    {
-                        _saveIPAddress(std::string(addressInput));
-                        SendDlgItemMessage(hwnd, IDC_COMBO, CB_ADDSTRING, 0,
-                            (LPARAM)addressInput);
-                    }
+                    _saveIPAddress(std::string(addressInput));
                     EnableMenuItem(_menu, ID_FILE_DISCONNECT, MF_ENABLED);
                     EnableMenuItem(_menu, ID_FILE_CONNECT, MF_GRAYED);
+                    EnableMenuItem(_menu, ID_FILE_QUICK, MF_GRAYED);
                     EndDialog(hwnd, 0);
                 }
                 else
@@ -941,6 +1028,7 @@ void Window::onNotify(int event)
         //
         EnableMenuItem(_menu, ID_FILE_DISCONNECT, MF_GRAYED);
         EnableMenuItem(_menu, ID_FILE_CONNECT, MF_ENABLED);
+        EnableMenuItem(_menu, ID_FILE_QUICK, MF_ENABLED);
         EnableMenuItem(_menu, ID_FILE_AUTO, MF_ENABLED);
 
         //
@@ -972,6 +1060,43 @@ void Window::onNotify(int event)
 
         break;
     }
+    case EVENT_STOP_ROBOT_PLAYBACK:
+    case EVENT_ROBOT_PLAYBACK_FAILED:
+    {
+        //
+        // Event occurs when playback on the robot ends or cannot start
+        //
+        bool failed = (event == EVENT_ROBOT_PLAYBACK_FAILED);
+        CheckMenuItem(_menu, ID_OPTIONS_ROBOTPAUSE, MF_UNCHECKED);
+        EnableMenuItem(_menu, ID_OPTIONS_ROBOTPAUSE, MF_GRAYED);
+        EnableMenuItem(_menu, ID_OPTIONS_ROBOTSTOP, MF_GRAYED);
+
+        //
+        // Creates daemon thread
+        //
+        std::thread messageBoxThread(messageBoxTask, _windowHandle,
+            failed ? "Trajectory could not be played on the robot" :
+            "Robot reached end of trajectory",
+            failed ? "Robot Playback Failed" : "Robot Playback Complete");
+        messageBoxThread.detach();
+
+        break;
+    }
+    case EVENT_RECONNECTING:
+    case EVENT_RECONNECTED:
+    {
+        //
+        // Event occurs when the link drops and when it is back. Disconnect
+        // stays available to stop reconnecting; a reconnect that gives up
+        // is reported as EVENT_DISCONNECTED
+        //
+        EnableMenuItem(_menu, ID_FILE_DISCONNECT, MF_ENABLED);
+        EnableMenuItem(_menu, ID_FILE_CONNECT, MF_GRAYED);
+        EnableMenuItem(_menu, ID_FILE_QUICK, MF_GRAYED);
+        EnableMenuItem(_menu, ID_FILE_AUTO, MF_GRAYED);
+
+        break;
+    }
     default:
         break;
     }
@@ -44,20 +44,17 @@
 #include "uart_if.h"
 #endif
 #include "i2c_if.h"
-
-#include "timer.h"
+#include "i2c_queue_if.h"
+#include "timebase_if.h"
 
 
 #define FAILURE                 -1
 #define SUCCESS                 0
-#define SYS_CLK                 80000000
-#define PRESCALE				255UL
-#define MILLISECONDS_TO_TICKS(ms)   (((SYS_CLK/PRESCALE -1)/1000) * (ms))
 
 /* HELPER FUNCTION */
+static uint16_t buildConfig(unsigned int channel);
 static int writeRegister(uint8_t i2cAddress, uint8_t reg, uint16_t value);
 static int16_t readRegister(uint8_t i2cAddress, uint8_t reg);
-static void delay(int time_ms);
 
 //****************************************************************************
 //
@@ -70,8 +67,105 @@ static void delay(int time_ms);
 //****************************************************************************
 unsigned short readADC_Breakout(unsigned int channel)
 {
-    if (channel > 3) return 0; // channel is from 0 to 3
+    if (startADC_Breakout(channel) != SUCCESS) return 0;
+
+    // Wait for the conversion to complete
+    Timebase_Delay(ADS1015_CONVERSIONDELAY*1000);
 
+    return readADCResult_Breakout();
+}
+//****************************************************************************
+//
+//! Starts a single-shot conversion on the channel specified in variable
+//! channel. The result is available ADS1015_CONVERSIONDELAY ms later through
+//! readADCResult_Breakout().
+//!
+//! \param channel: decimal value from 0 to 3 
+//!
+//! \return 0: SUCCESS; <0 Failure
+//
+//****************************************************************************
+int startADC_Breakout(unsigned int channel)
+{
+    if (channel > 3) return FAILURE; // channel is from 0 to 3
+
+    // Write config register to the ADC
+    return writeRegister(ADS1015_ADDRESS, ADS1015_REG_POINTER_CONFIG, buildConfig(channel));
+}
+//****************************************************************************
+//
+//! Queues the start of a single-shot conversion on the channel specified in
+//! variable channel, without waiting for the bus. Safe to call from
+//! interrupt context.
+//!
+//! \param channel: decimal value from 0 to 3 
+//! \param pfnDone: called from the I2C interrupt once the config is written
+//! \param pvArg: passed to pfnDone
+//!
+//! \return 0: SUCCESS; <0 Failure
+//
+//****************************************************************************
+int startADCAsync_Breakout(unsigned int channel, I2C_Callback pfnDone, void *pvArg)
+{
+    unsigned char DataBuf[3];
+    uint16_t config;
+
+    if (channel > 3) return FAILURE; // channel is from 0 to 3
+
+    config = buildConfig(channel);
+    DataBuf[0] = (unsigned char)ADS1015_REG_POINTER_CONFIG;
+    DataBuf[1] = (unsigned char)(config>>8);
+    DataBuf[2] = (unsigned char)(config & 0xFF);
+
+    return I2C_Queue_Submit(ADS1015_ADDRESS, DataBuf, 3, 0, pfnDone, pvArg);
+}
+//****************************************************************************
+//
+//! Queues a read of the last conversion result, without waiting for the
+//! bus. pfnDone receives the two raw bytes of the conversion register, which
+//! convertADCResult_Breakout() turns into a reading. Safe to call from
+//! interrupt context.
+//!
+//! \param pfnDone: called from the I2C interrupt with the result
+//! \param pvArg: passed to pfnDone
+//!
+//! \return 0: SUCCESS; <0 Failure
+//
+//****************************************************************************
+int readADCResultAsync_Breakout(I2C_Callback pfnDone, void *pvArg)
+{
+    unsigned char DataBuf[1];
+
+    DataBuf[0] = (unsigned char)ADS1015_REG_POINTER_CONVERT;
+
+    return I2C_Queue_Submit(ADS1015_ADDRESS, DataBuf, 1, 2, pfnDone, pvArg);
+}
+//****************************************************************************
+//
+//! Converts the raw conversion register into a reading
+//!
+//! \param pucData: the two bytes read from the conversion register
+//!
+//! \return the results from ADC reading
+//
+//****************************************************************************
+unsigned short convertADCResult_Breakout(const unsigned char *pucData)
+{
+    // Shift 12-bit results right 4 bits for the ADS1015
+    return (unsigned short)(((pucData[0] << 8) | pucData[1]) >> 4);
+}
+//****************************************************************************
+//
+//! Builds the config register value that starts a single-shot conversion on
+//! a channel
+//!
+//! \param channel: decimal value from 0 to 3 
+//!
+//! \return config register value
+//
+//****************************************************************************
+static uint16_t buildConfig(unsigned int channel)
+{
     //Configurate default value
     uint16_t config =   ADS1015_REG_CONFIG_CQUE_NONE    | // Disable the comparator (default val)
                         ADS1015_REG_CONFIG_CLAT_NONLAT  | // Non-latching (default val)
@@ -104,12 +198,19 @@ unsigned short readADC_Breakout(unsigned int channel)
     // Set 'start single-conversion' bit
     config |= ADS1015_REG_CONFIG_OS_SINGLE;
 
-    // Write config register to the ADC
-    writeRegister(ADS1015_ADDRESS, ADS1015_REG_POINTER_CONFIG, config);
-
-    // Wait for the conversion to complete
-    delay(ADS1015_CONVERSIONDELAY);
-
+    return config;
+}
+//****************************************************************************
+//
+//! Reads the result of the last conversion started by startADC_Breakout()
+//!
+//! \param None
+//!
+//! \return the results from ADC reading
+//
+//****************************************************************************
+unsigned short readADCResult_Breakout(void)
+{
     // Read the conversion results
     // Shift 12-bit results right 4 bits for the ADS1015
     return readRegister(ADS1015_ADDRESS, ADS1015_REG_POINTER_CONVERT) >> 4;  
@@ -139,7 +240,7 @@ static int writeRegister(uint8_t i2cAddress, uint8_t reg, uint16_t value)
     DataBuf[2] = (unsigned char)(value & 0xFF);
 
     // Write the data to the specified address
-    iRetVal = I2C_IF_Write((unsigned char)i2cAddress, DataBuf, 3, 1);
+    iRetVal = I2C_Queue_Transfer((unsigned char)i2cAddress, DataBuf, 3, NULL, 0);
 
     if(iRetVal == SUCCESS)
     {
@@ -174,17 +275,8 @@ static int16_t readRegister(uint8_t i2cAddress, uint8_t reg)
     //Construct the data buffer
     DataBuf[0] = (unsigned char) ADS1015_REG_POINTER_CONVERT;
 
-    //Send command to the ADC board
-    iRetVal = I2C_IF_Write((unsigned char)i2cAddress, DataBuf, 1, 1);
-    if(iRetVal == FAILURE)
-    {
-        #ifdef ADC_DEBUG
-        UART_PRINT("I2C Read failed\n\r");
-        #endif
-        return FAILURE;
-    }
-    //Read the value from the register
-    iRetVal = I2C_IF_Read((unsigned char)i2cAddress, DataBuf, 2);
+    //Send the register address, then read the value from the register
+    iRetVal = I2C_Queue_Transfer((unsigned char)i2cAddress, DataBuf, 1, DataBuf, 2);
     if(iRetVal == SUCCESS)
     {
         #ifdef ADC_DEBUG
@@ -200,40 +292,6 @@ static int16_t readRegister(uint8_t i2cAddress, uint8_t reg)
         return FAILURE;
     }
 }
-//****************************************************************************
-//
-//! The delay function uses timer to implement the delay time in milliseconds
-//!
-//! \param time in millisecond
-//
-//!  \return void
-//****************************************************************************
-static void delay(int time_ms)
-{
-    // Initialize Timer 0B as one-shot down counter.
-    MAP_PRCMPeripheralClkEnable(PRCM_TIMERA0, PRCM_RUN_MODE_CLK);
-    MAP_PRCMPeripheralReset(PRCM_TIMERA0);
-    MAP_TimerConfigure(TIMERA0_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_B_ONE_SHOT);
-    MAP_TimerPrescaleSet(TIMERA0_BASE, TIMER_B, PRESCALE);
-    //Load the value in milisecond
-    MAP_TimerLoadSet(TIMERA0_BASE, TIMER_B, MILLISECONDS_TO_TICKS(time_ms));
-    // Enable the timer
-    MAP_TimerEnable(TIMERA0_BASE, TIMER_B);
-    //Stall during debug
-    MAP_TimerControlStall(TIMERA0_BASE, TIMER_B, 1);
-    // Enable interrupt upon Time-out
-    MAP_TimerIntEnable(TIMERA0_BASE, TIMER_TIMB_TIMEOUT);
-    // Clear Interrupt Flag
-    MAP_TimerIntClear(TIMERA0_BASE, MAP_TimerIntStatus(TIMERA0_BASE, true));
-    //Wait until timer time-out
-    while (MAP_TimerIntStatus(TIMERA0_BASE, true) != TIMER_TIMB_TIMEOUT){}
-    //Disable the timer
-    MAP_TimerDisable(TIMERA0_BASE, TIMER_B);
-    //Disable Interrupt
-    MAP_TimerIntDisable(TIMERA0_BASE, TIMER_TIMB_TIMEOUT);
-    MAP_TimerIntUnregister(TIMERA0_BASE, TIMER_B);
-}
-
 //*****************************************************************************
 //
 // Copyright (C) 2014 Texas Instruments Incorporated - http://www.ti.com/ 
@@ -36,10 +36,17 @@
 #include "utils.h"
 #include "uart.h"
 
+#include "i2c_queue_if.h"
+
 //******************************************************************************
 //                      Interface Functions
 //******************************************************************************
 unsigned short readADC_Breakout(unsigned int channel); //take an ADC reading, channel is 0 to 3
+int startADC_Breakout(unsigned int channel); //start a single-shot conversion, channel is 0 to 3
+unsigned short readADCResult_Breakout(void); //read the result of the last conversion
+int startADCAsync_Breakout(unsigned int channel, I2C_Callback pfnDone, void *pvArg); //queue the start of a conversion
+int readADCResultAsync_Breakout(I2C_Callback pfnDone, void *pvArg); //queue a read of the last conversion
+unsigned short convertADCResult_Breakout(const unsigned char *pucData); //convert the raw conversion register
 
 //******************************************************************************
 //                          Constants
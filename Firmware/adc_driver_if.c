@@ -51,6 +51,8 @@
 
 #define FOREVER 1
 
+static unsigned int GetSensorChannel_CC3200(enum Fingertip_Sensor_Type eFingerSensor);
+
 //****************************************************************************
 // Initializes the Sensor ADCs for operation
 //
@@ -109,22 +111,10 @@ unsigned short GetSensorReading_CC3200(enum Fingertip_Sensor_Type eFingerSensor)
 #endif
 
     // Convert pin number to channel number
-    switch(eFingerSensor)
+    uiChannel = GetSensorChannel_CC3200(eFingerSensor);
+    if (uiChannel == ADC_CH_INVALID)
     {
-        case SENSOR_FINGER_INDEX:
-            uiChannel = ADC_CH_0;    // Pin_57
-            break;
-        case SENSOR_FINGER_THUMB:
-            uiChannel = ADC_CH_1;    // Pin_58
-            break;
-        case SENSOR_FINGER_MIDDLE:
-            uiChannel = ADC_CH_2;    // Pin_59
-            break;
-        case SENSOR_FINGER_RING:
-            uiChannel = ADC_CH_3;    // Pin_60
-            break;
-        default:
-            return (unsigned short) 0;
+        return (unsigned short) 0;
     }
 
     // Initialize Counter and Sum of Samples to 0
@@ -143,6 +133,43 @@ unsigned short GetSensorReading_CC3200(enum Fingertip_Sensor_Type eFingerSensor)
     return (unsigned short) ulSampleTotal/NO_OF_SAMPLES;
 }
 
+//*****************************************************************************
+// Gets the Sensor Reading from Finger-Tip sensors using ADC from CC3200
+// without waiting on the FIFO. Safe to call from interrupt context.
+//
+// \param eFinger -> finger type (ex: FINGER_THUMB, FINGER_INDEX, etc)
+// \param pusReading -> receives the raw ADC value between 0 to 4096
+//
+// \return true if enough samples were available, false otherwise (in which
+//          case pusReading is left untouched)
+//*****************************************************************************
+tBoolean PollSensorReading_CC3200(enum Fingertip_Sensor_Type eFingerSensor, unsigned short *pusReading)
+{
+    unsigned int uiChannel;
+    unsigned char ucCount;
+    unsigned long ulSampleTotal;
+
+    uiChannel = GetSensorChannel_CC3200(eFingerSensor);
+    if (uiChannel == ADC_CH_INVALID)
+    {
+        return false;
+    }
+
+    if (MAP_ADCFIFOLvlGet(ADC_BASE, uiChannel) < NO_OF_SAMPLES)
+    {
+        return false;
+    }
+
+    ulSampleTotal = 0;
+    for (ucCount = 0; ucCount < NO_OF_SAMPLES; ucCount++)
+    {
+        ulSampleTotal += (MAP_ADCFIFORead(ADC_BASE, uiChannel) >> 2) & 0x0FFF;
+    }
+
+    *pusReading = (unsigned short) (ulSampleTotal/NO_OF_SAMPLES);
+    return true;
+}
+
 //*****************************************************************************
 // Gets the Sensor Reading from Finger-Tip sensors using ADC
 // Either from Breakout ADC board or CC3200 ADC
@@ -170,6 +197,30 @@ unsigned short GetSensorReading(enum Fingertip_Sensor_Type eFingerSensor)
 	}
 }
 
+//*****************************************************************************
+// Converts a finger-tip sensor to the CC3200 ADC channel it is wired to
+//
+// \param eFinger -> finger type (ex: FINGER_THUMB, FINGER_INDEX, etc)
+//
+// \return ADC channel, or ADC_CH_INVALID if the finger has no CC3200 channel
+//*****************************************************************************
+static unsigned int GetSensorChannel_CC3200(enum Fingertip_Sensor_Type eFingerSensor)
+{
+    switch(eFingerSensor)
+    {
+        case SENSOR_FINGER_INDEX:
+            return ADC_CH_0;    // Pin_57
+        case SENSOR_FINGER_THUMB:
+            return ADC_CH_1;    // Pin_58
+        case SENSOR_FINGER_MIDDLE:
+            return ADC_CH_2;    // Pin_59
+        case SENSOR_FINGER_RING:
+            return ADC_CH_3;    // Pin_60
+        default:
+            return ADC_CH_INVALID;
+    }
+}
+
 //*****************************************************************************
 // Converts raw ADC value (0 to 4096) to the associated voltage (0 to 1.4V)
 //
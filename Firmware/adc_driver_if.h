@@ -19,12 +19,17 @@
 //
 //*****************************************************************************
 
+#include "hw_types.h"
+
 // Defines number of sensors
 #define NUM_SENSORS 5
 
 // Defines number of samples for averaging ADC reading
 #define NO_OF_SAMPLES 2
 
+// Returned when a sensor is not wired to a CC3200 ADC channel
+#define ADC_CH_INVALID 0xFFFFFFFF
+
 // Channel mapping for Breakout Board
 //#define FINGER_INDEX_BREAKOUT 0
 #define FINGER_THUMB_BREAKOUT 0
@@ -57,6 +62,12 @@ void DisableSensorADC(void);
 //*****************************************************************************
 unsigned short GetSensorReading_CC3200(enum Fingertip_Sensor_Type eFingerSensor);
 
+//*****************************************************************************
+// Gets the Sensor Reading from Finger-Tip sensors using ADC on CC3200 without
+// waiting for the FIFO. Returns false if not enough samples are available yet
+//*****************************************************************************
+tBoolean PollSensorReading_CC3200(enum Fingertip_Sensor_Type eFingerSensor, unsigned short *pusReading);
+
 //*****************************************************************************
 // Gets the Sensor Reading from Finger-Tip sensors using ADC
 // Either from Breakout ADC board or CC3200 ADC
@@ -0,0 +1,264 @@
+//*****************************************************************************
+//
+// control_task_if.c
+//
+// Control task. Owns the hand: it initializes the I2C bus, servos and
+// sensors, and is the only task that starts, stops or feeds the force
+// controller and the jitter buffer. Commands arrive on a message queue from
+// the network task, so a slow or blocked network never delays them, and the
+// task runs above the network tasks so a queued command is applied before
+// the next packet is handled.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <string.h>
+
+// Driverlib includes
+#include "hw_types.h"
+
+// OS includes
+#include "osi.h"
+
+// Common interface includes
+#include "common.h"
+#ifndef NOTERM
+#include "uart_if.h"
+#endif
+
+#include "i2c_if.h"
+#include "i2c_queue_if.h"
+#include "pwm_break_out_if.h"
+#include "adc_break_out_if.h"
+#include "servo_driver_if.h"
+#include "adc_driver_if.h"
+#include "sensor_sampler_if.h"
+#include "force_controller_if.h"
+#include "jitter_buffer_if.h"
+#include "trajectory_if.h"
+#include "control_task_if.h"
+
+static OsiMsgQ_t g_ControlQueue;
+
+// Mode the hand is run in, HIRCP_INVALID_MODE while no connection is up
+static unsigned char g_ucMode = HIRCP_INVALID_MODE;
+
+static void ControlTask(void *pvParameters);
+static void InitHardware(void);
+static void HandleMessage(const struct ControlMessage *pMsg);
+static void SetMode(unsigned char ucMode);
+
+//****************************************************************************
+//
+//! Creates the command queue and the task
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void InitControlTask(void)
+{
+    long lRetVal;
+
+    lRetVal = osi_MsgQCreate(&g_ControlQueue, "ControlQueue",
+                             sizeof(struct ControlMessage), CONTROL_QUEUE_LEN);
+    if (lRetVal != OSI_OK)
+    {
+        UART_PRINT("Control queue creation failed\n\r");
+        LOOP_FOREVER();
+    }
+
+    lRetVal = osi_TaskCreate(ControlTask, (const signed char *)"Control",
+                             CONTROL_TASK_STACK_SIZE, NULL,
+                             CONTROL_TASK_PRIORITY, NULL);
+    if (lRetVal != OSI_OK)
+    {
+        UART_PRINT("Control task creation failed\n\r");
+        LOOP_FOREVER();
+    }
+}
+
+//****************************************************************************
+//
+//! Queues a command for the control task
+//!
+//! \param eType is the command
+//! \param pucPayload holds HIRCP_MAX_PAYLOAD_LEN bytes, or is NULL for none
+//!
+//! \return SUCCESS, or FAILURE if the command could not be queued
+//
+//****************************************************************************
+int PostControlMessage(enum Control_Message_Type eType, const unsigned char *pucPayload)
+{
+    struct ControlMessage msg;
+
+    msg.ucType = (unsigned char)eType;
+    if (pucPayload != NULL)
+    {
+        memcpy(msg.ucPayload, pucPayload, HIRCP_MAX_PAYLOAD_LEN);
+    }
+    else
+    {
+        memset(msg.ucPayload, 0, HIRCP_MAX_PAYLOAD_LEN);
+    }
+
+    return (osi_MsgQWrite(&g_ControlQueue, &msg, OSI_WAIT_FOREVER) == OSI_OK) ?
+           SUCCESS : FAILURE;
+}
+
+//****************************************************************************
+//
+//! Task entry. Brings up the hardware, then applies commands as they come.
+//!
+//! \param pvParameters is unused
+//!
+//! \return Never returns
+//
+//****************************************************************************
+static void ControlTask(void *pvParameters)
+{
+    struct ControlMessage msg;
+
+    InitHardware();
+
+    while (TRUE)
+    {
+        if (osi_MsgQRead(&g_ControlQueue, &msg, OSI_WAIT_FOREVER) == OSI_OK)
+        {
+            HandleMessage(&msg);
+        }
+    }
+}
+
+//****************************************************************************
+//
+//! Initializes the I2C bus, servos and sensors. Runs in the task because
+//! the drivers wait on the timebase, which needs the scheduler running.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void InitHardware(void)
+{
+    // Configure I2C, transfers are queued and run from the I2C interrupt
+    I2C_IF_Open(I2C_MASTER_MODE_STD);
+    I2C_Queue_Open();
+    I2C_Queue_SetDeviceMode(PWM_ADDRESS, I2C_MASTER_MODE_FST);
+    I2C_Queue_SetDeviceMode(ADS1015_ADDRESS, I2C_MASTER_MODE_FST);
+
+    // Initialize the PWM outputs on the board
+    InitServos_PWM_Breakout();
+
+    // Initialize the sensor ADC
+    InitSensorADC();
+
+    // Start sampling the sensors in the background
+    InitSensorSampler();
+
+    // Set up the closed-loop force controller, run while in closed-loop mode
+    // and as a force limiter in hybrid mode
+    InitForceController();
+
+    // Set up pose playback, run while in normal mode
+    InitJitterBuffer();
+}
+
+//****************************************************************************
+//
+//! Applies a command
+//!
+//! \param pMsg is the command
+//!
+//! \return None
+//
+//****************************************************************************
+static void HandleMessage(const struct ControlMessage *pMsg)
+{
+    switch (pMsg->ucType)
+    {
+        case CONTROL_START:
+        case CONTROL_MODE:
+            SetMode(pMsg->ucPayload[0]);
+            break;
+        case CONTROL_STOP:
+            // Fingers hold their position until the next connection
+            SetMode(HIRCP_INVALID_MODE);
+            break;
+        case CONTROL_POSE:
+            // Queues the pose, the servos are moved on the next PWM periods.
+            // An uploaded trajectory being played takes precedence.
+            if ((g_ucMode == HIRCP_NORMAL || g_ucMode == HIRCP_HYBRID) &&
+                !IsTrajectoryActive())
+            {
+                PushJitterBuffer(pMsg->ucPayload);
+            }
+            break;
+        case CONTROL_FSET:
+            UnpackForceSetpoints(pMsg->ucPayload);
+            break;
+        default:
+            UART_PRINT("[ControlTask] Invalid command\n\r");
+            break;
+    }
+}
+
+//****************************************************************************
+//
+//! Switches between pose playback, the force controller, and pose playback
+//! under the force limiter
+//!
+//! \param ucMode is HIRCP_NORMAL, HIRCP_CLOSED_LOOP, HIRCP_HYBRID, or
+//!        HIRCP_INVALID_MODE to stop all of them
+//!
+//! \return None
+//
+//****************************************************************************
+static void SetMode(unsigned char ucMode)
+{
+    if (ucMode == g_ucMode)
+    {
+        return;
+    }
+
+    if (g_ucMode == HIRCP_CLOSED_LOOP || g_ucMode == HIRCP_HYBRID)
+    {
+        StopForceController();
+    }
+    if (g_ucMode == HIRCP_NORMAL || g_ucMode == HIRCP_HYBRID)
+    {
+        // Trajectories are played by the jitter buffer tick
+        StopTrajectory();
+        StopJitterBuffer();
+    }
+
+    if (ucMode == HIRCP_CLOSED_LOOP)
+    {
+        StartForceController();
+    }
+    else if (ucMode == HIRCP_NORMAL)
+    {
+        StartJitterBuffer();
+    }
+    else if (ucMode == HIRCP_HYBRID)
+    {
+        // Playback first, it resets the servo ceilings the limiter sets
+        StartJitterBuffer();
+        StartForceLimiter();
+    }
+
+    g_ucMode = ucMode;
+}
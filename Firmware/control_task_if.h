@@ -0,0 +1,60 @@
+#ifndef __CONTROL_TASK_IF_H__
+#define __CONTROL_TASK_IF_H__
+//*****************************************************************************
+//
+// control_task_if.h
+//
+// Header file for the control task. The task brings up the servo and sensor
+// hardware, then applies the commands the network task posts to its queue:
+// connection start and stop, mode changes, poses and force setpoints. The
+// servos and sensors themselves are paced by their timer interrupts.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hircp.h"
+
+// Highest of the application tasks, below the SimpleLink spawn task
+#define CONTROL_TASK_PRIORITY       3
+#define CONTROL_TASK_STACK_SIZE     2048
+
+// Commands that can wait for the task
+#define CONTROL_QUEUE_LEN           8
+
+enum Control_Message_Type {
+    CONTROL_START = 1,          // Connection started, payload[0] is the HIRCP mode
+    CONTROL_STOP,               // Connection ended
+    CONTROL_MODE,               // Mode change, payload[0] is the HIRCP mode
+    CONTROL_POSE,               // DATA payload
+    CONTROL_FSET                // FSET payload
+};
+
+struct ControlMessage {
+    unsigned char ucType;
+    unsigned char ucPayload[HIRCP_MAX_PAYLOAD_LEN];
+};
+
+//****************************************************************************
+// Creates the command queue and the task. The task initializes the servo
+// and sensor hardware once the scheduler starts.
+//****************************************************************************
+void InitControlTask(void);
+
+//****************************************************************************
+// Queues a command for the task, waiting for room if the queue is full.
+// pucPayload holds HIRCP_MAX_PAYLOAD_LEN bytes, or is NULL for none.
+// Must be called from a task.
+//****************************************************************************
+int PostControlMessage(enum Control_Message_Type eType, const unsigned char *pucPayload);
+
+#endif //  __CONTROL_TASK_IF_H__
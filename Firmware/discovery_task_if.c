@@ -0,0 +1,213 @@
+//*****************************************************************************
+//
+// discovery_task_if.c
+//
+// Discovery task. Replaces looking the robot up through the rendezvous web
+// server: every DISCOVERY_PERIOD_MS the task broadcasts a BEACON packet
+// (see hircp_specifications_rev2.txt, Section 3.9) carrying the robot ID,
+// the address and port of the TCP server, and what the firmware supports.
+// Controllers keep a table of the robots they hear from, so connecting
+// needs no lookup.
+//
+// The robot ID is the end of the MAC address, so it survives restarts and
+// new addresses from the access point. Beacons go on while a connection is
+// served, with the busy bit set, so controllers still see the robot.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <string.h>
+
+// simplelink includes
+#include "simplelink.h"
+
+// Driverlib includes
+#include "hw_types.h"
+
+// OS includes
+#include "osi.h"
+
+// Common interface includes
+#include "common.h"
+#ifndef NOTERM
+#include "uart_if.h"
+#endif
+
+#include "tcp_socket.h"
+#include "hircp.h"
+#include "discovery_task_if.h"
+
+// Everything the firmware supports, before the busy bit
+#define DISCOVERY_CAPABILITIES  (HIRCP_CAPABILITY_TIMED_DACK | \
+                                 HIRCP_CAPABILITY_HYBRID | \
+                                 HIRCP_CAPABILITY_TRAJECTORY)
+
+static int g_iBeaconSockID = -1;
+static unsigned short g_usRobotId = 0;
+static volatile tBoolean g_bBusy = false;
+static HIRCP_Packet *g_pBeaconPacket;
+
+static void DiscoveryTask(void *pvParameters);
+static unsigned short ReadRobotId(void);
+static void BuildBeacon(unsigned char *pucBeacon);
+
+//****************************************************************************
+//
+//! Opens the beacon socket and starts the discovery task
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void StartDiscovery(void)
+{
+    long lRetVal;
+
+    g_pBeaconPacket = HIRCP_CreatePacket();
+    g_usRobotId = ReadRobotId();
+
+    g_iBeaconSockID = sl_Socket(SL_AF_INET, SL_SOCK_DGRAM, SL_IPPROTO_UDP);
+    if (g_iBeaconSockID < 0)
+    {
+        UART_PRINT("Discovery socket creation failed\n\r");
+        return;
+    }
+
+    lRetVal = osi_TaskCreate(DiscoveryTask, (const signed char *)"Discovery",
+                             DISCOVERY_TASK_STACK_SIZE, NULL,
+                             DISCOVERY_TASK_PRIORITY, NULL);
+    if (lRetVal != OSI_OK)
+    {
+        UART_PRINT("Discovery task creation failed\n\r");
+        sl_Close(g_iBeaconSockID);
+        g_iBeaconSockID = -1;
+        return;
+    }
+
+    UART_PRINT("BROADCASTING BEACONS AS ROBOT %04x TO PORT: %d.\n\r",
+               g_usRobotId, HIRCP_BEACON_PORT);
+}
+
+//****************************************************************************
+//
+//! Sets whether beacons advertise the robot as busy
+//!
+//! \param bBusy is true while a connection is served
+//!
+//! \return None
+//
+//****************************************************************************
+void SetDiscoveryBusy(tBoolean bBusy)
+{
+    g_bBusy = bBusy;
+}
+
+//****************************************************************************
+//
+//! Discovery task entry. Broadcasts a beacon every DISCOVERY_PERIOD_MS.
+//!
+//! \param pvParameters is unused
+//!
+//! \return Never returns
+//
+//****************************************************************************
+static void DiscoveryTask(void *pvParameters)
+{
+    SlSockAddrIn_t sAddr;
+    unsigned char ucBeacon[HIRCP_MAX_PACKET_LEN];
+    tBoolean bReported = false;
+    long lRetVal;
+
+    sAddr.sin_family = SL_AF_INET;
+    sAddr.sin_port = sl_Htons(HIRCP_BEACON_PORT);
+    sAddr.sin_addr.s_addr = sl_Htonl(DISCOVERY_BROADCAST_ADDR);
+
+    while (TRUE)
+    {
+        BuildBeacon(ucBeacon);
+        lRetVal = sl_SendTo(g_iBeaconSockID, ucBeacon, HIRCP_MAX_PACKET_LEN, 0,
+                            (SlSockAddr_t *)&sAddr, sizeof(SlSockAddrIn_t));
+
+        // A lost beacon is made up for by the next one. Failures are only
+        // reported once so they do not flood the terminal.
+        if (lRetVal < 0 && !bReported)
+        {
+            UART_PRINT("Beacon not sent: %ld\n\r", lRetVal);
+            bReported = true;
+        }
+        else if (lRetVal >= 0)
+        {
+            bReported = false;
+        }
+
+        osi_Sleep(DISCOVERY_PERIOD_MS);
+    }
+}
+
+//****************************************************************************
+//
+//! Reads the robot ID from the last two bytes of the MAC address
+//!
+//! \param None
+//!
+//! \return Robot ID, 0 if the MAC address could not be read
+//
+//****************************************************************************
+static unsigned short ReadRobotId(void)
+{
+    unsigned char ucMac[SL_MAC_ADDR_LEN];
+    unsigned char ucLen = SL_MAC_ADDR_LEN;
+
+    if (sl_NetCfgGet(SL_MAC_ADDRESS_GET, NULL, &ucLen, ucMac) < 0)
+    {
+        return 0;
+    }
+
+    return (unsigned short)((ucMac[SL_MAC_ADDR_LEN-2] << 8) |
+                            ucMac[SL_MAC_ADDR_LEN-1]);
+}
+
+//****************************************************************************
+//
+//! Builds a BEACON packet from the current state of the robot
+//!
+//! \param pucBeacon receives HIRCP_MAX_PACKET_LEN bytes
+//!
+//! \return None
+//
+//****************************************************************************
+static void BuildBeacon(unsigned char *pucBeacon)
+{
+    unsigned char ucPayload[HIRCP_MAX_PAYLOAD_LEN];
+    unsigned long ulIpAddr = WlanGetIpAddress();
+    unsigned short usPort = BsdTcpServerPort();
+
+    ucPayload[0] = HIRCP_BEACON_VERSION;
+    ucPayload[1] = (unsigned char)(g_usRobotId >> 8);
+    ucPayload[2] = (unsigned char)g_usRobotId;
+    ucPayload[3] = (unsigned char)(ulIpAddr >> 24);
+    ucPayload[4] = (unsigned char)(ulIpAddr >> 16);
+    ucPayload[5] = (unsigned char)(ulIpAddr >> 8);
+    ucPayload[6] = (unsigned char)ulIpAddr;
+    ucPayload[7] = (unsigned char)(usPort >> 8);
+    ucPayload[8] = (unsigned char)usPort;
+    ucPayload[9] = DISCOVERY_CAPABILITIES |
+                   (g_bBusy ? HIRCP_CAPABILITY_BUSY : 0);
+
+    HIRCP_ClearPacket(g_pBeaconPacket);
+    HIRCP_SetType(g_pBeaconPacket, HIRCP_BEACON);
+    HIRCP_SetPayload(g_pBeaconPacket, ucPayload, HIRCP_MAX_PAYLOAD_LEN);
+    HIRCP_GetData(g_pBeaconPacket, pucBeacon, HIRCP_MAX_PACKET_LEN);
+}
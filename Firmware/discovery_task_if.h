@@ -0,0 +1,50 @@
+#ifndef __DISCOVERY_TASK_IF_H__
+#define __DISCOVERY_TASK_IF_H__
+//*****************************************************************************
+//
+// discovery_task_if.h
+//
+// Header file for the discovery task. Once the server is listening the task
+// broadcasts a HIRCP BEACON packet over UDP every second, so controller
+// applications on the local network can find the robot without knowing its
+// address.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+
+// Shares the lowest priority with the receive task. The task spends nearly
+// all its time asleep.
+#define DISCOVERY_TASK_PRIORITY     1
+#define DISCOVERY_TASK_STACK_SIZE   1024
+
+// Time between beacons. Controllers forget a robot after three missed ones.
+#define DISCOVERY_PERIOD_MS         1000
+
+// Where beacons are sent, in host byte order
+#define DISCOVERY_BROADCAST_ADDR    0xFFFFFFFF
+
+//****************************************************************************
+// Opens the beacon socket and starts the discovery task. Must be called
+// once, after the TCP server is listening. The robot stays reachable by
+// address if this fails.
+//****************************************************************************
+void StartDiscovery(void);
+
+//****************************************************************************
+// Sets whether beacons advertise the robot as busy serving a connection
+//****************************************************************************
+void SetDiscoveryBusy(tBoolean bBusy);
+
+#endif //  __DISCOVERY_TASK_IF_H__
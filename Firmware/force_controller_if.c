@@ -0,0 +1,430 @@
+//*****************************************************************************
+//
+// force_controller_if.c
+//
+// Closed-loop finger force controller. Every FORCE_CONTROLLER_PERIOD_MS a
+// timer interrupt takes the latest sensor snapshot and runs a PI loop per
+// finger on the pressure error, the reading minus the setpoint. A positive
+// error (too little pressure) closes the finger, a negative one opens it.
+//
+// The output is the finger position in fixed-point degrees. The integrator
+// is held while the output is saturated in the direction of the error and is
+// clamped to the finger's travel, so a finger that cannot reach its setpoint
+// does not wind up. Servos are only written when the whole-degree position
+// changes, on the I2C queue, so the interrupt never waits on the bus.
+//
+// The same loop can instead run as a force limiter while pose playback moves
+// the fingers. The setpoints are then limits: the loop output is a ceiling
+// on the finger position rather than the position itself. While a finger
+// presses no harder than its limit the ceiling rises out of the way; once it
+// presses harder the ceiling drops to where the finger is, stopping it on
+// the next tick, and keeps backing it off until the pressure is back under
+// the limit.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Driverlib includes
+#include "hw_types.h"
+#include "hw_ints.h"
+#include "hw_memmap.h"
+#include "rom.h"
+#include "rom_map.h"
+#include "timer.h"
+#include "prcm.h"
+
+// Common interface includes
+#include "common.h"
+#include "timer_if.h"
+
+#include "servo_driver_if.h"
+#include "adc_driver_if.h"
+#include "sensor_sampler_if.h"
+#include "profiler_if.h"
+#include "force_controller_if.h"
+
+// Position of a finger's servo as the loop left it
+struct ForceState {
+    long lIntegral;                     // Integrator, fixed-point degrees
+    unsigned char ucDegrees;            // Last position written to the servo
+};
+
+static const unsigned short g_usDefaultSetpoint[NUM_FINGERS] = {
+    FORCE_SETPOINT_THUMB,
+    FORCE_SETPOINT_INDEX,
+    FORCE_SETPOINT_MIDDLE,
+    FORCE_SETPOINT_RING,
+    FORCE_SETPOINT_PINKY
+};
+
+static volatile unsigned short g_usSetpoint[NUM_FINGERS];
+static volatile struct ForceGains g_Gains[NUM_FINGERS];
+static struct ForceState g_State[NUM_FINGERS];
+
+// Whether the loop limits pose playback instead of positioning the fingers
+static volatile tBoolean g_bLimiting = false;
+
+static void ForceControllerIntHandler(void);
+static void UpdateFinger(unsigned char ucFinger, unsigned short usReading);
+static void LimitFinger(unsigned char ucFinger, unsigned short usReading);
+
+//****************************************************************************
+//
+//! Resets setpoints, gains and finger positions to their defaults. The
+//! sensor sampler must be started first.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void InitForceController(void)
+{
+    unsigned char i;
+
+    for (i = 0; i < NUM_FINGERS; i++)
+    {
+        g_usSetpoint[i] = g_usDefaultSetpoint[i];
+        g_Gains[i].sKp = FORCE_DEFAULT_KP;
+        g_Gains[i].sKi = FORCE_DEFAULT_KI;
+        g_State[i].lIntegral = 0;
+        g_State[i].ucDegrees = 0;
+    }
+
+    Timer_IF_Init(FORCE_CONTROLLER_TIMER_PRCM, FORCE_CONTROLLER_TIMER_BASE,
+                  TIMER_CFG_PERIODIC, FORCE_CONTROLLER_TIMER, 0);
+    Timer_IF_IntSetup(FORCE_CONTROLLER_TIMER_BASE, FORCE_CONTROLLER_TIMER,
+                      ForceControllerIntHandler);
+}
+
+//****************************************************************************
+//
+//! Starts running the loop. Fingers continue from where the servos were
+//! left, so starting the loop does not step them.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void StartForceController(void)
+{
+    unsigned char i;
+
+    // Bumpless start: the integrator alone holds the current position
+    for (i = 0; i < NUM_FINGERS; i++)
+    {
+        g_State[i].ucDegrees = GetServoPosition_PWM_Breakout((enum Servo_Joint_Type)i);
+        g_State[i].lIntegral = (long)g_State[i].ucDegrees << FORCE_GAIN_SHIFT;
+    }
+
+    g_bLimiting = false;
+    Timer_IF_Start(FORCE_CONTROLLER_TIMER_BASE, FORCE_CONTROLLER_TIMER,
+                   FORCE_CONTROLLER_PERIOD_MS);
+}
+
+//****************************************************************************
+//
+//! Starts running the loop as a force limiter on pose playback. Fingers
+//! start with no ceiling.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void StartForceLimiter(void)
+{
+    unsigned char i;
+
+    for (i = 0; i < NUM_FINGERS; i++)
+    {
+        g_State[i].ucDegrees = GetFingerPositionLimit((enum Servo_Joint_Type)i);
+        g_State[i].lIntegral = (long)g_State[i].ucDegrees << FORCE_GAIN_SHIFT;
+        SetServoCeiling_PWM_Breakout(SERVO_NO_CEILING, (enum Servo_Joint_Type)i);
+    }
+
+    g_bLimiting = true;
+    Timer_IF_Start(FORCE_CONTROLLER_TIMER_BASE, FORCE_CONTROLLER_TIMER,
+                   FORCE_CONTROLLER_PERIOD_MS);
+}
+
+//****************************************************************************
+//
+//! Stops running the loop. Fingers hold their position, and lose their
+//! ceiling if the loop was limiting.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void StopForceController(void)
+{
+    unsigned char i;
+
+    Timer_IF_Stop(FORCE_CONTROLLER_TIMER_BASE, FORCE_CONTROLLER_TIMER);
+
+    if (g_bLimiting)
+    {
+        for (i = 0; i < NUM_FINGERS; i++)
+        {
+            SetServoCeiling_PWM_Breakout(SERVO_NO_CEILING, (enum Servo_Joint_Type)i);
+        }
+        g_bLimiting = false;
+    }
+}
+
+//****************************************************************************
+//
+//! Sets the pressure setpoint of a finger
+//!
+//! \param eFingerSensor is the finger
+//! \param usSetpoint is the raw sensor reading to hold
+//!
+//! \return None
+//
+//****************************************************************************
+void SetForceSetpoint(enum Fingertip_Sensor_Type eFingerSensor, unsigned short usSetpoint)
+{
+    if ((unsigned int)eFingerSensor < NUM_FINGERS)
+    {
+        g_usSetpoint[eFingerSensor] = usSetpoint;
+    }
+}
+
+//****************************************************************************
+//
+//! Gets the pressure setpoint of a finger
+//!
+//! \param eFingerSensor is the finger
+//!
+//! \return the raw sensor reading the finger holds, 0 for an invalid finger
+//
+//****************************************************************************
+unsigned short GetForceSetpoint(enum Fingertip_Sensor_Type eFingerSensor)
+{
+    if ((unsigned int)eFingerSensor >= NUM_FINGERS)
+    {
+        return 0;
+    }
+
+    return g_usSetpoint[eFingerSensor];
+}
+
+//****************************************************************************
+//
+//! Sets every setpoint from an FSET payload
+//!
+//! \param pucPayload holds NUM_FINGERS big-endian 16-bit readings. A reading
+//!        of 0 leaves that finger's setpoint unchanged.
+//!
+//! \return None
+//
+//****************************************************************************
+void UnpackForceSetpoints(const unsigned char *pucPayload)
+{
+    unsigned short usSetpoint;
+    unsigned char i;
+
+    for (i = 0; i < NUM_FINGERS; i++)
+    {
+        usSetpoint = (unsigned short)((pucPayload[i*2] << 8) | pucPayload[i*2+1]);
+        if (usSetpoint != 0)
+        {
+            g_usSetpoint[i] = usSetpoint;
+        }
+    }
+}
+
+//****************************************************************************
+//
+//! Sets the gains of a finger
+//!
+//! \param eFingerSensor is the finger
+//! \param pGains holds the gains, in FORCE_GAIN_SHIFT fixed point
+//!
+//! \return None
+//
+//****************************************************************************
+void SetForceGains(enum Fingertip_Sensor_Type eFingerSensor, const struct ForceGains *pGains)
+{
+    if ((unsigned int)eFingerSensor < NUM_FINGERS)
+    {
+        g_Gains[eFingerSensor].sKp = pGains->sKp;
+        g_Gains[eFingerSensor].sKi = pGains->sKi;
+    }
+}
+
+//****************************************************************************
+//
+//! Loop tick. Updates every finger from the latest sensor snapshot.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void ForceControllerIntHandler(void)
+{
+    struct SensorSnapshot snapshot;
+    unsigned long ulBegin;
+    unsigned char i;
+
+    Timer_IF_InterruptClear(FORCE_CONTROLLER_TIMER_BASE);
+
+    // Nothing to act on until the sampler has published
+    GetSensorSnapshot(&snapshot);
+    if (snapshot.ulSequence == 0)
+    {
+        return;
+    }
+
+    ulBegin = ProfileBegin();
+    for (i = 0; i < NUM_FINGERS; i++)
+    {
+        if (g_bLimiting)
+        {
+            LimitFinger(i, snapshot.usReading[i]);
+        }
+        else
+        {
+            UpdateFinger(i, snapshot.usReading[i]);
+        }
+    }
+    ProfileEnd(PROFILE_SERVO, ulBegin);
+}
+
+//****************************************************************************
+//
+//! Runs one PI step for a finger and moves its servo if the position changed
+//!
+//! \param ucFinger is the finger, as an index into the sensor snapshot
+//! \param usReading is the finger's latest sensor reading
+//!
+//! \return None
+//
+//****************************************************************************
+static void UpdateFinger(unsigned char ucFinger, unsigned short usReading)
+{
+    struct ForceState *pState = &g_State[ucFinger];
+    long lLimit;
+    long lError;
+    long lProportional;
+    long lOutput;
+    unsigned char ucDegrees;
+
+    lLimit = (long)GetFingerPositionLimit((enum Servo_Joint_Type)ucFinger) << FORCE_GAIN_SHIFT;
+    lError = (long)usReading - g_usSetpoint[ucFinger];
+    lProportional = g_Gains[ucFinger].sKp*lError;
+    lOutput = lProportional + pState->lIntegral;
+
+    // Conditional integration: hold the integrator while the output is
+    // already at a limit the error pushes towards
+    if (!(lOutput >= lLimit && lError > 0) && !(lOutput <= 0 && lError < 0))
+    {
+        pState->lIntegral += g_Gains[ucFinger].sKi*lError*FORCE_CONTROLLER_PERIOD_MS/1000;
+        if (pState->lIntegral > lLimit)
+        {
+            pState->lIntegral = lLimit;
+        }
+        else if (pState->lIntegral < 0)
+        {
+            pState->lIntegral = 0;
+        }
+        lOutput = lProportional + pState->lIntegral;
+    }
+
+    if (lOutput > lLimit)
+    {
+        lOutput = lLimit;
+    }
+    else if (lOutput < 0)
+    {
+        lOutput = 0;
+    }
+
+    ucDegrees = (unsigned char)((lOutput + FORCE_GAIN_ONE/2) >> FORCE_GAIN_SHIFT);
+    if (ucDegrees != pState->ucDegrees)
+    {
+        MoveServo_PWM_Breakout(ucDegrees, (enum Servo_Joint_Type)ucFinger);
+        pState->ucDegrees = ucDegrees;
+    }
+}
+
+//****************************************************************************
+//
+//! Runs one PI step of the limiter for a finger and moves its ceiling if
+//! the position changed. The integrator is the ceiling; it is pulled down
+//! to the finger's position as soon as the pressure goes over the limit, so
+//! the finger stops there instead of after the ceiling has come down from
+//! wherever it was.
+//!
+//! \param ucFinger is the finger, as an index into the sensor snapshot
+//! \param usReading is the finger's latest sensor reading
+//!
+//! \return None
+//
+//****************************************************************************
+static void LimitFinger(unsigned char ucFinger, unsigned short usReading)
+{
+    struct ForceState *pState = &g_State[ucFinger];
+    long lLimit;
+    long lPosition;
+    long lError;
+    long lOutput;
+    unsigned char ucDegrees;
+
+    lLimit = (long)GetFingerPositionLimit((enum Servo_Joint_Type)ucFinger) << FORCE_GAIN_SHIFT;
+    lError = (long)usReading - g_usSetpoint[ucFinger];
+
+    if (lError < 0)
+    {
+        lPosition = (long)GetServoPosition_PWM_Breakout((enum Servo_Joint_Type)ucFinger) << FORCE_GAIN_SHIFT;
+        if (pState->lIntegral > lPosition)
+        {
+            pState->lIntegral = lPosition;
+        }
+    }
+
+    pState->lIntegral += g_Gains[ucFinger].sKi*lError*FORCE_CONTROLLER_PERIOD_MS/1000;
+    if (pState->lIntegral > lLimit)
+    {
+        pState->lIntegral = lLimit;
+    }
+    else if (pState->lIntegral < 0)
+    {
+        pState->lIntegral = 0;
+    }
+
+    // The proportional term only backs the finger off, it never lifts the
+    // ceiling above the integrator
+    lOutput = pState->lIntegral;
+    if (lError < 0)
+    {
+        lOutput += g_Gains[ucFinger].sKp*lError;
+        if (lOutput < 0)
+        {
+            lOutput = 0;
+        }
+    }
+
+    ucDegrees = (unsigned char)((lOutput + FORCE_GAIN_ONE/2) >> FORCE_GAIN_SHIFT);
+    if (ucDegrees != pState->ucDegrees)
+    {
+        // At the top of its travel the finger is not capped at all
+        SetServoCeiling_PWM_Breakout((lOutput >= lLimit) ? SERVO_NO_CEILING : ucDegrees,
+                                     (enum Servo_Joint_Type)ucFinger);
+        pState->ucDegrees = ucDegrees;
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef __FORCE_CONTROLLER_IF_H__
+#define __FORCE_CONTROLLER_IF_H__
+//*****************************************************************************
+//
+// force_controller_if.h
+//
+// Header file for the closed-loop finger force controller. A timer interrupt
+// runs a PI loop per finger at a fixed rate, moving each finger until its
+// finger-tip sensor reads the pressure setpoint, independently of when
+// packets arrive. In hybrid mode the same loop only caps the finger
+// positions that pose playback moves to, so no finger presses harder than
+// its setpoint.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "adc_driver_if.h"
+
+// Timer used to pace the loop. It is set up as one full-width timer, which
+// takes all of TIMERA2, so the loop cannot run alongside the GPT PWM path in
+// servo_driver.c: InitPWMModules() splits TIMERA2 to drive a servo from its
+// B half. Only the PCA9685 breakout board can drive the servos meanwhile.
+#define FORCE_CONTROLLER_TIMER_PRCM     PRCM_TIMERA2
+#define FORCE_CONTROLLER_TIMER_BASE     TIMERA2_BASE
+#define FORCE_CONTROLLER_TIMER          TIMER_A
+
+// Loop period in milliseconds (200 Hz)
+#define FORCE_CONTROLLER_PERIOD_MS      5
+
+// Gains are fixed point with FORCE_GAIN_SHIFT fractional bits. Kp is degrees
+// per count of pressure error, Ki is degrees per second per count.
+#define FORCE_GAIN_SHIFT                8
+#define FORCE_GAIN_ONE                  (1 << FORCE_GAIN_SHIFT)
+
+// Default pressure setpoints, as raw sensor readings (smaller value means
+// more pressure)
+#define FORCE_SETPOINT_THUMB            940
+#define FORCE_SETPOINT_INDEX            900
+#define FORCE_SETPOINT_MIDDLE           940
+#define FORCE_SETPOINT_RING             940
+#define FORCE_SETPOINT_PINKY            940
+
+// Default gains, the same for every finger: 0.1 deg/count and 3.3 deg/s/count
+#define FORCE_DEFAULT_KP                26
+#define FORCE_DEFAULT_KI                845
+
+struct ForceGains {
+    short sKp;                          // Proportional gain
+    short sKi;                          // Integral gain
+};
+
+//****************************************************************************
+// Resets setpoints, gains and finger positions to their defaults.
+// The sensor sampler must be started first.
+//****************************************************************************
+void InitForceController(void);
+
+//****************************************************************************
+// Starts running the loop. Fingers continue from where the servos were
+// left.
+//****************************************************************************
+void StartForceController(void);
+
+//****************************************************************************
+// Starts running the loop as a force limiter: pose playback moves the
+// fingers and the setpoints are the pressures they must not exceed. Fingers
+// are held back through their servo ceilings.
+//****************************************************************************
+void StartForceLimiter(void);
+
+//****************************************************************************
+// Stops running the loop. Fingers hold their position and lose any ceiling.
+//****************************************************************************
+void StopForceController(void);
+
+//****************************************************************************
+// Sets the pressure setpoint of a finger, as a raw sensor reading
+//****************************************************************************
+void SetForceSetpoint(enum Fingertip_Sensor_Type eFingerSensor, unsigned short usSetpoint);
+
+//****************************************************************************
+// Gets the pressure setpoint of a finger
+//****************************************************************************
+unsigned short GetForceSetpoint(enum Fingertip_Sensor_Type eFingerSensor);
+
+//****************************************************************************
+// Sets every setpoint from an FSET payload of big-endian 16-bit readings,
+// one per finger. A setpoint of 0 leaves that finger's setpoint unchanged.
+//****************************************************************************
+void UnpackForceSetpoints(const unsigned char *pucPayload);
+
+//****************************************************************************
+// Sets the gains of a finger
+//****************************************************************************
+void SetForceGains(enum Fingertip_Sensor_Type eFingerSensor, const struct ForceGains *pGains);
+
+#endif //  __FORCE_CONTROLLER_IF_H__
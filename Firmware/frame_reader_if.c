@@ -0,0 +1,184 @@
+//*****************************************************************************
+//
+// frame_reader_if.c
+//
+// HIRCP frame reader. The ring buffer indices run freely and are masked on
+// access, so a full buffer and an empty one are told apart by their
+// difference.
+//
+// A packet starts with the HIRC constant followed by an opcode from
+// HIRCP_CRQ to the last HIRCP_Type. While the stream is in step only packet
+// boundaries are examined. After a corrupt or dropped byte the reader moves
+// one byte at a time until such a start is found; a payload that happens to
+// contain one may be taken for a packet, and the next boundary then puts
+// the reader out of step again until it finds the real one.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "frame_reader_if.h"
+
+#define FRAME_READER_MASK           (FRAME_READER_SIZE - 1)
+
+#if (FRAME_READER_SIZE & FRAME_READER_MASK) != 0
+#error FRAME_READER_SIZE must be a power of two
+#endif
+
+static unsigned char PeekByte(struct FrameReader *pReader, unsigned long ulOffset);
+static tBoolean StartsPacket(struct FrameReader *pReader, unsigned long ulBuffered);
+
+//****************************************************************************
+//
+//! Empties the reader and clears its count of discarded bytes
+//!
+//! \param pReader is the reader
+//!
+//! \return None
+//
+//****************************************************************************
+void FrameReaderReset(struct FrameReader *pReader)
+{
+    pReader->ulHead = 0;
+    pReader->ulTail = 0;
+    pReader->ulDiscarded = 0;
+}
+
+//****************************************************************************
+//
+//! Finds where received bytes go. The space ends at the end of the buffer
+//! or at the oldest byte, whichever comes first, so a read may need to be
+//! split in two when the buffer wraps.
+//!
+//! \param pReader is the reader
+//! \param ppucSpace receives the start of the free space
+//!
+//! \return the number of bytes that fit, 0 when the buffer is full
+//
+//****************************************************************************
+int FrameReaderSpace(struct FrameReader *pReader, unsigned char **ppucSpace)
+{
+    unsigned long ulFree = FRAME_READER_SIZE - (pReader->ulTail - pReader->ulHead);
+    unsigned long ulIndex = pReader->ulTail & FRAME_READER_MASK;
+    unsigned long ulToEnd = FRAME_READER_SIZE - ulIndex;
+
+    *ppucSpace = &pReader->ucBuf[ulIndex];
+    return (int)(ulFree < ulToEnd ? ulFree : ulToEnd);
+}
+
+//****************************************************************************
+//
+//! Adds bytes placed in the space FrameReaderSpace() returned
+//!
+//! \param pReader is the reader
+//! \param iLen is the number of bytes placed, at most the space returned
+//!
+//! \return None
+//
+//****************************************************************************
+void FrameReaderCommit(struct FrameReader *pReader, int iLen)
+{
+    pReader->ulTail += iLen;
+}
+
+//****************************************************************************
+//
+//! Takes the next whole packet out of the reader, first discarding any
+//! bytes that cannot start one
+//!
+//! \param pReader is the reader
+//! \param pucPacket receives HIRCP_MAX_PACKET_LEN bytes
+//!
+//! \return true if a packet was copied, false if more bytes are needed
+//
+//****************************************************************************
+tBoolean FrameReaderNext(struct FrameReader *pReader, unsigned char *pucPacket)
+{
+    unsigned long ulBuffered;
+    int i;
+
+    while ((ulBuffered = pReader->ulTail - pReader->ulHead) > 0)
+    {
+        if (!StartsPacket(pReader, ulBuffered))
+        {
+            pReader->ulHead++;
+            pReader->ulDiscarded++;
+            continue;
+        }
+
+        // The start is good so far; wait for the rest of it
+        if (ulBuffered < HIRCP_MAX_PACKET_LEN)
+        {
+            return false;
+        }
+
+        for (i = 0; i < HIRCP_MAX_PACKET_LEN; i++)
+        {
+            pucPacket[i] = PeekByte(pReader, i);
+        }
+        pReader->ulHead += HIRCP_MAX_PACKET_LEN;
+        return true;
+    }
+
+    return false;
+}
+
+//****************************************************************************
+//
+//! Reads a buffered byte without taking it out
+//!
+//! \param pReader is the reader
+//! \param ulOffset is the position counted from the oldest byte
+//!
+//! \return the byte
+//
+//****************************************************************************
+static unsigned char PeekByte(struct FrameReader *pReader, unsigned long ulOffset)
+{
+    return pReader->ucBuf[(pReader->ulHead + ulOffset) & FRAME_READER_MASK];
+}
+
+//****************************************************************************
+//
+//! Checks whether the oldest bytes can be the start of a packet. Only the
+//! bytes received so far are checked.
+//!
+//! \param pReader is the reader
+//! \param ulBuffered is the number of bytes buffered
+//!
+//! \return true unless a byte rules out a packet starting here
+//
+//****************************************************************************
+static tBoolean StartsPacket(struct FrameReader *pReader, unsigned long ulBuffered)
+{
+    unsigned long i;
+    unsigned char ucOpcode;
+
+    for (i = 0; i < HIRCP_CONSTANT_LEN && i < ulBuffered; i++)
+    {
+        if (PeekByte(pReader, i) != HIRCP_CONSTANT[i])
+        {
+            return false;
+        }
+    }
+
+    if (ulBuffered > HIRCP_CONSTANT_LEN)
+    {
+        ucOpcode = PeekByte(pReader, HIRCP_CONSTANT_LEN);
+        if (ucOpcode < HIRCP_CRQ || ucOpcode >= HIRCP_NUM_TYPES)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,61 @@
+#ifndef __FRAME_READER_IF_H__
+#define __FRAME_READER_IF_H__
+//*****************************************************************************
+//
+// frame_reader_if.h
+//
+// Header file for the HIRCP frame reader. Bytes read from the client socket
+// are collected in a ring buffer and handed out as whole packets, however
+// TCP splits or merges them. Bytes that do not start with the HIRC constant
+// and a known opcode are discarded until the stream lines up again.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+
+#include "hircp.h"
+
+// Size of the ring buffer, a power of two holding several packets
+#define FRAME_READER_SIZE           128
+
+struct FrameReader {
+    unsigned char ucBuf[FRAME_READER_SIZE];
+    unsigned long ulHead;           // Bytes taken out since reset
+    unsigned long ulTail;           // Bytes put in since reset
+    unsigned long ulDiscarded;      // Bytes dropped while out of step
+};
+
+//****************************************************************************
+// Empties the reader and clears its count of discarded bytes
+//****************************************************************************
+void FrameReaderReset(struct FrameReader *pReader);
+
+//****************************************************************************
+// Returns the contiguous free space at the end of the buffer, and the place
+// to put received bytes in ppucSpace. Zero when the buffer is full.
+//****************************************************************************
+int FrameReaderSpace(struct FrameReader *pReader, unsigned char **ppucSpace);
+
+//****************************************************************************
+// Adds iLen bytes placed in the space FrameReaderSpace() returned
+//****************************************************************************
+void FrameReaderCommit(struct FrameReader *pReader, int iLen);
+
+//****************************************************************************
+// Copies the next whole packet into pucPacket, HIRCP_MAX_PACKET_LEN bytes.
+// Returns false until enough bytes have arrived.
+//****************************************************************************
+tBoolean FrameReaderNext(struct FrameReader *pReader, unsigned char *pucPacket);
+
+#endif //  __FRAME_READER_IF_H__
@@ -46,6 +46,7 @@
 
 const unsigned char HIRCP_CONSTANT[] = "HIRC";
 HIRCP_Mode g_hircp_mode = HIRCP_NORMAL;
+unsigned char g_hircp_options = 0;
 
 //
 // Structure that stores HIRCP packet information
@@ -291,20 +292,30 @@ tBoolean HIRCP_InitiateConnectionSequence(void)
     // Check for mode
     //
     HIRCP_GetPayload(recvPacket, recv_payload, HIRCP_MAX_PAYLOAD_LEN);
-    if (recv_payload[0] != HIRCP_NORMAL && recv_payload[0] != HIRCP_CLOSED_LOOP)
+    if (recv_payload[0] != HIRCP_NORMAL && recv_payload[0] != HIRCP_CLOSED_LOOP &&
+        recv_payload[0] != HIRCP_HYBRID)
     {
         UART_PRINT("Invalid mode.\n\r");
         return false;
     }
     g_hircp_mode = recv_payload[0];
 
+    //
+    // Options unknown to this firmware are ignored
+    //
+    g_hircp_options = recv_payload[1] &
+        (HIRCP_OPTION_TIMED_DACK | HIRCP_OPTION_STAMPED_DATA);
+
     UART_PRINT("Received CRQ packet.\n\r");
 
     //
-    // Send ACK packet
+    // Send ACK packet, echoing the options granted
     //
+    memset(send_payload, 0, HIRCP_MAX_PAYLOAD_LEN);
+    send_payload[0] = g_hircp_options;
     HIRCP_ClearPacket(sendPacket);
     HIRCP_SetType(sendPacket, HIRCP_ACK);
+    HIRCP_SetPayload(sendPacket, send_payload, HIRCP_MAX_PAYLOAD_LEN);
     HIRCP_GetData(sendPacket, send_data, HIRCP_MAX_PACKET_LEN);
     lRetVal = BsdTcpServerSend(send_data, HIRCP_MAX_PACKET_LEN);
     if (lRetVal < 0)
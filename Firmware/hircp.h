@@ -22,19 +22,70 @@
 //****************************************************************************
 //         	                    CONSTANTS
 //****************************************************************************
-#define HIRCP_CRQ_PAYLOAD_LEN 1
+#define HIRCP_CRQ_PAYLOAD_LEN 2
 #define HIRCP_MODE_PAYLOAD_LEN 1
 #define HIRCP_DATA_PAYLOAD_LEN 6
 #define HIRCP_DACK_PAYLOAD_LEN 10
 #define HIRCP_TRQ_PAYLOAD_LEN 0
 #define HIRCP_ACK_PAYLOAD_LEN 0
 #define HIRCP_ERR_PAYLOAD_LEN 1
+#define HIRCP_FSET_PAYLOAD_LEN 10
+#define HIRCP_STATS_PAYLOAD_LEN 10
+#define HIRCP_TRAJ_PAYLOAD_LEN 10
+#define HIRCP_BEACON_PAYLOAD_LEN 10
+#define HIRCP_PING_PAYLOAD_LEN 10
+#define HIRCP_PONG_PAYLOAD_LEN 10
 
 #define HIRCP_MAX_PACKET_LEN 15
 #define HIRCP_MAX_PAYLOAD_LEN 10
 #define HIRCP_CONSTANT_LEN 4
 #define HIRCP_OPCODE_LEN 1
 
+// Options requested in the second byte of a CRQ payload
+#define HIRCP_OPTION_TIMED_DACK 0x01    /* DACK sent first, with sensor age */
+#define HIRCP_OPTION_STAMPED_DATA 0x02  /* DATA carries its send time on our clock */
+
+// Discovery beacons, sent over UDP rather than the connection
+#define HIRCP_BEACON_PORT 5002
+#define HIRCP_BEACON_VERSION 1
+
+// Capabilities, in the last byte of a BEACON payload
+#define HIRCP_CAPABILITY_TIMED_DACK 0x01  /* Timed DACK packets */
+#define HIRCP_CAPABILITY_HYBRID 0x02      /* Force-limited mode */
+#define HIRCP_CAPABILITY_TRAJECTORY 0x04  /* Trajectory playback */
+#define HIRCP_CAPABILITY_BUSY 0x08        /* Serving a connection */
+
+// Statistics requested in the first byte of a STATS payload
+#define HIRCP_STATS_PLAYBACK 0          /* Pose playback */
+#define HIRCP_STATS_PROFILE 1           /* Profile of the section in byte 1 */
+#define HIRCP_STATS_LATENCY 2           /* One-way latency of stamped DATA */
+
+// Trajectory commands, in the first byte of a TRAJ payload
+#define HIRCP_TRAJ_BEGIN 0              /* Start an upload */
+#define HIRCP_TRAJ_CHUNK 1              /* One frame of the upload, not answered */
+#define HIRCP_TRAJ_END 2                /* Finish an upload */
+#define HIRCP_TRAJ_PLAY 3               /* Start or resume playback */
+#define HIRCP_TRAJ_PAUSE 4              /* Hold the current frame */
+#define HIRCP_TRAJ_STOP 5               /* End playback */
+#define HIRCP_TRAJ_STATUS 6             /* Report progress */
+
+// Flags of a TRAJ_PLAY command
+#define HIRCP_TRAJ_LOOP 0x01            /* Start over at the end */
+
+// Results, in the second byte of a TRAJ reply
+#define HIRCP_TRAJ_OK 0
+#define HIRCP_TRAJ_REJECTED 1           /* Frame count or rate out of range */
+#define HIRCP_TRAJ_BAD_CHECKSUM 2       /* A chunk or the whole upload */
+#define HIRCP_TRAJ_INCOMPLETE 3         /* A chunk is missing or out of order */
+#define HIRCP_TRAJ_NOT_READY 4          /* Not possible in this state or mode */
+
+// Trajectory states, in the third byte of a TRAJ reply
+#define HIRCP_TRAJ_EMPTY 0
+#define HIRCP_TRAJ_UPLOADING 1
+#define HIRCP_TRAJ_READY 2
+#define HIRCP_TRAJ_PLAYING 3
+#define HIRCP_TRAJ_PAUSED 4
+
 
 //****************************************************************************
 //         	                    Global Variables
@@ -50,6 +101,13 @@ typedef enum HIRCP_Type
     HIRCP_TRQ,
     HIRCP_ACK,
     HIRCP_ERR,
+    HIRCP_FSET,
+    HIRCP_STATS,
+    HIRCP_TRAJ,
+    HIRCP_BEACON,
+    HIRCP_PING,
+    HIRCP_PONG,
+    HIRCP_NUM_TYPES
 } HIRCP_Type;
 
 typedef enum HIRCP_MODE
@@ -57,10 +115,12 @@ typedef enum HIRCP_MODE
     HIRCP_INVALID_MODE = 0,
     HIRCP_NORMAL,
     HIRCP_CLOSED_LOOP,
+    HIRCP_HYBRID,
 } HIRCP_Mode;
 
 extern const unsigned char HIRCP_CONSTANT[];
 extern HIRCP_Mode g_hircp_mode;
+extern unsigned char g_hircp_options;
 
 
 //****************************************************************************
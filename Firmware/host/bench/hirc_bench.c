@@ -0,0 +1,1470 @@
+//*****************************************************************************
+//
+// hirc_bench.c
+//
+// End-to-end latency benchmark. Starts hirc_sim with its PWM trace enabled,
+// connects to it over loopback TCP the way the controller application does,
+// and streams poses into it at one or more rates. Each pose is stamped when
+// it is "captured", then held back by the delay and jitter being injected
+// before it is sent, as a network between the tracker and the robot would.
+//
+// Three things are measured for every rate:
+//
+//   glass-to-PWM  From the capture of a pose that starts a joint moving to
+//                 the first change of that joint's PWM pulse in the trace.
+//                 Only poses that move a joint which has been at rest for
+//                 at least two PWM periods are timed, as a joint already
+//                 moving cannot tell one pose from the next.
+//   RTT           From sending a DATA packet to receiving its DACK packet.
+//                 DACK packets do not name the DATA packet they answer, and
+//                 the firmware answers only the newest of the DATA packets
+//                 it reads at once, so a DACK is paired with the newest DATA
+//                 packet sent and the older unanswered ones are counted as
+//                 coalesced.
+//   throughput    DATA packets sent and DACK packets received per second.
+//
+// The client socket can be given the options of the controller's
+// TCPSocket::Profile with -O. With -E the rates are run once with the
+// system defaults, once with each option alone and once with all of them,
+// reconnecting between sets, to show what each option is worth. The
+// firmware's own socket options (its receive window and the radio's power
+// policy) are fixed at build time in tcp_socket.h; the power policy has no
+// effect on loopback.
+//
+// Results are printed as a table on stderr and as JSON on stdout, or in the
+// file given with -o, for regression tracking. Percentiles are taken by
+// nearest rank; the sample count is reported with them, since a p99.9 of
+// fewer than 1000 samples is only the maximum.
+//
+// Usage: hirc_bench [options]
+//   -x path     hirc_sim to run (default: next to hirc_bench)
+//   -p port     port for hirc_sim to listen on (default 5001)
+//   -f file     replay a .hirc recording instead of the built-in poses
+//   -r rates    comma-separated pose rates in Hz (default 30,60,120, or the
+//               rate of the recording)
+//   -s seconds  length of the run at each rate (default 10)
+//   -H ms       time the built-in poses hold each position (default 500)
+//   -d ms       delay added before sending each pose (default 0)
+//   -j ms       random extra delay, uniform from 0 to this (default 0)
+//   -S script   delay script, overrides -d and -j
+//   -a          request timed DACK packets
+//   -n          disable Nagle's algorithm on the socket, same as -O nodelay
+//   -O options  comma-separated socket options: nodelay, quickack, tos=N,
+//               sndbuf=N, rcvbuf=N, or lowlatency for the controller's
+//               TCPSocket::LOW_LATENCY_PROFILE
+//   -E          run the rates without options, with each option alone and
+//               with all of them (default options: lowlatency)
+//   -o file     write the JSON report here instead of stdout
+//
+// The built-in poses step every joint between two positions, so each step
+// is timed. A delay script has one phase per line, run in order and
+// repeated until the run ends:
+//
+//   # comment
+//   <seconds> <delay ms> <jitter ms>
+//
+// Poses are sent in order whatever delay they draw, as TCP would deliver
+// them.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+// Standard includes
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "hw_types.h"
+
+#include "hircp.h"
+#include "servo_driver_if.h"
+#include "sim.h"
+
+#define BENCH_DEFAULT_PORT      5001
+#define BENCH_DEFAULT_SECONDS   10
+#define BENCH_DEFAULT_HOLD_MS   500
+#define BENCH_MAX_RATES         16
+#define BENCH_MAX_PHASES        64
+#define BENCH_MAX_PROFILES      8
+#define BENCH_START_NANOS       100000000ULL    // Lead before the first pose
+#define BENCH_SETTLE_NANOS      1000000000ULL   // Wait for the last replies
+#define BENCH_CONNECT_NANOS     5000000000ULL   // hirc_sim start-up
+#define BENCH_REPLY_NANOS       2000000000ULL
+
+// A joint is at rest when its pulse has not changed for two PWM periods
+#define BENCH_REST_NANOS        (2ULL*SERVO_PWM_PERIOD_MS*1000000ULL)
+
+// The built-in poses, in degrees. Every position is above the minimum the
+// firmware treats as open and within each joint's limit.
+static const unsigned char g_ucPoseLow[NUM_SERVOS] = { 40, 40, 40, 40, 40, 60 };
+static const unsigned char g_ucPoseHigh[NUM_SERVOS] = { 80, 110, 110, 110, 110, 120 };
+
+struct Phase {
+    double dSeconds;
+    double dDelayMs;
+    double dJitterMs;
+};
+
+struct Edge {
+    unsigned long long ullCapture;
+    unsigned char ucJoint;
+};
+
+struct Summary {
+    unsigned long ulCount;
+    double dP50;
+    double dP99;
+    double dP999;
+    double dMax;
+};
+
+// Options of the client socket, those of the controller's TCPSocket::Profile
+struct Profile {
+    char cName[64];
+    tBoolean bNoDelay;
+    tBoolean bQuickAck;
+    int iTos;                           // IP ToS byte, -1 for the default
+    int iSndBuf;                        // Bytes, 0 for the default
+    int iRcvBuf;                        // Bytes, 0 for the default
+};
+
+struct Run {
+    const struct Profile *pProfile;
+    double dRate;
+    unsigned long ulSent;
+    unsigned long ulAcked;
+    unsigned long ulCoalesced;
+    unsigned long ulMissed;             // Steps with no PWM change
+    unsigned long ulSkipped;            // Steps of a joint not at rest
+    double dSendRate;
+    double dAckRate;
+    struct Summary rtt;
+    struct Summary glass;
+};
+
+// Options
+static const char *g_pcSim = NULL;
+static unsigned short g_usPort = BENCH_DEFAULT_PORT;
+static const char *g_pcFile = NULL;
+static double g_dRates[BENCH_MAX_RATES];
+static int g_iNumRates = 0;
+static double g_dSeconds = BENCH_DEFAULT_SECONDS;
+static double g_dHoldMs = BENCH_DEFAULT_HOLD_MS;
+static const char *g_pcScript = NULL;
+static struct Phase g_Phases[BENCH_MAX_PHASES];
+static int g_iNumPhases = 0;
+static tBoolean g_bTimedDack = false;
+static struct Profile g_Options = { "", false, false, -1, 0, 0 };
+static tBoolean g_bEach = false;
+static const char *g_pcOut = NULL;
+
+// Socket option sets to run, and the one of the current connection
+static struct Profile g_Profiles[BENCH_MAX_PROFILES];
+static int g_iNumProfiles = 0;
+static const struct Profile *g_pProfile = NULL;
+
+// Recording being replayed
+static unsigned char (*g_pucFrames)[NUM_SERVOS] = NULL;
+static unsigned long g_ulNumFrames = 0;
+static unsigned char g_ucFileFps = 0;
+
+// PWM trace, appended by the reader thread
+static pthread_mutex_t g_TraceLock = PTHREAD_MUTEX_INITIALIZER;
+static struct Sim_PulseEvent *g_pTrace = NULL;
+static unsigned long g_ulTraceLen = 0;
+static unsigned long g_ulTraceCap = 0;
+
+static pid_t g_SimPid = -1;
+static int g_iSocket = -1;
+
+static void Usage(const char *pcName);
+static int ParseRates(const char *pcList);
+static int LoadRecording(const char *pcPath);
+static int LoadScript(const char *pcPath);
+static int ParseOptions(const char *pcList, struct Profile *pProfile);
+static void NameProfile(struct Profile *pProfile);
+static void AddProfiles(void);
+static void GetPose(unsigned long ulFrame, double dRate, unsigned char *pucPose);
+static double GetDelayNanos(double dElapsed);
+static int StartSim(const char *pcArgv0);
+static void StopSim(void);
+static void *TraceThread(void *pvFd);
+static int Connect(const struct Profile *pProfile);
+static void Disconnect(void);
+static void RearmQuickAck(void);
+static int SendPacket(unsigned char ucType, const unsigned char *pucPayload, int iLen);
+static int ReceivePacket(unsigned char *pucPacket, unsigned long long ullDeadline);
+static int RunRate(double dRate, struct Run *pRun);
+static void MeasureGlassToPwm(const struct Edge *pEdges, unsigned long ulNumEdges,
+                              double *pdSamples, struct Run *pRun);
+static void Summarize(double *pdSamples, unsigned long ulCount, struct Summary *pSummary);
+static void PrintSummaryJson(FILE *pFile, const char *pcName, const struct Summary *pSummary);
+static void PrintReport(FILE *pFile, const struct Run *pRuns, int iNumRuns);
+static unsigned long long Now(void);
+static int CompareDoubles(const void *pvA, const void *pvB);
+
+int main(int argc, char *argv[])
+{
+    static struct Run runs[BENCH_MAX_PROFILES*BENCH_MAX_RATES];
+    FILE *pOut = stdout;
+    int iOpt;
+    int iProfile;
+    int iRate;
+    int iNumRuns = 0;
+    int iStatus = 0;
+
+    while ((iOpt = getopt(argc, argv, "x:p:f:r:s:H:d:j:S:anO:Eo:h")) != -1)
+    {
+        switch (iOpt)
+        {
+            case 'x':
+                g_pcSim = optarg;
+                break;
+            case 'p':
+                g_usPort = (unsigned short)strtoul(optarg, NULL, 10);
+                break;
+            case 'f':
+                g_pcFile = optarg;
+                break;
+            case 'r':
+                if (ParseRates(optarg) != 0)
+                {
+                    return 1;
+                }
+                break;
+            case 's':
+                g_dSeconds = strtod(optarg, NULL);
+                break;
+            case 'H':
+                g_dHoldMs = strtod(optarg, NULL);
+                break;
+            case 'd':
+                g_Phases[0].dDelayMs = strtod(optarg, NULL);
+                break;
+            case 'j':
+                g_Phases[0].dJitterMs = strtod(optarg, NULL);
+                break;
+            case 'S':
+                g_pcScript = optarg;
+                break;
+            case 'a':
+                g_bTimedDack = true;
+                break;
+            case 'n':
+                g_Options.bNoDelay = true;
+                break;
+            case 'O':
+                if (ParseOptions(optarg, &g_Options) != 0)
+                {
+                    return 1;
+                }
+                break;
+            case 'E':
+                g_bEach = true;
+                break;
+            case 'o':
+                g_pcOut = optarg;
+                break;
+            default:
+                Usage(argv[0]);
+                return (iOpt == 'h') ? 0 : 1;
+        }
+    }
+
+    if (g_dSeconds <= 0 || g_dHoldMs <= 0)
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    if (g_pcScript != NULL)
+    {
+        if (LoadScript(g_pcScript) != 0)
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        g_Phases[0].dSeconds = g_dSeconds;
+        g_iNumPhases = 1;
+    }
+
+    if (g_pcFile != NULL && LoadRecording(g_pcFile) != 0)
+    {
+        return 1;
+    }
+
+    if (g_iNumRates == 0)
+    {
+        if (g_pcFile != NULL)
+        {
+            g_dRates[g_iNumRates++] = g_ucFileFps;
+        }
+        else
+        {
+            g_dRates[g_iNumRates++] = 30;
+            g_dRates[g_iNumRates++] = 60;
+            g_dRates[g_iNumRates++] = 120;
+        }
+    }
+
+    AddProfiles();
+
+    if (g_pcOut != NULL && (pOut = fopen(g_pcOut, "w")) == NULL)
+    {
+        fprintf(stderr, "hirc_bench: cannot write %s: %s\n", g_pcOut, strerror(errno));
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    srand(1);
+
+    if (StartSim(argv[0]) != 0)
+    {
+        StopSim();
+        return 1;
+    }
+
+    // One connection per set of socket options, as they are set before
+    // connecting
+    for (iProfile = 0; iProfile < g_iNumProfiles && iStatus == 0; iProfile++)
+    {
+        if (Connect(&g_Profiles[iProfile]) != 0)
+        {
+            iStatus = 1;
+            break;
+        }
+
+        for (iRate = 0; iRate < g_iNumRates; iRate++)
+        {
+            if (RunRate(g_dRates[iRate], &runs[iNumRuns]) != 0)
+            {
+                iStatus = 1;
+                break;
+            }
+            runs[iNumRuns++].pProfile = &g_Profiles[iProfile];
+        }
+
+        Disconnect();
+    }
+    StopSim();
+
+    if (iStatus == 0)
+    {
+        PrintReport(pOut, runs, iNumRuns);
+    }
+    if (pOut != stdout)
+    {
+        fclose(pOut);
+    }
+
+    return iStatus;
+}
+
+static void Usage(const char *pcName)
+{
+    fprintf(stderr, "Usage: %s [-x sim] [-p port] [-f file] [-r rates] [-s seconds] [-H ms]\n"
+                    "       [-d ms] [-j ms] [-S script] [-a] [-n] [-O options] [-E] [-o file]\n",
+            pcName);
+}
+
+//****************************************************************************
+//
+//! Reads the comma-separated list of rates given with -r
+//!
+//! \param pcList is the list
+//!
+//! \return 0 on success, -1 if a rate is not positive or there are too many
+//
+//****************************************************************************
+static int ParseRates(const char *pcList)
+{
+    char *pcEnd;
+    double dRate;
+
+    g_iNumRates = 0;
+    while (*pcList != '\0')
+    {
+        dRate = strtod(pcList, &pcEnd);
+        if (pcEnd == pcList || dRate <= 0 || g_iNumRates == BENCH_MAX_RATES)
+        {
+            fprintf(stderr, "hirc_bench: bad rate list\n");
+            return -1;
+        }
+        g_dRates[g_iNumRates++] = dRate;
+        pcList = (*pcEnd == ',') ? pcEnd + 1 : pcEnd;
+        if (*pcEnd != ',' && *pcEnd != '\0')
+        {
+            fprintf(stderr, "hirc_bench: bad rate list\n");
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+//****************************************************************************
+//
+//! Reads the comma-separated socket options given with -O
+//!
+//! \param pcList is the list
+//! \param pProfile receives the options, the others are left as they are
+//!
+//! \return 0 on success, -1 if an option is unknown or has a bad value
+//
+//****************************************************************************
+static int ParseOptions(const char *pcList, struct Profile *pProfile)
+{
+    char cOption[32];
+    size_t uLen;
+    char *pcValue;
+    char *pcEnd;
+    long lValue;
+
+    while (*pcList != '\0')
+    {
+        uLen = strcspn(pcList, ",");
+        if (uLen == 0 || uLen >= sizeof(cOption))
+        {
+            fprintf(stderr, "hirc_bench: bad socket option list\n");
+            return -1;
+        }
+        memcpy(cOption, pcList, uLen);
+        cOption[uLen] = '\0';
+        pcList += uLen + (pcList[uLen] == ',');
+
+        pcValue = strchr(cOption, '=');
+        lValue = 0;
+        if (pcValue != NULL)
+        {
+            *pcValue++ = '\0';
+            lValue = strtol(pcValue, &pcEnd, 0);
+            if (pcEnd == pcValue || *pcEnd != '\0' || lValue < 0 || lValue > INT_MAX)
+            {
+                fprintf(stderr, "hirc_bench: bad value for %s\n", cOption);
+                return -1;
+            }
+        }
+
+        if (strcmp(cOption, "nodelay") == 0 && pcValue == NULL)
+        {
+            pProfile->bNoDelay = true;
+        }
+        else if (strcmp(cOption, "quickack") == 0 && pcValue == NULL)
+        {
+            pProfile->bQuickAck = true;
+        }
+        else if (strcmp(cOption, "tos") == 0 && pcValue != NULL && lValue <= 0xFF)
+        {
+            pProfile->iTos = (int)lValue;
+        }
+        else if (strcmp(cOption, "sndbuf") == 0 && pcValue != NULL && lValue > 0)
+        {
+            pProfile->iSndBuf = (int)lValue;
+        }
+        else if (strcmp(cOption, "rcvbuf") == 0 && pcValue != NULL && lValue > 0)
+        {
+            pProfile->iRcvBuf = (int)lValue;
+        }
+        else if (strcmp(cOption, "lowlatency") == 0 && pcValue == NULL)
+        {
+            // TCPSocket::LOW_LATENCY_PROFILE: DSCP 46 (Expedited Forwarding)
+            pProfile->bNoDelay = true;
+            pProfile->bQuickAck = true;
+            pProfile->iTos = 0xB8;
+            pProfile->iSndBuf = 4096;
+            pProfile->iRcvBuf = 4096;
+        }
+        else
+        {
+            fprintf(stderr, "hirc_bench: bad socket option %s\n", cOption);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+//****************************************************************************
+//
+//! Names a set of socket options after the options it sets
+//!
+//! \param pProfile is the set
+//!
+//! \return None
+//
+//****************************************************************************
+static void NameProfile(struct Profile *pProfile)
+{
+    char *pcName = pProfile->cName;
+    size_t uSize = sizeof(pProfile->cName);
+    int iLen = 0;
+
+    pcName[0] = '\0';
+    if (pProfile->bNoDelay)
+    {
+        iLen += snprintf(pcName + iLen, uSize - iLen, "+nodelay");
+    }
+    if (pProfile->bQuickAck && iLen < (int)uSize)
+    {
+        iLen += snprintf(pcName + iLen, uSize - iLen, "+quickack");
+    }
+    if (pProfile->iTos >= 0 && iLen < (int)uSize)
+    {
+        iLen += snprintf(pcName + iLen, uSize - iLen, "+tos=0x%02x", pProfile->iTos);
+    }
+    if (pProfile->iSndBuf > 0 && iLen < (int)uSize)
+    {
+        iLen += snprintf(pcName + iLen, uSize - iLen, "+sndbuf=%d", pProfile->iSndBuf);
+    }
+    if (pProfile->iRcvBuf > 0 && iLen < (int)uSize)
+    {
+        iLen += snprintf(pcName + iLen, uSize - iLen, "+rcvbuf=%d", pProfile->iRcvBuf);
+    }
+
+    if (iLen == 0)
+    {
+        snprintf(pcName, uSize, "default");
+    }
+    else
+    {
+        memmove(pcName, pcName + 1, strlen(pcName));
+    }
+}
+
+//****************************************************************************
+//
+//! Fills g_Profiles with the sets of socket options to run: the options
+//! given, or with -E no options, each option alone and all of them
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void AddProfiles(void)
+{
+    static const struct Profile none = { "", false, false, -1, 0, 0 };
+    struct Profile *pProfile;
+    int iFirst;
+
+    if (!g_bEach)
+    {
+        g_Profiles[0] = g_Options;
+        NameProfile(&g_Profiles[0]);
+        g_iNumProfiles = 1;
+        return;
+    }
+
+    NameProfile(&g_Options);
+    if (strcmp(g_Options.cName, "default") == 0)
+    {
+        ParseOptions("lowlatency", &g_Options);
+    }
+
+    g_Profiles[g_iNumProfiles++] = none;
+    iFirst = g_iNumProfiles;
+    if (g_Options.bNoDelay)
+    {
+        pProfile = &g_Profiles[g_iNumProfiles++];
+        *pProfile = none;
+        pProfile->bNoDelay = true;
+    }
+    if (g_Options.bQuickAck)
+    {
+        pProfile = &g_Profiles[g_iNumProfiles++];
+        *pProfile = none;
+        pProfile->bQuickAck = true;
+    }
+    if (g_Options.iTos >= 0)
+    {
+        pProfile = &g_Profiles[g_iNumProfiles++];
+        *pProfile = none;
+        pProfile->iTos = g_Options.iTos;
+    }
+    if (g_Options.iSndBuf > 0)
+    {
+        pProfile = &g_Profiles[g_iNumProfiles++];
+        *pProfile = none;
+        pProfile->iSndBuf = g_Options.iSndBuf;
+    }
+    if (g_Options.iRcvBuf > 0)
+    {
+        pProfile = &g_Profiles[g_iNumProfiles++];
+        *pProfile = none;
+        pProfile->iRcvBuf = g_Options.iRcvBuf;
+    }
+    for (pProfile = g_Profiles; pProfile < &g_Profiles[g_iNumProfiles]; pProfile++)
+    {
+        NameProfile(pProfile);
+    }
+
+    if (g_iNumProfiles - iFirst > 1)
+    {
+        pProfile = &g_Profiles[g_iNumProfiles++];
+        *pProfile = g_Options;
+        snprintf(pProfile->cName, sizeof(pProfile->cName), "all");
+    }
+}
+
+//****************************************************************************
+//
+//! Loads a .hirc recording (see hirc_file_format.txt)
+//!
+//! \param pcPath is the file
+//!
+//! \return 0 on success, -1 if it cannot be read or is not a recording
+//
+//****************************************************************************
+static int LoadRecording(const char *pcPath)
+{
+    unsigned char ucHeader[5];
+    unsigned long ulCap = 0;
+    FILE *pFile;
+
+    pFile = fopen(pcPath, "rb");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "hirc_bench: cannot open %s: %s\n", pcPath, strerror(errno));
+        return -1;
+    }
+
+    if (fread(ucHeader, 1, sizeof(ucHeader), pFile) != sizeof(ucHeader) ||
+        memcmp(ucHeader, "HIRC", 4) != 0 || ucHeader[4] == 0)
+    {
+        fprintf(stderr, "hirc_bench: %s is not a HIRC recording\n", pcPath);
+        fclose(pFile);
+        return -1;
+    }
+    g_ucFileFps = ucHeader[4];
+
+    for (;;)
+    {
+        if (g_ulNumFrames == ulCap)
+        {
+            ulCap = ulCap ? 2*ulCap : 1024;
+            g_pucFrames = realloc(g_pucFrames, ulCap*NUM_SERVOS);
+        }
+        if (fread(g_pucFrames[g_ulNumFrames], 1, NUM_SERVOS, pFile) != NUM_SERVOS)
+        {
+            break;
+        }
+        g_ulNumFrames++;
+    }
+    fclose(pFile);
+
+    if (g_ulNumFrames == 0)
+    {
+        fprintf(stderr, "hirc_bench: %s has no frames\n", pcPath);
+        return -1;
+    }
+
+    return 0;
+}
+
+//****************************************************************************
+//
+//! Loads a delay script
+//!
+//! \param pcPath is the file
+//!
+//! \return 0 on success, -1 if it cannot be read or has no phases
+//
+//****************************************************************************
+static int LoadScript(const char *pcPath)
+{
+    struct Phase *pPhase;
+    char cLine[256];
+    char *pcLine;
+    int iLine = 0;
+    FILE *pFile;
+
+    pFile = fopen(pcPath, "r");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "hirc_bench: cannot open %s: %s\n", pcPath, strerror(errno));
+        return -1;
+    }
+
+    g_iNumPhases = 0;
+    while (fgets(cLine, sizeof(cLine), pFile) != NULL)
+    {
+        iLine++;
+        pcLine = cLine + strspn(cLine, " \t");
+        if (*pcLine == '#' || *pcLine == '\n' || *pcLine == '\0')
+        {
+            continue;
+        }
+
+        pPhase = &g_Phases[g_iNumPhases];
+        if (g_iNumPhases == BENCH_MAX_PHASES ||
+            sscanf(pcLine, "%lf %lf %lf", &pPhase->dSeconds, &pPhase->dDelayMs,
+                   &pPhase->dJitterMs) != 3 ||
+            pPhase->dSeconds <= 0 || pPhase->dDelayMs < 0 || pPhase->dJitterMs < 0)
+        {
+            fprintf(stderr, "hirc_bench: %s:%d: bad phase\n", pcPath, iLine);
+            fclose(pFile);
+            return -1;
+        }
+        g_iNumPhases++;
+    }
+    fclose(pFile);
+
+    if (g_iNumPhases == 0)
+    {
+        fprintf(stderr, "hirc_bench: %s has no phases\n", pcPath);
+        return -1;
+    }
+
+    return 0;
+}
+
+//****************************************************************************
+//
+//! Gets the pose captured at a frame of the run
+//!
+//! \param ulFrame is the frame, counted from the start of the run
+//! \param dRate is the rate of the run in Hz
+//! \param pucPose receives NUM_SERVOS positions in degrees
+//!
+//! \return None
+//
+//****************************************************************************
+static void GetPose(unsigned long ulFrame, double dRate, unsigned char *pucPose)
+{
+    unsigned long ulHold;
+
+    if (g_pucFrames != NULL)
+    {
+        memcpy(pucPose, g_pucFrames[ulFrame % g_ulNumFrames], NUM_SERVOS);
+        return;
+    }
+
+    ulHold = (unsigned long)(ulFrame*1000.0/dRate/g_dHoldMs);
+    memcpy(pucPose, (ulHold % 2) ? g_ucPoseHigh : g_ucPoseLow, NUM_SERVOS);
+}
+
+//****************************************************************************
+//
+//! Draws the delay of a pose from the phase of the delay script it falls in
+//!
+//! \param dElapsed is the capture time of the pose in seconds into the run
+//!
+//! \return delay in nanoseconds
+//
+//****************************************************************************
+static double GetDelayNanos(double dElapsed)
+{
+    const struct Phase *pPhase;
+    double dCycle = 0;
+    int i;
+
+    for (i = 0; i < g_iNumPhases; i++)
+    {
+        dCycle += g_Phases[i].dSeconds;
+    }
+
+    dElapsed -= dCycle*(unsigned long)(dElapsed/dCycle);
+    for (i = 0; i < g_iNumPhases - 1 && dElapsed >= g_Phases[i].dSeconds; i++)
+    {
+        dElapsed -= g_Phases[i].dSeconds;
+    }
+    pPhase = &g_Phases[i];
+
+    return (pPhase->dDelayMs + pPhase->dJitterMs*rand()/RAND_MAX)*1e6;
+}
+
+//****************************************************************************
+//
+//! Starts hirc_sim with its PWM trace on a pipe read by TraceThread()
+//!
+//! \param pcArgv0 is how hirc_bench was run, to find hirc_sim next to it
+//!
+//! \return 0 on success, -1 on failure
+//
+//****************************************************************************
+static int StartSim(const char *pcArgv0)
+{
+    static char cPath[PATH_MAX];
+    char cPort[8];
+    char cFd[16];
+    const char *pcSlash;
+    pthread_t thread;
+    int iPipe[2];
+
+    if (g_pcSim == NULL)
+    {
+        pcSlash = strrchr(pcArgv0, '/');
+        snprintf(cPath, sizeof(cPath), "%.*shirc_sim",
+                 pcSlash ? (int)(pcSlash - pcArgv0 + 1) : 0, pcArgv0);
+        g_pcSim = cPath;
+    }
+
+    if (pipe(iPipe) != 0)
+    {
+        fprintf(stderr, "hirc_bench: pipe: %s\n", strerror(errno));
+        return -1;
+    }
+
+    snprintf(cPort, sizeof(cPort), "%u", g_usPort);
+    snprintf(cFd, sizeof(cFd), "%d", iPipe[1]);
+
+    g_SimPid = fork();
+    if (g_SimPid < 0)
+    {
+        fprintf(stderr, "hirc_bench: fork: %s\n", strerror(errno));
+        return -1;
+    }
+    if (g_SimPid == 0)
+    {
+        close(iPipe[0]);
+        execl(g_pcSim, g_pcSim, "-p", cPort, "-t", cFd, "-q", (char *)NULL);
+        fprintf(stderr, "hirc_bench: cannot run %s: %s\n", g_pcSim, strerror(errno));
+        _exit(127);
+    }
+    close(iPipe[1]);
+
+    if (pthread_create(&thread, NULL, TraceThread, (void *)(long)iPipe[0]) != 0)
+    {
+        fprintf(stderr, "hirc_bench: cannot start the trace reader\n");
+        return -1;
+    }
+    pthread_detach(thread);
+
+    return 0;
+}
+
+static void StopSim(void)
+{
+    if (g_SimPid > 0)
+    {
+        kill(g_SimPid, SIGTERM);
+        waitpid(g_SimPid, NULL, 0);
+        g_SimPid = -1;
+    }
+}
+
+//****************************************************************************
+//
+//! Appends the PWM trace of hirc_sim to g_pTrace until the pipe closes
+//!
+//! \param pvFd is the read end of the pipe
+//!
+//! \return NULL
+//
+//****************************************************************************
+static void *TraceThread(void *pvFd)
+{
+    int iFd = (int)(long)pvFd;
+    struct Sim_PulseEvent events[64];
+    size_t uFill = 0;
+    ssize_t iRead;
+    size_t uCount;
+
+    for (;;)
+    {
+        iRead = read(iFd, (char *)events + uFill, sizeof(events) - uFill);
+        if (iRead <= 0)
+        {
+            if (iRead < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        uFill += (size_t)iRead;
+        uCount = uFill/sizeof(events[0]);
+
+        pthread_mutex_lock(&g_TraceLock);
+        if (g_ulTraceLen + uCount > g_ulTraceCap)
+        {
+            g_ulTraceCap = g_ulTraceCap ? 2*g_ulTraceCap : 4096;
+            g_pTrace = realloc(g_pTrace, g_ulTraceCap*sizeof(*g_pTrace));
+        }
+        memcpy(&g_pTrace[g_ulTraceLen], events, uCount*sizeof(events[0]));
+        g_ulTraceLen += uCount;
+        pthread_mutex_unlock(&g_TraceLock);
+
+        // Keeps a partial record for the next read
+        memmove(events, (char *)events + uCount*sizeof(events[0]),
+                uFill - uCount*sizeof(events[0]));
+        uFill -= uCount*sizeof(events[0]);
+    }
+
+    close(iFd);
+    return NULL;
+}
+
+//****************************************************************************
+//
+//! Connects to hirc_sim once it listens and asks for normal mode
+//!
+//! \param pProfile are the socket options, set before connecting
+//!
+//! \return 0 on success, -1 on failure
+//
+//****************************************************************************
+static int Connect(const struct Profile *pProfile)
+{
+    unsigned long long ullDeadline = Now() + BENCH_CONNECT_NANOS;
+    unsigned char ucPayload[HIRCP_CRQ_PAYLOAD_LEN];
+    unsigned char ucPacket[HIRCP_MAX_PACKET_LEN];
+    struct sockaddr_in addr;
+    int iFlag = 1;
+    int iRetVal;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(g_usPort);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    g_pProfile = pProfile;
+    for (;;)
+    {
+        g_iSocket = socket(AF_INET, SOCK_STREAM, 0);
+
+        // Buffer sizes only take full effect before connecting
+        iRetVal = 0;
+        if (pProfile->bNoDelay)
+        {
+            iRetVal |= setsockopt(g_iSocket, IPPROTO_TCP, TCP_NODELAY, &iFlag, sizeof(iFlag));
+        }
+        if (pProfile->iTos >= 0)
+        {
+            iRetVal |= setsockopt(g_iSocket, IPPROTO_IP, IP_TOS, &pProfile->iTos,
+                                  sizeof(pProfile->iTos));
+        }
+        if (pProfile->iSndBuf > 0)
+        {
+            iRetVal |= setsockopt(g_iSocket, SOL_SOCKET, SO_SNDBUF, &pProfile->iSndBuf,
+                                  sizeof(pProfile->iSndBuf));
+        }
+        if (pProfile->iRcvBuf > 0)
+        {
+            iRetVal |= setsockopt(g_iSocket, SOL_SOCKET, SO_RCVBUF, &pProfile->iRcvBuf,
+                                  sizeof(pProfile->iRcvBuf));
+        }
+        if (iRetVal != 0)
+        {
+            fprintf(stderr, "hirc_bench: cannot set %s: %s\n", pProfile->cName,
+                    strerror(errno));
+            close(g_iSocket);
+            g_iSocket = -1;
+            return -1;
+        }
+        RearmQuickAck();
+
+        if (connect(g_iSocket, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+        {
+            break;
+        }
+        close(g_iSocket);
+        g_iSocket = -1;
+
+        if (Now() > ullDeadline || waitpid(g_SimPid, NULL, WNOHANG) != 0)
+        {
+            fprintf(stderr, "hirc_bench: hirc_sim is not listening on port %u\n", g_usPort);
+            return -1;
+        }
+        usleep(50000);
+    }
+
+    ucPayload[0] = HIRCP_NORMAL;
+    ucPayload[1] = g_bTimedDack ? HIRCP_OPTION_TIMED_DACK : 0;
+    if (SendPacket(HIRCP_CRQ, ucPayload, sizeof(ucPayload)) != 0 ||
+        ReceivePacket(ucPacket, Now() + BENCH_REPLY_NANOS) != 0 ||
+        ucPacket[HIRCP_CONSTANT_LEN] != HIRCP_ACK)
+    {
+        fprintf(stderr, "hirc_bench: connection refused\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+//****************************************************************************
+//
+//! Ends the connection, waiting for the firmware to acknowledge so that it
+//! is accepting again before the next Connect()
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void Disconnect(void)
+{
+    unsigned long long ullDeadline = Now() + BENCH_REPLY_NANOS;
+    unsigned char ucPacket[HIRCP_MAX_PACKET_LEN];
+
+    // DACK packets of the last poses may still be ahead of the ACK
+    if (SendPacket(HIRCP_TRQ, NULL, 0) == 0)
+    {
+        while (ReceivePacket(ucPacket, ullDeadline) == 0 &&
+               ucPacket[HIRCP_CONSTANT_LEN] != HIRCP_ACK)
+        {
+        }
+    }
+    close(g_iSocket);
+    g_iSocket = -1;
+}
+
+//****************************************************************************
+//
+//! Turns delayed ACKs off for the next segments if the connection's socket
+//! options ask for quick ACKs. Linux goes back to delayed ACKs on its own,
+//! so this follows every receive, as TCPSocket does.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void RearmQuickAck(void)
+{
+#ifdef TCP_QUICKACK
+    int iFlag = 1;
+
+    if (g_pProfile != NULL && g_pProfile->bQuickAck)
+    {
+        setsockopt(g_iSocket, IPPROTO_TCP, TCP_QUICKACK, &iFlag, sizeof(iFlag));
+    }
+#endif
+}
+
+//****************************************************************************
+//
+//! Sends a HIRCP packet, the payload padded with zeros
+//!
+//! \param ucType is the opcode
+//! \param pucPayload is the payload, NULL if iLen is 0
+//! \param iLen is its length
+//!
+//! \return 0 on success, -1 on failure
+//
+//****************************************************************************
+static int SendPacket(unsigned char ucType, const unsigned char *pucPayload, int iLen)
+{
+    unsigned char ucPacket[HIRCP_MAX_PACKET_LEN];
+
+    memset(ucPacket, 0, sizeof(ucPacket));
+    memcpy(ucPacket, "HIRC", HIRCP_CONSTANT_LEN);
+    ucPacket[HIRCP_CONSTANT_LEN] = ucType;
+    if (iLen > 0)
+    {
+        memcpy(&ucPacket[HIRCP_CONSTANT_LEN + HIRCP_OPCODE_LEN], pucPayload, iLen);
+    }
+
+    return (send(g_iSocket, ucPacket, sizeof(ucPacket), 0) == sizeof(ucPacket)) ? 0 : -1;
+}
+
+//****************************************************************************
+//
+//! Receives one whole HIRCP packet
+//!
+//! \param pucPacket receives HIRCP_MAX_PACKET_LEN bytes
+//! \param ullDeadline is when to give up, from Now()
+//!
+//! \return 0 on success, -1 on timeout or a closed connection
+//
+//****************************************************************************
+static int ReceivePacket(unsigned char *pucPacket, unsigned long long ullDeadline)
+{
+    struct pollfd pfd = { g_iSocket, POLLIN, 0 };
+    unsigned long long ullNow;
+    int iFill = 0;
+    ssize_t iRead;
+
+    while (iFill < HIRCP_MAX_PACKET_LEN)
+    {
+        ullNow = Now();
+        if (ullNow >= ullDeadline ||
+            poll(&pfd, 1, (int)((ullDeadline - ullNow)/1000000 + 1)) <= 0)
+        {
+            return -1;
+        }
+        iRead = recv(g_iSocket, pucPacket + iFill, HIRCP_MAX_PACKET_LEN - iFill, 0);
+        if (iRead <= 0)
+        {
+            return -1;
+        }
+        RearmQuickAck();
+        iFill += (int)iRead;
+    }
+
+    return 0;
+}
+
+//****************************************************************************
+//
+//! Streams poses at one rate and measures it
+//!
+//! \param dRate is the pose rate in Hz
+//! \param pRun receives the results
+//!
+//! \return 0 on success, -1 if the connection failed
+//
+//****************************************************************************
+static int RunRate(double dRate, struct Run *pRun)
+{
+    unsigned long ulFrames = (unsigned long)(g_dSeconds*dRate);
+    unsigned long long *pullCapture;
+    unsigned long long *pullSend;
+    unsigned long long ullLastChange[NUM_SERVOS];
+    unsigned long long ullStart;
+    unsigned long long ullEnd;
+    unsigned long long ullNow;
+    unsigned long long ullWake;
+    unsigned char ucPose[NUM_SERVOS];
+    unsigned char ucLast[NUM_SERVOS];
+    unsigned char ucRecv[HIRCP_MAX_PACKET_LEN];
+    struct Edge *pEdges;
+    unsigned long ulNumEdges = 0;
+    unsigned long ulNext = 0;           // Next frame to send
+    unsigned long ulAnswered = 0;       // Frames before this are answered
+    double *pdRtt;
+    double *pdGlass;
+    struct pollfd pfd = { g_iSocket, POLLIN, 0 };
+    int iFill = 0;
+    ssize_t iRead;
+    unsigned long i;
+    int j;
+
+    memset(pRun, 0, sizeof(*pRun));
+    pRun->dRate = dRate;
+    if (ulFrames == 0)
+    {
+        return 0;
+    }
+
+    pullCapture = calloc(ulFrames, sizeof(*pullCapture));
+    pullSend = calloc(ulFrames, sizeof(*pullSend));
+    pEdges = calloc(ulFrames*NUM_SERVOS, sizeof(*pEdges));
+    pdRtt = calloc(ulFrames, sizeof(*pdRtt));
+    pdGlass = calloc(ulFrames*NUM_SERVOS, sizeof(*pdGlass));
+
+    // Schedules every pose, in order even where a later one draws less delay
+    ullStart = Now() + BENCH_START_NANOS;
+    for (i = 0; i < ulFrames; i++)
+    {
+        pullCapture[i] = ullStart + (unsigned long long)(i*1e9/dRate);
+        pullSend[i] = pullCapture[i] + (unsigned long long)GetDelayNanos(i/dRate);
+        if (i > 0 && pullSend[i] < pullSend[i-1])
+        {
+            pullSend[i] = pullSend[i-1];
+        }
+    }
+    ullEnd = pullSend[ulFrames-1] + BENCH_SETTLE_NANOS;
+
+    // The first pose is a step for every joint that the previous run left
+    // elsewhere, but the joints may not be at rest yet
+    memset(ucLast, 0xFF, sizeof(ucLast));
+    for (j = 0; j < NUM_SERVOS; j++)
+    {
+        ullLastChange[j] = ullStart;
+    }
+
+    for (;;)
+    {
+        ullNow = Now();
+        while (ulNext < ulFrames && pullSend[ulNext] <= ullNow)
+        {
+            GetPose(ulNext, dRate, ucPose);
+            for (j = 0; j < NUM_SERVOS; j++)
+            {
+                if (ucPose[j] == ucLast[j])
+                {
+                    continue;
+                }
+                if (pullCapture[ulNext] - ullLastChange[j] >= BENCH_REST_NANOS)
+                {
+                    pEdges[ulNumEdges].ullCapture = pullCapture[ulNext];
+                    pEdges[ulNumEdges].ucJoint = (unsigned char)j;
+                    ulNumEdges++;
+                }
+                ullLastChange[j] = pullCapture[ulNext];
+                ucLast[j] = ucPose[j];
+            }
+
+            if (SendPacket(HIRCP_DATA, ucPose, NUM_SERVOS) != 0)
+            {
+                fprintf(stderr, "hirc_bench: connection lost\n");
+                return -1;
+            }
+            pullSend[ulNext] = Now();
+            ulNext++;
+            pRun->ulSent++;
+        }
+
+        if (ulNext == ulFrames && (ulAnswered == ulFrames || ullNow >= ullEnd))
+        {
+            break;
+        }
+
+        ullWake = (ulNext < ulFrames) ? pullSend[ulNext] : ullEnd;
+        ullNow = Now();
+        ullWake = (ullWake > ullNow) ? ullWake - ullNow : 0;
+
+        // Spins through the last millisecond before a send, poll() cannot
+        // wait for less
+        if (poll(&pfd, 1, (int)(ullWake/1000000)) <= 0)
+        {
+            continue;
+        }
+
+        iRead = recv(g_iSocket, ucRecv + iFill, sizeof(ucRecv) - iFill, 0);
+        if (iRead <= 0)
+        {
+            fprintf(stderr, "hirc_bench: connection lost\n");
+            return -1;
+        }
+        RearmQuickAck();
+        iFill += (int)iRead;
+        if (iFill < HIRCP_MAX_PACKET_LEN)
+        {
+            continue;
+        }
+        iFill = 0;
+
+        if (ucRecv[HIRCP_CONSTANT_LEN] == HIRCP_DACK && ulNext > ulAnswered)
+        {
+            ullNow = Now();
+            pdRtt[pRun->ulAcked++] = (ullNow - pullSend[ulNext-1])/1000.0;
+            pRun->ulCoalesced += ulNext - 1 - ulAnswered;
+            ulAnswered = ulNext;
+        }
+    }
+
+    // Lets the PWM catch up with the last steps before reading the trace
+    ullNow = Now();
+    if (ullNow < ullEnd)
+    {
+        usleep((useconds_t)((ullEnd - ullNow)/1000));
+    }
+
+    pRun->dSendRate = pRun->ulSent/((pullSend[ulFrames-1] - pullSend[0])/1e9 + 1/dRate);
+    pRun->dAckRate = pRun->ulAcked/((pullSend[ulFrames-1] - pullSend[0])/1e9 + 1/dRate);
+    Summarize(pdRtt, pRun->ulAcked, &pRun->rtt);
+    MeasureGlassToPwm(pEdges, ulNumEdges, pdGlass, pRun);
+
+    free(pullCapture);
+    free(pullSend);
+    free(pEdges);
+    free(pdRtt);
+    free(pdGlass);
+
+    return 0;
+}
+
+//****************************************************************************
+//
+//! Times each step from its capture to the first change of its joint's
+//! PWM pulse in the trace
+//!
+//! \param pEdges are the steps, in capture order
+//! \param ulNumEdges is how many there are
+//! \param pdSamples has room for ulNumEdges samples
+//! \param pRun receives the results
+//!
+//! \return None
+//
+//****************************************************************************
+static void MeasureGlassToPwm(const struct Edge *pEdges, unsigned long ulNumEdges,
+                              double *pdSamples, struct Run *pRun)
+{
+    const struct Sim_PulseEvent *pEvent;
+    unsigned long ulCount = 0;
+    unsigned long ulFirst = 0;          // First event at or after the step
+    tBoolean bMoving;
+    unsigned long i;
+    unsigned long k;
+
+    pthread_mutex_lock(&g_TraceLock);
+
+    for (i = 0; i < ulNumEdges; i++)
+    {
+        while (ulFirst < g_ulTraceLen && g_pTrace[ulFirst].ullMonoNanos < pEdges[i].ullCapture)
+        {
+            ulFirst++;
+        }
+
+        // Skips a joint that changed within the rest time before the step
+        bMoving = false;
+        for (k = ulFirst; k-- > 0; )
+        {
+            if (pEdges[i].ullCapture - g_pTrace[k].ullMonoNanos >= BENCH_REST_NANOS)
+            {
+                break;
+            }
+            if (g_pTrace[k].ucChannel == pEdges[i].ucJoint)
+            {
+                bMoving = true;
+                break;
+            }
+        }
+        if (bMoving)
+        {
+            pRun->ulSkipped++;
+            continue;
+        }
+
+        for (k = ulFirst; k < g_ulTraceLen; k++)
+        {
+            if (g_pTrace[k].ucChannel == pEdges[i].ucJoint)
+            {
+                break;
+            }
+        }
+        if (k == g_ulTraceLen)
+        {
+            pRun->ulMissed++;
+            continue;
+        }
+        pEvent = &g_pTrace[k];
+        pdSamples[ulCount++] = (pEvent->ullMonoNanos - pEdges[i].ullCapture)/1000.0;
+    }
+
+    pthread_mutex_unlock(&g_TraceLock);
+
+    Summarize(pdSamples, ulCount, &pRun->glass);
+}
+
+//****************************************************************************
+//
+//! Reduces samples to their nearest-rank percentiles. Sorts the samples.
+//!
+//! \param pdSamples are the samples in microseconds
+//! \param ulCount is how many there are
+//! \param pSummary receives the percentiles, all 0 if there are no samples
+//!
+//! \return None
+//
+//****************************************************************************
+static void Summarize(double *pdSamples, unsigned long ulCount, struct Summary *pSummary)
+{
+    memset(pSummary, 0, sizeof(*pSummary));
+    pSummary->ulCount = ulCount;
+    if (ulCount == 0)
+    {
+        return;
+    }
+
+    qsort(pdSamples, ulCount, sizeof(*pdSamples), CompareDoubles);
+    pSummary->dP50 = pdSamples[(unsigned long)(0.5*(ulCount - 1) + 0.5)];
+    pSummary->dP99 = pdSamples[(unsigned long)(0.99*(ulCount - 1) + 0.5)];
+    pSummary->dP999 = pdSamples[(unsigned long)(0.999*(ulCount - 1) + 0.5)];
+    pSummary->dMax = pdSamples[ulCount - 1];
+}
+
+static void PrintSummaryJson(FILE *pFile, const char *pcName, const struct Summary *pSummary)
+{
+    fprintf(pFile, "\"%s\": {\"n\": %lu, \"p50\": %.1f, \"p99\": %.1f, \"p999\": %.1f, "
+                   "\"max\": %.1f}", pcName, pSummary->ulCount, pSummary->dP50,
+                   pSummary->dP99, pSummary->dP999, pSummary->dMax);
+}
+
+//****************************************************************************
+//
+//! Prints the results as JSON to pFile and as a table to stderr
+//!
+//! \param pFile is where the JSON goes
+//! \param pRuns are the results of each set of socket options and rate
+//! \param iNumRuns is how many were run
+//!
+//! \return None
+//
+//****************************************************************************
+static void PrintReport(FILE *pFile, const struct Run *pRuns, int iNumRuns)
+{
+    const struct Run *pRun;
+    const struct Profile *pProfile;
+    int i;
+
+    fprintf(pFile, "{\n  \"benchmark\": \"hirc_bench\",\n  \"version\": 2,\n");
+    fprintf(pFile, "  \"source\": \"%s\",\n", g_pcFile ? g_pcFile : "steps");
+    fprintf(pFile, "  \"seconds\": %g,\n  \"timed_dack\": %s,\n",
+            g_dSeconds, g_bTimedDack ? "true" : "false");
+    fprintf(pFile, "  \"delay\": [");
+    for (i = 0; i < g_iNumPhases; i++)
+    {
+        fprintf(pFile, "%s{\"seconds\": %g, \"delay_ms\": %g, \"jitter_ms\": %g}",
+                i ? ", " : "", g_Phases[i].dSeconds, g_Phases[i].dDelayMs,
+                g_Phases[i].dJitterMs);
+    }
+    fprintf(pFile, "],\n  \"runs\": [\n");
+
+    for (i = 0; i < iNumRuns; i++)
+    {
+        pRun = &pRuns[i];
+        pProfile = pRun->pProfile;
+        fprintf(pFile, "    {\"socket\": {\"name\": \"%s\", \"nodelay\": %s, "
+                       "\"quickack\": %s, \"tos\": %d, \"sndbuf\": %d, \"rcvbuf\": %d},\n",
+                pProfile->cName, pProfile->bNoDelay ? "true" : "false",
+                pProfile->bQuickAck ? "true" : "false", pProfile->iTos,
+                pProfile->iSndBuf, pProfile->iRcvBuf);
+        fprintf(pFile, "     \"rate_hz\": %g, \"sent\": %lu, \"acked\": %lu, "
+                       "\"coalesced\": %lu,\n", pRun->dRate, pRun->ulSent,
+                       pRun->ulAcked, pRun->ulCoalesced);
+        fprintf(pFile, "     \"send_rate_hz\": %.2f, \"ack_rate_hz\": %.2f,\n",
+                pRun->dSendRate, pRun->dAckRate);
+        fprintf(pFile, "     ");
+        PrintSummaryJson(pFile, "rtt_us", &pRun->rtt);
+        fprintf(pFile, ",\n     ");
+        PrintSummaryJson(pFile, "glass_to_pwm_us", &pRun->glass);
+        fprintf(pFile, ",\n     \"steps_missed\": %lu, \"steps_skipped\": %lu}%s\n",
+                pRun->ulMissed, pRun->ulSkipped, (i < iNumRuns - 1) ? "," : "");
+    }
+    fprintf(pFile, "  ]\n}\n");
+
+    fprintf(stderr, "%-20s %8s %8s %8s | %9s %9s %9s | %9s %9s %9s %6s\n", "socket",
+            "rate", "sent/s", "ack/s", "rtt p50", "p99", "p99.9", "g2p p50", "p99", "p99.9",
+            "n");
+    for (i = 0; i < iNumRuns; i++)
+    {
+        pRun = &pRuns[i];
+        fprintf(stderr, "%-20.20s %8g %8.1f %8.1f | %9.0f %9.0f %9.0f | %9.0f %9.0f %9.0f "
+                "%6lu\n", pRun->pProfile->cName, pRun->dRate, pRun->dSendRate, pRun->dAckRate, pRun->rtt.dP50,
+                pRun->rtt.dP99, pRun->rtt.dP999, pRun->glass.dP50, pRun->glass.dP99,
+                pRun->glass.dP999, pRun->glass.ulCount);
+    }
+    fprintf(stderr, "(microseconds)\n");
+}
+
+static unsigned long long Now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec*1000000000ULL + now.tv_nsec;
+}
+
+static int CompareDoubles(const void *pvA, const void *pvB)
+{
+    double dA = *(const double *)pvA;
+    double dB = *(const double *)pvB;
+
+    return (dA > dB) - (dA < dB);
+}
@@ -0,0 +1,34 @@
+#ifndef __HOST_ADC_H__
+#define __HOST_ADC_H__
+//*****************************************************************************
+//
+// adc.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. The ADC FIFOs are filled from the hand model in sim/sim_adc.c.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define ADC_CH_0    0x00000000
+#define ADC_CH_1    0x00000008
+#define ADC_CH_2    0x00000010
+#define ADC_CH_3    0x00000018
+
+void ADCEnable(unsigned long ulBase);
+void ADCDisable(unsigned long ulBase);
+void ADCChannelEnable(unsigned long ulBase, unsigned long ulChannel);
+void ADCChannelDisable(unsigned long ulBase, unsigned long ulChannel);
+unsigned char ADCFIFOLvlGet(unsigned long ulBase, unsigned long ulChannel);
+unsigned long ADCFIFORead(unsigned long ulBase, unsigned long ulChannel);
+
+#endif //  __HOST_ADC_H__
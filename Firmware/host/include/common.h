@@ -0,0 +1,62 @@
+#ifndef __HOST_COMMON_H__
+#define __HOST_COMMON_H__
+//*****************************************************************************
+//
+// common.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Same macros as the SDK's common interface header.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define UART_PRINT              Report
+#define DBG_PRINT               Report
+#define ERR_PRINT(x)            Report("Error [%d] at line [%d] in function [%s]  \n\r",x,__LINE__,__FUNCTION__)
+
+#define SUCCESS                 0
+#define FAILURE                 -1
+
+#define SL_STOP_TIMEOUT         200
+
+// Loop forever, user can change it as per application's requirement
+#define LOOP_FOREVER() \
+            {\
+                while(1); \
+            }
+
+// check the error code and handle it
+#define ASSERT_ON_ERROR(error_code)\
+            {\
+                 if(error_code < 0) \
+                   {\
+                        ERR_PRINT(error_code);\
+                        return error_code;\
+                 }\
+            }
+
+// Status bits - These are used to set/reset the corresponding bits in
+// given variable
+#define STATUS_BIT_CONNECTION           0
+#define STATUS_BIT_IP_AQUIRED           1
+
+#define CLR_STATUS_BIT_ALL(status_variable)   (status_variable = 0)
+#define SET_STATUS_BIT(status_variable, bit)  status_variable |= (1<<(bit))
+#define CLR_STATUS_BIT(status_variable, bit)  status_variable &= ~(1<<(bit))
+#define GET_STATUS_BIT(status_variable, bit)  (0 != (status_variable & (1<<(bit))))
+
+#define IS_CONNECTED(status_variable)         GET_STATUS_BIT(status_variable, \
+                                                             STATUS_BIT_CONNECTION)
+#define IS_IP_ACQUIRED(status_variable)       GET_STATUS_BIT(status_variable, \
+                                                             STATUS_BIT_IP_AQUIRED)
+
+#endif //  __HOST_COMMON_H__
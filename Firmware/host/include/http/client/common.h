@@ -0,0 +1,24 @@
+#ifndef __HOST_HTTP_CLIENT_COMMON_H__
+#define __HOST_HTTP_CLIENT_COMMON_H__
+//*****************************************************************************
+//
+// http/client/common.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. The HTTP client is only used by the WLAN code, which the host build leaves out.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+
+
+#endif //  __HOST_HTTP_CLIENT_COMMON_H__
@@ -0,0 +1,26 @@
+#ifndef __HOST_HW_ADC_H__
+#define __HOST_HW_ADC_H__
+//*****************************************************************************
+//
+// hw_adc.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Writes to these registers are accepted and ignored.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define ADC_O_ADC_CTRL              0x00000000
+#define ADC_O_ADC_SPARE0            0x00000100
+#define ADC_O_ADC_SPARE1            0x00000104
+
+#endif //  __HOST_HW_ADC_H__
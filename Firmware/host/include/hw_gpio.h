@@ -0,0 +1,24 @@
+#ifndef __HOST_HW_GPIO_H__
+#define __HOST_HW_GPIO_H__
+//*****************************************************************************
+//
+// hw_gpio.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Nothing in it is used by the firmware.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+
+
+#endif //  __HOST_HW_GPIO_H__
@@ -0,0 +1,24 @@
+#ifndef __HOST_HW_GPRCM_H__
+#define __HOST_HW_GPRCM_H__
+//*****************************************************************************
+//
+// hw_gprcm.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Writes to these registers are accepted and ignored.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define GPRCM_O_ADC_CLK_CONFIG      0x000000B8
+
+#endif //  __HOST_HW_GPRCM_H__
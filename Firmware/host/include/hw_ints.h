@@ -0,0 +1,36 @@
+#ifndef __HOST_HW_INTS_H__
+#define __HOST_HW_INTS_H__
+//*****************************************************************************
+//
+// hw_ints.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Interrupt numbers index the simulated interrupt controller.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define FAULT_SYSTICK   15
+#define INT_UARTA0      21
+#define INT_I2CA0       24
+#define INT_TIMERA0A    35
+#define INT_TIMERA0B    36
+#define INT_TIMERA1A    37
+#define INT_TIMERA1B    38
+#define INT_TIMERA2A    39
+#define INT_TIMERA2B    40
+#define INT_TIMERA3A    51
+#define INT_TIMERA3B    52
+
+#define NUM_INTERRUPTS  64
+
+#endif //  __HOST_HW_INTS_H__
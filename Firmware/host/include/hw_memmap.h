@@ -0,0 +1,31 @@
+#ifndef __HOST_HW_MEMMAP_H__
+#define __HOST_HW_MEMMAP_H__
+//*****************************************************************************
+//
+// hw_memmap.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Only the base addresses are used, to tell peripherals apart.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define UARTA0_BASE     0x4000C000
+#define I2CA0_BASE      0x40020000
+#define TIMERA0_BASE    0x40030000
+#define TIMERA1_BASE    0x40031000
+#define TIMERA2_BASE    0x40032000
+#define TIMERA3_BASE    0x40033000
+#define GPRCM_BASE      0x4402D000
+#define ADC_BASE        0x4402E800
+
+#endif //  __HOST_HW_MEMMAP_H__
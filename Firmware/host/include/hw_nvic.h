@@ -0,0 +1,25 @@
+#ifndef __HOST_HW_NVIC_H__
+#define __HOST_HW_NVIC_H__
+//*****************************************************************************
+//
+// hw_nvic.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Only the SysTick pending bit is modelled.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define NVIC_INT_CTRL               0xE000ED04
+#define NVIC_INT_CTRL_PENDSTSET     0x04000000
+
+#endif //  __HOST_HW_NVIC_H__
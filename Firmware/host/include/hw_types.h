@@ -0,0 +1,38 @@
+#ifndef __HOST_HW_TYPES_H__
+#define __HOST_HW_TYPES_H__
+//*****************************************************************************
+//
+// hw_types.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Register accesses go through the simulator instead of memory.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+
+typedef unsigned char tBoolean;
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+// Returns the simulated register at an address
+volatile unsigned long *SimHwReg(unsigned long ulAddr);
+
+#define HWREG(x)    (*SimHwReg((unsigned long)(x)))
+
+#endif //  __HOST_HW_TYPES_H__
@@ -0,0 +1,63 @@
+#ifndef __HOST_I2C_H__
+#define __HOST_I2C_H__
+//*****************************************************************************
+//
+// i2c.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. The I2C master is modelled in sim/sim_i2c.c, with devices attached to a simulated bus.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+
+#define I2C_MASTER_CMD_SINGLE_SEND              0x00000007
+#define I2C_MASTER_CMD_SINGLE_RECEIVE           0x00000007
+#define I2C_MASTER_CMD_BURST_SEND_START         0x00000003
+#define I2C_MASTER_CMD_BURST_SEND_CONT          0x00000001
+#define I2C_MASTER_CMD_BURST_SEND_FINISH        0x00000005
+#define I2C_MASTER_CMD_BURST_SEND_STOP          0x00000004
+#define I2C_MASTER_CMD_BURST_SEND_ERROR_STOP    0x00000004
+#define I2C_MASTER_CMD_BURST_RECEIVE_START      0x0000000b
+#define I2C_MASTER_CMD_BURST_RECEIVE_CONT       0x00000009
+#define I2C_MASTER_CMD_BURST_RECEIVE_FINISH     0x00000005
+#define I2C_MASTER_CMD_BURST_RECEIVE_ERROR_STOP 0x00000004
+
+#define I2C_MASTER_ERR_NONE         0
+#define I2C_MASTER_ERR_ADDR_ACK     0x00000004
+#define I2C_MASTER_ERR_DATA_ACK     0x00000008
+#define I2C_MASTER_ERR_ARB_LOST     0x00000010
+
+#define I2C_INT_MASTER              0x00000001
+
+#define I2C_MASTER_INT_DATA         0x00000001
+#define I2C_MASTER_INT_TIMEOUT      0x00000002
+#define I2C_MASTER_INT_NACK         0x00000004
+
+void I2CMasterInitExpClk(unsigned long ulBase, unsigned long ulI2CClk, tBoolean bFast);
+void I2CMasterEnable(unsigned long ulBase);
+void I2CMasterDisable(unsigned long ulBase);
+void I2CMasterTimeoutSet(unsigned long ulBase, unsigned long ulValue);
+void I2CMasterSlaveAddrSet(unsigned long ulBase, unsigned char ucSlaveAddr, tBoolean bReceive);
+void I2CMasterControl(unsigned long ulBase, unsigned long ulCmd);
+void I2CMasterDataPut(unsigned long ulBase, unsigned char ucData);
+unsigned long I2CMasterDataGet(unsigned long ulBase);
+unsigned long I2CMasterErr(unsigned long ulBase);
+tBoolean I2CMasterBusy(unsigned long ulBase);
+void I2CIntRegister(unsigned long ulBase, void (*pfnHandler)(void));
+void I2CMasterIntEnableEx(unsigned long ulBase, unsigned long ulIntFlags);
+void I2CMasterIntDisableEx(unsigned long ulBase, unsigned long ulIntFlags);
+unsigned long I2CMasterIntStatusEx(unsigned long ulBase, tBoolean bMasked);
+void I2CMasterIntClearEx(unsigned long ulBase, unsigned long ulIntFlags);
+
+#endif //  __HOST_I2C_H__
@@ -0,0 +1,33 @@
+#ifndef __HOST_INTERRUPT_H__
+#define __HOST_INTERRUPT_H__
+//*****************************************************************************
+//
+// interrupt.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Interrupts are delivered by the simulated interrupt controller in sim/sim_nvic.c.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+
+void IntRegister(unsigned long ulInterrupt, void (*pfnHandler)(void));
+void IntUnregister(unsigned long ulInterrupt);
+void IntEnable(unsigned long ulInterrupt);
+void IntDisable(unsigned long ulInterrupt);
+void IntVTableBaseSet(unsigned long ulVtableBase);
+void IntPrioritySet(unsigned long ulInterrupt, unsigned char ucPriority);
+tBoolean IntMasterEnable(void);
+tBoolean IntMasterDisable(void);
+
+#endif //  __HOST_INTERRUPT_H__
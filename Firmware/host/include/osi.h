@@ -0,0 +1,57 @@
+#ifndef __HOST_OSI_H__
+#define __HOST_OSI_H__
+//*****************************************************************************
+//
+// osi.h
+//
+// Host stand-in for the CC3200 SDK OS abstraction header of the same name. Tasks and message queues are carried by host threads in sim/sim_osi.c; only the calls the firmware uses are available.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define OSI_WAIT_FOREVER        (0xFFFFFFFF)
+#define OSI_NO_WAIT             (0)
+
+typedef enum
+{
+    OSI_OK = 0,
+    OSI_FAILURE = -1,
+    OSI_OPERATION_FAILED = -2,
+    OSI_ABORTED = -3,
+    OSI_INVALID_PARAMS = -4,
+    OSI_MEMORY_ALLOCATION_FAILURE = -5,
+    OSI_TIMEOUT = -6,
+    OSI_EVENTS_IN_USE = -7,
+    OSI_EVENT_OPEARTION_FAILURE = -8
+} OsiReturnVal_e;
+
+typedef void *OsiMsgQ_t;
+typedef void *OsiTaskHandle;
+typedef unsigned int OsiTime_t;
+
+typedef void (*P_OSI_TASK_ENTRY)(void *pValue);
+
+OsiReturnVal_e osi_TaskCreate(P_OSI_TASK_ENTRY pEntry, const signed char * const pcName,
+                              unsigned short usStackDepth, void *pvParameters,
+                              unsigned long uxPriority, OsiTaskHandle *pTaskHandle);
+OsiReturnVal_e osi_MsgQCreate(OsiMsgQ_t *pMsgQ, char *pMsgQName,
+                              unsigned long MsgSize, unsigned long MaxMsgs);
+OsiReturnVal_e osi_MsgQWrite(OsiMsgQ_t *pMsgQ, void *pMsg, OsiTime_t Timeout);
+OsiReturnVal_e osi_MsgQRead(OsiMsgQ_t *pMsgQ, void *pMsg, OsiTime_t Timeout);
+void osi_Sleep(unsigned int MilliSecs);
+void osi_start(void);
+
+// The simulated network processor needs no spawn task
+OsiReturnVal_e VStartSimpleLinkSpawnTask(unsigned long uxPriority);
+
+#endif //  __HOST_OSI_H__
@@ -0,0 +1,47 @@
+#ifndef __HOST_PIN_H__
+#define __HOST_PIN_H__
+//*****************************************************************************
+//
+// pin.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Pin muxing is accepted and ignored.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+
+#define PIN_01              0x00000000
+#define PIN_02              0x00000001
+#define PIN_03              0x00000002
+#define PIN_04              0x00000003
+#define PIN_50              0x00000031
+#define PIN_52              0x00000033
+#define PIN_57              0x00000038
+#define PIN_58              0x00000039
+#define PIN_59              0x0000003A
+#define PIN_60              0x0000003B
+
+#define PIN_MODE_1          0x00000001
+#define PIN_MODE_6          0x00000006
+#define PIN_MODE_7          0x00000007
+#define PIN_MODE_12         0x0000000C
+#define PIN_MODE_255        0x000000FF
+
+void PinTypeUART(unsigned long ulPin, unsigned long ulPinMode);
+void PinTypeI2C(unsigned long ulPin, unsigned long ulPinMode);
+void PinTypeADC(unsigned long ulPin, unsigned long ulPinMode);
+void PinTypeTimer(unsigned long ulPin, unsigned long ulPinMode);
+void PinTypeGPIO(unsigned long ulPin, unsigned long ulPinMode, tBoolean bOpenDrain);
+
+#endif //  __HOST_PIN_H__
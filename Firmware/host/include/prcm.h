@@ -0,0 +1,38 @@
+#ifndef __HOST_PRCM_H__
+#define __HOST_PRCM_H__
+//*****************************************************************************
+//
+// prcm.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Clock gating is accepted and ignored.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define PRCM_RUN_MODE_CLK   0x00000001
+#define PRCM_SLP_MODE_CLK   0x00000100
+
+#define PRCM_UARTA0         0x00000003
+#define PRCM_TIMERA0        0x0000000B
+#define PRCM_TIMERA1        0x0000000C
+#define PRCM_TIMERA2        0x0000000D
+#define PRCM_TIMERA3        0x0000000E
+#define PRCM_I2CA0          0x00000012
+#define PRCM_ADC            0x000000FF
+
+void PRCMCC3200MCUInit(void);
+void PRCMPeripheralClkEnable(unsigned long ulPeripheral, unsigned long ulClkFlags);
+void PRCMPeripheralClkDisable(unsigned long ulPeripheral, unsigned long ulClkFlags);
+void PRCMPeripheralReset(unsigned long ulPeripheral);
+
+#endif //  __HOST_PRCM_H__
@@ -0,0 +1,79 @@
+#ifndef __HOST_ROM_MAP_H__
+#define __HOST_ROM_MAP_H__
+//*****************************************************************************
+//
+// rom_map.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Every MAP_ call resolves to the driverlib stand-in of the same name.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#define MAP_IntRegister                 IntRegister
+#define MAP_IntUnregister               IntUnregister
+#define MAP_IntEnable                   IntEnable
+#define MAP_IntDisable                  IntDisable
+#define MAP_IntVTableBaseSet            IntVTableBaseSet
+#define MAP_IntPrioritySet              IntPrioritySet
+#define MAP_IntMasterEnable             IntMasterEnable
+#define MAP_IntMasterDisable            IntMasterDisable
+
+#define MAP_PRCMPeripheralClkEnable     PRCMPeripheralClkEnable
+#define MAP_PRCMPeripheralClkDisable    PRCMPeripheralClkDisable
+#define MAP_PRCMPeripheralReset         PRCMPeripheralReset
+
+#define MAP_UtilsDelay                  UtilsDelay
+
+#define MAP_SysTickEnable               SysTickEnable
+#define MAP_SysTickDisable              SysTickDisable
+#define MAP_SysTickIntRegister          SysTickIntRegister
+#define MAP_SysTickIntUnregister        SysTickIntUnregister
+#define MAP_SysTickIntEnable            SysTickIntEnable
+#define MAP_SysTickIntDisable           SysTickIntDisable
+#define MAP_SysTickPeriodSet            SysTickPeriodSet
+#define MAP_SysTickPeriodGet            SysTickPeriodGet
+#define MAP_SysTickValueGet             SysTickValueGet
+
+#define MAP_TimerConfigure              TimerConfigure
+#define MAP_TimerControlLevel           TimerControlLevel
+#define MAP_TimerPrescaleSet            TimerPrescaleSet
+#define MAP_TimerPrescaleMatchSet       TimerPrescaleMatchSet
+#define MAP_TimerLoadSet                TimerLoadSet
+#define MAP_TimerMatchSet               TimerMatchSet
+#define MAP_TimerEnable                 TimerEnable
+#define MAP_TimerDisable                TimerDisable
+
+#define MAP_I2CMasterInitExpClk         I2CMasterInitExpClk
+#define MAP_I2CMasterEnable             I2CMasterEnable
+#define MAP_I2CMasterDisable            I2CMasterDisable
+#define MAP_I2CMasterTimeoutSet         I2CMasterTimeoutSet
+#define MAP_I2CMasterSlaveAddrSet       I2CMasterSlaveAddrSet
+#define MAP_I2CMasterControl            I2CMasterControl
+#define MAP_I2CMasterDataPut            I2CMasterDataPut
+#define MAP_I2CMasterDataGet            I2CMasterDataGet
+#define MAP_I2CMasterErr                I2CMasterErr
+#define MAP_I2CMasterBusy               I2CMasterBusy
+#define MAP_I2CIntRegister              I2CIntRegister
+#define MAP_I2CMasterIntEnableEx        I2CMasterIntEnableEx
+#define MAP_I2CMasterIntDisableEx       I2CMasterIntDisableEx
+#define MAP_I2CMasterIntStatusEx        I2CMasterIntStatusEx
+#define MAP_I2CMasterIntClearEx         I2CMasterIntClearEx
+
+#define MAP_ADCEnable                   ADCEnable
+#define MAP_ADCDisable                  ADCDisable
+#define MAP_ADCChannelEnable            ADCChannelEnable
+#define MAP_ADCChannelDisable           ADCChannelDisable
+#define MAP_ADCFIFOLvlGet               ADCFIFOLvlGet
+#define MAP_ADCFIFORead                 ADCFIFORead
+
+#endif //  __HOST_ROM_MAP_H__
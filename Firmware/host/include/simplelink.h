@@ -0,0 +1,149 @@
+#ifndef __HOST_SIMPLELINK_H__
+#define __HOST_SIMPLELINK_H__
+//*****************************************************************************
+//
+// simplelink.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. The BSD socket calls are carried by host sockets in sim/sim_simplelink.c; of the network configuration only the MAC address can be read, and the WLAN, NetApp and device APIs are not available.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+typedef unsigned char   _u8;
+typedef signed char     _i8;
+typedef unsigned short  _u16;
+typedef signed short    _i16;
+typedef unsigned int    _u32;     // 32 bits, as on the CC3200
+typedef signed int      _i32;
+
+#define SL_DRIVER_VERSION       "host"
+
+//*****************************************************************************
+// Socket definitions
+//*****************************************************************************
+#define SL_AF_INET              2
+#define SL_SOCK_STREAM          1
+#define SL_SOCK_DGRAM           2
+#define SL_IPPROTO_TCP          6
+#define SL_IPPROTO_UDP          17
+
+#define SL_SOL_SOCKET           1
+#define SL_SO_RCVBUF            8
+#define SL_SO_RCVTIMEO          20
+#define SL_SO_NONBLOCKING       24
+
+#define SL_INADDR_ANY           0
+
+#define SL_SOC_OK               0
+#define SL_SOC_ERROR            -1
+#define SL_EBADF                -9
+#define SL_EAGAIN               -11
+#define SL_EINVAL               -22
+
+#define SL_IPV4_VAL(add_3,add_2,add_1,add_0)    ((((_u32)add_3 << 24) & 0xFF000000) | (((_u32)add_2 << 16) & 0xFF0000) | (((_u32)add_1 << 8) & 0xFF00) | ((_u32)add_0 & 0xFF) )
+#define SL_IPV4_BYTE(val,index)                 ( (val >> (index*8)) & 0xFF )
+
+typedef _u16 SlSocklen_t;
+
+typedef struct SlSockAddr_t
+{
+    _u16          sa_family;
+    _u8           sa_data[14];
+} SlSockAddr_t;
+
+typedef struct SlInAddr_t
+{
+    _u32          s_addr;
+} SlInAddr_t;
+
+typedef struct SlSockAddrIn_t
+{
+    _u16          sin_family;
+    _u16          sin_port;
+    SlInAddr_t    sin_addr;
+    _i8           sin_zero[8];
+} SlSockAddrIn_t;
+
+typedef struct SlTimeval_t
+{
+    _i32          tv_sec;
+    _i32          tv_usec;
+} SlTimeval_t;
+
+typedef struct
+{
+    _u32          NonblockingEnabled;
+} SlSockNonblocking_t;
+
+typedef struct
+{
+    _i32          Winsize;
+} SlSockWinsize_t;
+
+// Host socket numbers run past the CC3200's eight sockets
+#define SL_FD_SETSIZE           64
+
+typedef struct
+{
+    _u32          fd_array[(SL_FD_SETSIZE + 31)/32];
+} SlFdSet_t;
+
+//*****************************************************************************
+// Event types named by the asynchronous event handler prototypes
+//*****************************************************************************
+typedef struct SlWlanEvent_t SlWlanEvent_t;
+typedef struct SlNetAppEvent_t SlNetAppEvent_t;
+typedef struct SlDeviceEvent_t SlDeviceEvent_t;
+typedef struct SlSockEvent_t SlSockEvent_t;
+typedef struct SlHttpServerEvent_t SlHttpServerEvent_t;
+typedef struct SlHttpServerResponse_t SlHttpServerResponse_t;
+
+//*****************************************************************************
+// Device
+//*****************************************************************************
+_i16 sl_Start(const void *pIfHdl, _i8 *pDevName, const void *pInitCallBack);
+_i16 sl_Stop(_u16 timeout);
+
+//*****************************************************************************
+// Network configuration
+//*****************************************************************************
+#define SL_MAC_ADDR_LEN         6
+#define SL_MAC_ADDRESS_GET      2
+
+_i32 sl_NetCfgGet(_u8 ConfigId, _u8 *pConfigOpt, _u8 *pConfigLen, _u8 *pValues);
+
+//*****************************************************************************
+// BSD sockets
+//*****************************************************************************
+_i16 sl_Socket(_i16 Domain, _i16 Type, _i16 Protocol);
+_i16 sl_Close(_i16 sd);
+_i16 sl_Bind(_i16 sd, const SlSockAddr_t *addr, _i16 addrlen);
+_i16 sl_Listen(_i16 sd, _i16 backlog);
+_i16 sl_Accept(_i16 sd, SlSockAddr_t *addr, SlSocklen_t *addrlen);
+_i16 sl_Recv(_i16 sd, void *buf, _i16 Len, _i16 flags);
+_i16 sl_Send(_i16 sd, const void *buf, _i16 Len, _i16 flags);
+_i16 sl_SendTo(_i16 sd, const void *buf, _i16 Len, _i16 flags,
+                const SlSockAddr_t *to, SlSocklen_t tolen);
+_i16 sl_SetSockOpt(_i16 sd, _i16 level, _i16 optname, const void *optval, SlSocklen_t optlen);
+_i16 sl_Select(_i16 nfds, SlFdSet_t *readsds, SlFdSet_t *writesds, SlFdSet_t *exceptsds,
+               struct SlTimeval_t *timeout);
+
+void SL_FD_SET(_i16 fd, SlFdSet_t *fdset);
+void SL_FD_CLR(_i16 fd, SlFdSet_t *fdset);
+_i16 SL_FD_ISSET(_i16 fd, SlFdSet_t *fdset);
+void SL_FD_ZERO(SlFdSet_t *fdset);
+
+_u32 sl_Htonl(_u32 val);
+_u16 sl_Htons(_u16 val);
+
+#endif //  __HOST_SIMPLELINK_H__
@@ -0,0 +1,32 @@
+#ifndef __HOST_SYSTICK_H__
+#define __HOST_SYSTICK_H__
+//*****************************************************************************
+//
+// systick.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. SysTick is modelled on the host monotonic clock in sim/sim_timers.c.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+void SysTickEnable(void);
+void SysTickDisable(void);
+void SysTickIntRegister(void (*pfnHandler)(void));
+void SysTickIntUnregister(void);
+void SysTickIntEnable(void);
+void SysTickIntDisable(void);
+void SysTickPeriodSet(unsigned long ulPeriod);
+unsigned long SysTickPeriodGet(void);
+unsigned long SysTickValueGet(void);
+
+#endif //  __HOST_SYSTICK_H__
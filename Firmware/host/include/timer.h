@@ -0,0 +1,48 @@
+#ifndef __HOST_TIMER_H__
+#define __HOST_TIMER_H__
+//*****************************************************************************
+//
+// timer.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Only timers driven through timer_if.h raise interrupts; the GPT PWM calls used by servo_driver.c are accepted and ignored.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+
+#define TIMER_CFG_ONE_SHOT          0x00000021
+#define TIMER_CFG_ONE_SHOT_UP       0x00000031
+#define TIMER_CFG_PERIODIC          0x00000022
+#define TIMER_CFG_PERIODIC_UP       0x00000032
+#define TIMER_CFG_SPLIT_PAIR        0x04000000
+#define TIMER_CFG_A_PWM             0x0000000A
+#define TIMER_CFG_B_PWM             0x00000A00
+
+#define TIMER_TIMA_TIMEOUT          0x00000001
+#define TIMER_TIMB_TIMEOUT          0x00000100
+
+#define TIMER_A                     0x000000FF
+#define TIMER_B                     0x0000FF00
+#define TIMER_BOTH                  0x0000FFFF
+
+void TimerConfigure(unsigned long ulBase, unsigned long ulConfig);
+void TimerControlLevel(unsigned long ulBase, unsigned long ulTimer, tBoolean bInvert);
+void TimerPrescaleSet(unsigned long ulBase, unsigned long ulTimer, unsigned long ulValue);
+void TimerPrescaleMatchSet(unsigned long ulBase, unsigned long ulTimer, unsigned long ulValue);
+void TimerLoadSet(unsigned long ulBase, unsigned long ulTimer, unsigned long ulValue);
+void TimerMatchSet(unsigned long ulBase, unsigned long ulTimer, unsigned long ulValue);
+void TimerEnable(unsigned long ulBase, unsigned long ulTimer);
+void TimerDisable(unsigned long ulBase, unsigned long ulTimer);
+
+#endif //  __HOST_TIMER_H__
@@ -0,0 +1,36 @@
+#ifndef __HOST_TIMER_IF_H__
+#define __HOST_TIMER_IF_H__
+//*****************************************************************************
+//
+// timer_if.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. Periodic timers raise their interrupt from the simulator tick in sim/sim_timers.c, with millisecond resolution.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+void Timer_IF_Init(unsigned long ePeripheralc, unsigned long ulBase,
+                   unsigned long ulConfig, unsigned long ulTimer,
+                   unsigned long ulValue);
+void Timer_IF_IntSetup(unsigned long ulBase, unsigned long ulTimer,
+                       void (*TimerBaseIntHandler)(void));
+void Timer_IF_InterruptClear(unsigned long ulBase);
+void Timer_IF_Start(unsigned long ulBase, unsigned long ulTimer,
+                    unsigned long ulValue);
+void Timer_IF_Stop(unsigned long ulBase, unsigned long ulTimer);
+void Timer_IF_DeInit(unsigned long ulBase, unsigned long ulTimer);
+void Timer_IF_ReLoad(unsigned long ulBase, unsigned long ulTimer,
+                     unsigned long ulValue);
+unsigned int Timer_IF_GetCount(unsigned long ulBase, unsigned long ulTimer);
+
+#endif //  __HOST_TIMER_IF_H__
@@ -0,0 +1,24 @@
+#ifndef __HOST_UART_H__
+#define __HOST_UART_H__
+//*****************************************************************************
+//
+// uart.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. The terminal is provided by uart_if.h.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+
+
+#endif //  __HOST_UART_H__
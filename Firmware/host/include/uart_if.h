@@ -0,0 +1,28 @@
+#ifndef __HOST_UART_IF_H__
+#define __HOST_UART_IF_H__
+//*****************************************************************************
+//
+// uart_if.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. The terminal is the simulator's stdin and stdout.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+void InitTerm(void);
+void ClearTerm(void);
+void Message(const char *format);
+int GetCmd(char *pcBuffer, unsigned int uiBufLen);
+int Report(const char *format, ...);
+
+#endif //  __HOST_UART_IF_H__
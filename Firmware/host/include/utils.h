@@ -0,0 +1,24 @@
+#ifndef __HOST_UTILS_H__
+#define __HOST_UTILS_H__
+//*****************************************************************************
+//
+// utils.h
+//
+// Host stand-in for the CC3200 SDK header of the same name. UtilsDelay() sleeps for the time the loop would take at 80 MHz.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+void UtilsDelay(unsigned long ulCount);
+
+#endif //  __HOST_UTILS_H__
@@ -0,0 +1,120 @@
+#ifndef __SIM_H__
+#define __SIM_H__
+//*****************************************************************************
+//
+// sim.h
+//
+// Interfaces between the parts of the robot simulator. The firmware only
+// sees the SDK stand-ins under include/; the functions here are used by the
+// simulated peripherals to reach each other and by sim_main.c to set them
+// up.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+
+#include "adc_driver_if.h"
+
+//****************************************************************************
+// Host time since the simulator started
+//****************************************************************************
+unsigned long long Sim_GetNanos(void);
+unsigned long long Sim_GetMicros(void);
+
+//****************************************************************************
+// Interrupt controller (sim_nvic.c)
+//
+// Interrupts run one at a time, either straight away when raised from the
+// firmware with interrupts enabled, or from the 1 ms host timer signal that
+// drives SysTick and the general purpose timers.
+//****************************************************************************
+#define SIM_TICK_US     1000
+
+void Sim_StartTick(void);
+void Sim_RaiseInterrupt(unsigned long ulInterrupt);
+
+//****************************************************************************
+// Timers (sim_timers.c). Called from the host timer signal to raise the
+// interrupts of timers that have expired.
+//****************************************************************************
+void Sim_PollTimers(unsigned long long ullNanos);
+tBoolean Sim_SysTickPending(void);
+
+//****************************************************************************
+// OS abstraction (sim_osi.c). A task calls these around a host call that
+// may block, so other tasks can run meanwhile. No-ops outside tasks.
+//****************************************************************************
+void Sim_OsiBlock(void);
+void Sim_OsiUnblock(void);
+
+//****************************************************************************
+// I2C bus (sim_i2c.c). A device sees a start condition with the direction,
+// one call per byte, and a stop condition. pfnWrite returns false to NACK.
+//****************************************************************************
+#define SIM_I2C_MAX_DEVICES     4
+
+struct Sim_I2CDevice {
+    unsigned char ucAddr;
+    void (*pfnStart)(tBoolean bRead);
+    tBoolean (*pfnWrite)(unsigned char ucData);
+    unsigned char (*pfnRead)(void);
+    void (*pfnStop)(void);
+};
+
+int Sim_I2CAttach(const struct Sim_I2CDevice *pDevice);
+
+//****************************************************************************
+// PWM breakout board (sim_pca9685.c)
+//****************************************************************************
+void Sim_PCA9685Init(unsigned char ucAddr);
+
+// Returns the pulse width on a channel in microseconds, 0 when it is off
+unsigned long Sim_PCA9685GetPulse(unsigned char ucChannel);
+
+// One change of pulse width, written to the trace in host byte order. The
+// time is CLOCK_MONOTONIC, so another process on the host can compare it
+// with its own clock.
+struct Sim_PulseEvent {
+    unsigned long long ullMonoNanos;
+    unsigned long ulPulse;              // Microseconds, 0 when off
+    unsigned char ucChannel;
+};
+
+// Writes a Sim_PulseEvent to iFd whenever a channel changes, -1 to stop.
+// Events are dropped rather than stall the bus if iFd is full.
+void Sim_PCA9685SetTrace(int iFd);
+
+//****************************************************************************
+// ADC breakout board (sim_ads1015.c)
+//****************************************************************************
+void Sim_ADS1015Init(unsigned char ucAddr);
+
+//****************************************************************************
+// Hand model (sim_hand.c). Each finger servo follows its PWM pulse at a
+// limited speed, and each finger-tip sensor reading is a piecewise-linear
+// curve of the servo pulse width. Lower readings mean more pressure.
+//****************************************************************************
+#define SIM_HAND_MAX_POINTS     8
+
+int Sim_HandLoadScript(const char *pcPath);
+unsigned short Sim_HandGetReading(enum Fingertip_Sensor_Type eFingerSensor);
+
+//****************************************************************************
+// Options (sim_main.c)
+//****************************************************************************
+extern unsigned short g_usSimPort;      // Port to listen on, 0 for the firmware's
+extern unsigned long g_ulSimBroadcastAddr; // Where broadcasts go, 0 to broadcast
+extern tBoolean g_bSimQuiet;            // Drop the firmware's terminal output
+
+#endif //  __SIM_H__
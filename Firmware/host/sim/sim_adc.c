@@ -0,0 +1,96 @@
+//*****************************************************************************
+//
+// sim_adc.c
+//
+// Simulated CC3200 ADC. An enabled channel samples continuously, so its
+// FIFO is always full; each FIFO entry holds the sensor reading from the
+// hand model in bits 13:2. Channels that the firmware leaves disabled, such
+// as channel 0 while UART0 RX is in use, never have samples.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+#include "adc.h"
+
+#include "adc_driver_if.h"
+#include "sim.h"
+
+#define ADC_NUM_CHANNELS    4
+#define ADC_FIFO_DEPTH      4
+#define ADC_MAX_CODE        4095
+
+// Sensor wired to each channel, pins 57 to 60
+static const enum Fingertip_Sensor_Type g_eChannelSensor[ADC_NUM_CHANNELS] = {
+    SENSOR_FINGER_INDEX,
+    SENSOR_FINGER_THUMB,
+    SENSOR_FINGER_MIDDLE,
+    SENSOR_FINGER_RING
+};
+
+static tBoolean g_bEnabled = false;
+static tBoolean g_bChannelEnabled[ADC_NUM_CHANNELS];
+
+void ADCEnable(unsigned long ulBase)
+{
+    g_bEnabled = true;
+}
+
+void ADCDisable(unsigned long ulBase)
+{
+    g_bEnabled = false;
+}
+
+void ADCChannelEnable(unsigned long ulBase, unsigned long ulChannel)
+{
+    if (ulChannel/8 < ADC_NUM_CHANNELS)
+    {
+        g_bChannelEnabled[ulChannel/8] = true;
+    }
+}
+
+void ADCChannelDisable(unsigned long ulBase, unsigned long ulChannel)
+{
+    if (ulChannel/8 < ADC_NUM_CHANNELS)
+    {
+        g_bChannelEnabled[ulChannel/8] = false;
+    }
+}
+
+unsigned char ADCFIFOLvlGet(unsigned long ulBase, unsigned long ulChannel)
+{
+    if (!g_bEnabled || ulChannel/8 >= ADC_NUM_CHANNELS || !g_bChannelEnabled[ulChannel/8])
+    {
+        return 0;
+    }
+
+    return ADC_FIFO_DEPTH;
+}
+
+unsigned long ADCFIFORead(unsigned long ulBase, unsigned long ulChannel)
+{
+    unsigned short usReading;
+
+    if (ADCFIFOLvlGet(ulBase, ulChannel) == 0)
+    {
+        return 0;
+    }
+
+    usReading = Sim_HandGetReading(g_eChannelSensor[ulChannel/8]);
+    if (usReading > ADC_MAX_CODE)
+    {
+        usReading = ADC_MAX_CODE;
+    }
+
+    return (unsigned long)usReading << 2;
+}
@@ -0,0 +1,181 @@
+//*****************************************************************************
+//
+// sim_ads1015.c
+//
+// Register model of the ADS1015 4-channel ADC on the ADC breakout board.
+//
+// Writing the config register with the OS bit set starts a single-shot
+// conversion of the selected input, which completes after one sample
+// period at the configured data rate. Reading the conversion register
+// before then returns the previous result, as on the part. Single-ended
+// inputs are sampled from the hand model; differential inputs read 0.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdint.h>
+
+#include "hw_types.h"
+
+#include "adc_driver_if.h"
+#include "adc_break_out_if.h"
+#include "sim.h"
+
+#define ADS1015_NUM_INPUTS      4
+#define ADS1015_MAX_CODE        2047
+
+// Sensor wired to each single-ended input
+static const enum Fingertip_Sensor_Type g_eInputSensor[ADS1015_NUM_INPUTS] = {
+    [FINGER_THUMB_BREAKOUT] = SENSOR_FINGER_THUMB,
+    [FINGER_MIDDLE_BREAKOUT] = SENSOR_FINGER_MIDDLE,
+    [FINGER_RING_BREAKOUT] = SENSOR_FINGER_RING,
+    [FINGER_PINKY_BREAKOUT] = SENSOR_FINGER_PINKY
+};
+
+// Samples per second for each value of the data rate field
+static const unsigned long g_ulDataRate[8] = {
+    128, 250, 490, 920, 1600, 2400, 3300, 3300
+};
+
+static uint16_t g_usReg[4];
+static unsigned char g_ucPointer = ADS1015_REG_POINTER_CONVERT;
+static unsigned char g_ucByteCount = 0;
+static unsigned char g_ucWriteMSB = 0;
+
+static tBoolean g_bConverting = false;
+static unsigned long long g_ullConversionDone = 0;
+
+static void Start(tBoolean bRead);
+static tBoolean Write(unsigned char ucData);
+static unsigned char Read(void);
+static void Stop(void);
+static void WriteRegister(unsigned char ucReg, uint16_t usValue);
+static void UpdateConversion(void);
+
+static struct Sim_I2CDevice g_Device = {
+    0, Start, Write, Read, Stop
+};
+
+//****************************************************************************
+//
+//! Resets the ADC and attaches it to the I2C bus
+//!
+//! \param ucAddr is its 7-bit I2C address
+//!
+//! \return None
+//
+//****************************************************************************
+void Sim_ADS1015Init(unsigned char ucAddr)
+{
+    g_usReg[ADS1015_REG_POINTER_CONVERT] = 0x0000;
+    g_usReg[ADS1015_REG_POINTER_CONFIG] = 0x8583;
+    g_usReg[ADS1015_REG_POINTER_LOWTHRESH] = 0x8000;
+    g_usReg[ADS1015_REG_POINTER_HITHRESH] = 0x7FFF;
+    g_bConverting = false;
+
+    g_Device.ucAddr = ucAddr;
+    Sim_I2CAttach(&g_Device);
+}
+
+static void Start(tBoolean bRead)
+{
+    g_ucByteCount = 0;
+    UpdateConversion();
+}
+
+static tBoolean Write(unsigned char ucData)
+{
+    if (g_ucByteCount == 0)
+    {
+        g_ucPointer = ucData & ADS1015_REG_POINTER_MASK;
+    }
+    else if (g_ucByteCount == 1)
+    {
+        g_ucWriteMSB = ucData;
+    }
+    else if (g_ucByteCount == 2)
+    {
+        WriteRegister(g_ucPointer, (uint16_t)((g_ucWriteMSB << 8) | ucData));
+    }
+    else
+    {
+        return false;
+    }
+
+    g_ucByteCount++;
+    return true;
+}
+
+static unsigned char Read(void)
+{
+    uint16_t usValue = g_usReg[g_ucPointer];
+
+    if (g_ucPointer == ADS1015_REG_POINTER_CONFIG && !g_bConverting)
+    {
+        usValue |= ADS1015_REG_CONFIG_OS_NOTBUSY;
+    }
+
+    // Registers are read MSB first and repeat after two bytes
+    return (g_ucByteCount++ & 1) ? (usValue & 0xFF) : (usValue >> 8);
+}
+
+static void Stop(void)
+{
+}
+
+static void WriteRegister(unsigned char ucReg, uint16_t usValue)
+{
+    unsigned long ulRate;
+
+    if (ucReg == ADS1015_REG_POINTER_CONVERT)
+    {
+        return;
+    }
+
+    g_usReg[ucReg] = usValue & ~ADS1015_REG_CONFIG_OS_MASK;
+
+    if (ucReg == ADS1015_REG_POINTER_CONFIG &&
+        (usValue & ADS1015_REG_CONFIG_OS_MASK) == ADS1015_REG_CONFIG_OS_SINGLE &&
+        !g_bConverting)
+    {
+        ulRate = g_ulDataRate[(usValue & ADS1015_REG_CONFIG_DR_MASK) >> 5];
+        g_ullConversionDone = Sim_GetNanos() + 1000000000ULL/ulRate;
+        g_bConverting = true;
+    }
+}
+
+static void UpdateConversion(void)
+{
+    unsigned int uiMux;
+    unsigned short usCode = 0;
+
+    if (!g_bConverting || Sim_GetNanos() < g_ullConversionDone)
+    {
+        return;
+    }
+
+    uiMux = (g_usReg[ADS1015_REG_POINTER_CONFIG] & ADS1015_REG_CONFIG_MUX_MASK) >> 12;
+    if (uiMux >= 4)
+    {
+        usCode = Sim_HandGetReading(g_eInputSensor[uiMux - 4]);
+        if (usCode > ADS1015_MAX_CODE)
+        {
+            usCode = ADS1015_MAX_CODE;
+        }
+    }
+
+    // 12-bit result, left-justified
+    g_usReg[ADS1015_REG_POINTER_CONVERT] = (uint16_t)(usCode << 4);
+    g_bConverting = false;
+}
@@ -0,0 +1,65 @@
+//*****************************************************************************
+//
+// sim_board.c
+//
+// Clock gating and pin muxing stand-ins. The simulated peripherals are
+// always clocked and need no pins, so these calls are accepted and ignored.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+#include "pin.h"
+#include "prcm.h"
+
+//****************************************************************************
+//                      Driverlib prcm.h stand-ins
+//****************************************************************************
+void PRCMCC3200MCUInit(void)
+{
+}
+
+void PRCMPeripheralClkEnable(unsigned long ulPeripheral, unsigned long ulClkFlags)
+{
+}
+
+void PRCMPeripheralClkDisable(unsigned long ulPeripheral, unsigned long ulClkFlags)
+{
+}
+
+void PRCMPeripheralReset(unsigned long ulPeripheral)
+{
+}
+
+//****************************************************************************
+//                      Driverlib pin.h stand-ins
+//****************************************************************************
+void PinTypeUART(unsigned long ulPin, unsigned long ulPinMode)
+{
+}
+
+void PinTypeI2C(unsigned long ulPin, unsigned long ulPinMode)
+{
+}
+
+void PinTypeADC(unsigned long ulPin, unsigned long ulPinMode)
+{
+}
+
+void PinTypeTimer(unsigned long ulPin, unsigned long ulPinMode)
+{
+}
+
+void PinTypeGPIO(unsigned long ulPin, unsigned long ulPinMode, tBoolean bOpenDrain)
+{
+}
@@ -0,0 +1,317 @@
+//*****************************************************************************
+//
+// sim_hand.c
+//
+// Model of the hand the firmware drives. Each finger servo follows the
+// pulse width on its PWM channel at a limited speed, and each finger-tip
+// sensor reading is a piecewise-linear curve of where the servo is. With
+// the default curves every finger meets an object halfway through its
+// travel and presses harder the further it closes.
+//
+// A script file can replace the defaults, one setting per line:
+//
+//   # comment
+//   slew <microseconds of pulse width per second>
+//   noise <peak noise added to readings, in counts>
+//   sensor <thumb|index|middle|ring|pinky> <pulse>:<reading> ...
+//
+// Points of a sensor curve are given in increasing pulse width, in
+// microseconds; the reading is held constant outside of them.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hw_types.h"
+
+#include "adc_driver_if.h"
+#include "servo_driver_if.h"
+#include "sim.h"
+
+// HK15298B finger servos, 1.1 ms to 1.9 ms over their 100 degrees of travel
+#define HAND_PULSE_OPEN         1100
+#define HAND_PULSE_CONTACT      1500
+#define HAND_PULSE_CLOSED       1900
+#define HAND_READING_IDLE       1000
+#define HAND_READING_FULL       600
+
+// About 0.16 s per 60 degrees
+#define HAND_DEFAULT_SLEW       5000
+
+struct Sim_Point {
+    unsigned long ulPulse;
+    unsigned short usReading;
+};
+
+struct Sim_Finger {
+    const char *pcName;
+    unsigned char ucChannel;            // PWM channel of the finger servo
+    struct Sim_Point Curve[SIM_HAND_MAX_POINTS];
+    unsigned char ucNumPoints;
+    double dPosition;                   // Servo position as a pulse width
+    unsigned long long ullUpdated;
+};
+
+static struct Sim_Finger g_Finger[NUM_SENSORS] = {
+    [SENSOR_FINGER_THUMB] = { "thumb", FINGER_THUMB_MAPPING },
+    [SENSOR_FINGER_INDEX] = { "index", FINGER_INDEX_MAPPING },
+    [SENSOR_FINGER_MIDDLE] = { "middle", FINGER_MIDDLE_MAPPING },
+    [SENSOR_FINGER_RING] = { "ring", FINGER_RING_MAPPING },
+    [SENSOR_FINGER_PINKY] = { "pinky", FINGER_PINKY_MAPPING }
+};
+
+static unsigned long g_ulSlew = HAND_DEFAULT_SLEW;
+static unsigned short g_usNoise = 0;
+static unsigned long g_ulNoiseState = 1;
+static tBoolean g_bDefaultsSet = false;
+
+static void SetDefaults(void);
+static int ParseSensor(char *pcArgs, int iLine);
+static void UpdatePosition(struct Sim_Finger *pFinger);
+static unsigned short Interpolate(const struct Sim_Finger *pFinger, double dPulse);
+static int NextNoise(void);
+
+//****************************************************************************
+//
+//! Loads a script over the default hand
+//!
+//! \param pcPath is the path of the script file
+//!
+//! \return 0: Success, < 0: Failure.
+//
+//****************************************************************************
+int Sim_HandLoadScript(const char *pcPath)
+{
+    char pcLine[256];
+    char *pcKey;
+    char *pcArgs;
+    FILE *pFile;
+    int iLine = 0;
+    int iStatus = 0;
+
+    SetDefaults();
+
+    pFile = fopen(pcPath, "r");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "[ERROR] Sim_HandLoadScript(): Cannot open %s.\n", pcPath);
+        return -1;
+    }
+
+    while (iStatus == 0 && fgets(pcLine, sizeof(pcLine), pFile) != NULL)
+    {
+        iLine++;
+        pcLine[strcspn(pcLine, "#\r\n")] = '\0';
+
+        pcKey = strtok(pcLine, " \t");
+        if (pcKey == NULL)
+        {
+            continue;
+        }
+        pcArgs = strtok(NULL, "");
+
+        if (strcmp(pcKey, "slew") == 0 && pcArgs != NULL)
+        {
+            g_ulSlew = strtoul(pcArgs, NULL, 10);
+        }
+        else if (strcmp(pcKey, "noise") == 0 && pcArgs != NULL)
+        {
+            g_usNoise = (unsigned short)strtoul(pcArgs, NULL, 10);
+        }
+        else if (strcmp(pcKey, "sensor") == 0 && pcArgs != NULL)
+        {
+            iStatus = ParseSensor(pcArgs, iLine);
+        }
+        else
+        {
+            fprintf(stderr, "[ERROR] Sim_HandLoadScript(): Line %d not understood.\n", iLine);
+            iStatus = -1;
+        }
+    }
+
+    fclose(pFile);
+    return iStatus;
+}
+
+//****************************************************************************
+//
+//! Returns what a finger-tip sensor reads with the finger where it is now
+//!
+//! \param eFingerSensor is the sensor
+//!
+//! \return raw reading, lower is more pressure
+//
+//****************************************************************************
+unsigned short Sim_HandGetReading(enum Fingertip_Sensor_Type eFingerSensor)
+{
+    struct Sim_Finger *pFinger;
+    int iReading;
+
+    if ((unsigned int)eFingerSensor >= NUM_SENSORS)
+    {
+        return 0;
+    }
+
+    SetDefaults();
+
+    pFinger = &g_Finger[eFingerSensor];
+    UpdatePosition(pFinger);
+
+    iReading = Interpolate(pFinger, pFinger->dPosition) + NextNoise();
+    if (iReading < 0)
+    {
+        iReading = 0;
+    }
+
+    return (unsigned short)iReading;
+}
+
+static void SetDefaults(void)
+{
+    int i;
+
+    if (g_bDefaultsSet)
+    {
+        return;
+    }
+
+    for (i = 0; i < NUM_SENSORS; i++)
+    {
+        g_Finger[i].Curve[0].ulPulse = HAND_PULSE_CONTACT;
+        g_Finger[i].Curve[0].usReading = HAND_READING_IDLE;
+        g_Finger[i].Curve[1].ulPulse = HAND_PULSE_CLOSED;
+        g_Finger[i].Curve[1].usReading = HAND_READING_FULL;
+        g_Finger[i].ucNumPoints = 2;
+        g_Finger[i].dPosition = HAND_PULSE_OPEN;
+    }
+
+    g_bDefaultsSet = true;
+}
+
+static int ParseSensor(char *pcArgs, int iLine)
+{
+    struct Sim_Finger *pFinger = NULL;
+    char *pcName;
+    char *pcPoint;
+    unsigned long ulPulse;
+    unsigned long ulReading;
+    unsigned char ucNumPoints = 0;
+    int i;
+
+    pcName = strtok(pcArgs, " \t");
+    for (i = 0; i < NUM_SENSORS && pcName != NULL; i++)
+    {
+        if (strcmp(pcName, g_Finger[i].pcName) == 0)
+        {
+            pFinger = &g_Finger[i];
+        }
+    }
+    if (pFinger == NULL)
+    {
+        fprintf(stderr, "[ERROR] Sim_HandLoadScript(): Line %d names no finger.\n", iLine);
+        return -1;
+    }
+
+    while ((pcPoint = strtok(NULL, " \t")) != NULL)
+    {
+        if (ucNumPoints == SIM_HAND_MAX_POINTS ||
+            sscanf(pcPoint, "%lu:%lu", &ulPulse, &ulReading) != 2 ||
+            (ucNumPoints > 0 && ulPulse <= pFinger->Curve[ucNumPoints - 1].ulPulse))
+        {
+            fprintf(stderr, "[ERROR] Sim_HandLoadScript(): Line %d has a bad point.\n", iLine);
+            return -1;
+        }
+        pFinger->Curve[ucNumPoints].ulPulse = ulPulse;
+        pFinger->Curve[ucNumPoints].usReading = (unsigned short)ulReading;
+        ucNumPoints++;
+    }
+
+    if (ucNumPoints == 0)
+    {
+        fprintf(stderr, "[ERROR] Sim_HandLoadScript(): Line %d has no points.\n", iLine);
+        return -1;
+    }
+
+    pFinger->ucNumPoints = ucNumPoints;
+    return 0;
+}
+
+static void UpdatePosition(struct Sim_Finger *pFinger)
+{
+    unsigned long long ullNow = Sim_GetMicros();
+    unsigned long ulTarget = Sim_PCA9685GetPulse(pFinger->ucChannel);
+    double dStep;
+
+    // Servos hold their position while they get no pulse
+    if (ulTarget != 0)
+    {
+        dStep = (double)g_ulSlew*(ullNow - pFinger->ullUpdated)/1000000.0;
+        if (pFinger->dPosition + dStep < ulTarget)
+        {
+            pFinger->dPosition += dStep;
+        }
+        else if (pFinger->dPosition - dStep > ulTarget)
+        {
+            pFinger->dPosition -= dStep;
+        }
+        else
+        {
+            pFinger->dPosition = ulTarget;
+        }
+    }
+
+    pFinger->ullUpdated = ullNow;
+}
+
+static unsigned short Interpolate(const struct Sim_Finger *pFinger, double dPulse)
+{
+    const struct Sim_Point *pLow;
+    const struct Sim_Point *pHigh;
+    unsigned char i;
+
+    if (dPulse <= pFinger->Curve[0].ulPulse)
+    {
+        return pFinger->Curve[0].usReading;
+    }
+
+    for (i = 1; i < pFinger->ucNumPoints; i++)
+    {
+        pLow = &pFinger->Curve[i - 1];
+        pHigh = &pFinger->Curve[i];
+        if (dPulse <= pHigh->ulPulse)
+        {
+            return (unsigned short)(pLow->usReading +
+                   ((double)pHigh->usReading - pLow->usReading)*
+                   (dPulse - pLow->ulPulse)/(pHigh->ulPulse - pLow->ulPulse) + 0.5);
+        }
+    }
+
+    return pFinger->Curve[pFinger->ucNumPoints - 1].usReading;
+}
+
+static int NextNoise(void)
+{
+    if (g_usNoise == 0)
+    {
+        return 0;
+    }
+
+    // Small LCG, rand() is not safe from the timer signal
+    g_ulNoiseState = g_ulNoiseState*1103515245UL + 12345UL;
+
+    return (int)((g_ulNoiseState >> 16) % (2*g_usNoise + 1)) - g_usNoise;
+}
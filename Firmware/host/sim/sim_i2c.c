@@ -0,0 +1,214 @@
+//*****************************************************************************
+//
+// sim_i2c.c
+//
+// Simulated CC3200 I2C master. Commands are decoded from their START, RUN
+// and STOP bits the way the peripheral does, and carried out immediately
+// against the devices attached to the simulated bus. Every command sets the
+// raw data interrupt status when it completes, and raises the I2C interrupt
+// when that status is enabled.
+//
+// Bus timing is not modelled: a byte takes no time at either bus speed.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdlib.h>
+
+// Driverlib includes
+#include "hw_types.h"
+#include "hw_ints.h"
+#include "hw_memmap.h"
+#include "interrupt.h"
+#include "i2c.h"
+
+#include "sim.h"
+
+// Command bits of the master control register
+#define I2C_MCS_RUN     0x00000001
+#define I2C_MCS_START   0x00000002
+#define I2C_MCS_STOP    0x00000004
+
+static const struct Sim_I2CDevice *g_pDevice[SIM_I2C_MAX_DEVICES];
+static unsigned char g_ucNumDevices = 0;
+
+// Master registers
+static unsigned char g_ucSlaveAddr = 0;
+static tBoolean g_bReceive = false;
+static unsigned char g_ucData = 0;
+static unsigned long g_ulErr = I2C_MASTER_ERR_NONE;
+static unsigned long g_ulRawIntStatus = 0;
+static unsigned long g_ulIntMask = 0;
+
+// Device addressed by the current transfer, NULL when the bus is idle
+static const struct Sim_I2CDevice *g_pActive = NULL;
+
+static const struct Sim_I2CDevice *FindDevice(unsigned char ucAddr);
+
+//****************************************************************************
+//
+//! Attaches a device to the simulated bus
+//!
+//! \param pDevice is the device, which must stay valid
+//!
+//! \return 0: Success, < 0: Failure.
+//
+//****************************************************************************
+int Sim_I2CAttach(const struct Sim_I2CDevice *pDevice)
+{
+    if (g_ucNumDevices == SIM_I2C_MAX_DEVICES)
+    {
+        return -1;
+    }
+
+    g_pDevice[g_ucNumDevices++] = pDevice;
+    return 0;
+}
+
+//****************************************************************************
+//                      Driverlib i2c.h stand-ins
+//****************************************************************************
+void I2CMasterInitExpClk(unsigned long ulBase, unsigned long ulI2CClk, tBoolean bFast)
+{
+}
+
+void I2CMasterEnable(unsigned long ulBase)
+{
+}
+
+void I2CMasterDisable(unsigned long ulBase)
+{
+}
+
+void I2CMasterTimeoutSet(unsigned long ulBase, unsigned long ulValue)
+{
+}
+
+void I2CMasterSlaveAddrSet(unsigned long ulBase, unsigned char ucSlaveAddr, tBoolean bReceive)
+{
+    g_ucSlaveAddr = ucSlaveAddr;
+    g_bReceive = bReceive;
+}
+
+void I2CMasterControl(unsigned long ulBase, unsigned long ulCmd)
+{
+    g_ulErr = I2C_MASTER_ERR_NONE;
+
+    if (ulCmd & I2C_MCS_START)
+    {
+        // A repeated start keeps the bus but addresses a device again
+        g_pActive = FindDevice(g_ucSlaveAddr);
+        if (g_pActive == NULL)
+        {
+            g_ulErr = I2C_MASTER_ERR_ADDR_ACK;
+        }
+        else
+        {
+            g_pActive->pfnStart(g_bReceive);
+        }
+    }
+
+    if ((ulCmd & I2C_MCS_RUN) && g_pActive != NULL)
+    {
+        if (g_bReceive)
+        {
+            g_ucData = g_pActive->pfnRead();
+        }
+        else if (!g_pActive->pfnWrite(g_ucData))
+        {
+            g_ulErr = I2C_MASTER_ERR_DATA_ACK;
+        }
+    }
+
+    if (ulCmd & I2C_MCS_STOP)
+    {
+        if (g_pActive != NULL)
+        {
+            g_pActive->pfnStop();
+        }
+        g_pActive = NULL;
+    }
+
+    g_ulRawIntStatus |= I2C_MASTER_INT_DATA;
+    if (g_ulErr != I2C_MASTER_ERR_NONE)
+    {
+        g_ulRawIntStatus |= I2C_MASTER_INT_NACK;
+    }
+
+    if (g_ulRawIntStatus & g_ulIntMask)
+    {
+        Sim_RaiseInterrupt(INT_I2CA0);
+    }
+}
+
+void I2CMasterDataPut(unsigned long ulBase, unsigned char ucData)
+{
+    g_ucData = ucData;
+}
+
+unsigned long I2CMasterDataGet(unsigned long ulBase)
+{
+    return g_ucData;
+}
+
+unsigned long I2CMasterErr(unsigned long ulBase)
+{
+    return g_ulErr;
+}
+
+tBoolean I2CMasterBusy(unsigned long ulBase)
+{
+    return false;
+}
+
+void I2CIntRegister(unsigned long ulBase, void (*pfnHandler)(void))
+{
+    IntRegister(INT_I2CA0, pfnHandler);
+    IntEnable(INT_I2CA0);
+}
+
+void I2CMasterIntEnableEx(unsigned long ulBase, unsigned long ulIntFlags)
+{
+    g_ulIntMask |= ulIntFlags;
+}
+
+void I2CMasterIntDisableEx(unsigned long ulBase, unsigned long ulIntFlags)
+{
+    g_ulIntMask &= ~ulIntFlags;
+}
+
+unsigned long I2CMasterIntStatusEx(unsigned long ulBase, tBoolean bMasked)
+{
+    return bMasked ? (g_ulRawIntStatus & g_ulIntMask) : g_ulRawIntStatus;
+}
+
+void I2CMasterIntClearEx(unsigned long ulBase, unsigned long ulIntFlags)
+{
+    g_ulRawIntStatus &= ~ulIntFlags;
+}
+
+static const struct Sim_I2CDevice *FindDevice(unsigned char ucAddr)
+{
+    unsigned char i;
+
+    for (i = 0; i < g_ucNumDevices; i++)
+    {
+        if (g_pDevice[i]->ucAddr == ucAddr)
+        {
+            return g_pDevice[i];
+        }
+    }
+
+    return NULL;
+}
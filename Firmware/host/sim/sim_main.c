@@ -0,0 +1,111 @@
+//*****************************************************************************
+//
+// sim_main.c
+//
+// Robot simulator. Runs the firmware's main() against simulated
+// peripherals: a PCA9685 PWM board and an ADS1015 ADC board on the I2C
+// bus, the CC3200 ADC, SysTick and timers on the host clock, and host
+// sockets in place of the SimpleLink network processor.
+//
+// Usage: hirc_sim [-p port] [-b address] [-s script] [-t fd] [-q]
+//   -p port     listen on this port instead of the firmware's PORT_NUM,
+//               which also makes the robot ID of its beacons unique
+//   -b address  send discovery beacons to this IPv4 address instead of
+//               broadcasting them, e.g. 127.0.0.1 on a host whose
+//               loopback does not take broadcasts
+//   -s script   load a hand model script (see sim_hand.c)
+//   -t fd       write PWM pulse width changes to this open descriptor, as
+//               struct Sim_PulseEvent records (used by hirc_bench)
+//   -q          do not print the firmware's terminal output
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+
+#include "hw_types.h"
+
+#include "pwm_break_out_if.h"
+#include "adc_break_out_if.h"
+#include "sim.h"
+
+unsigned short g_usSimPort = 0;
+unsigned long g_ulSimBroadcastAddr = 0;
+tBoolean g_bSimQuiet = false;
+
+// main() of main.c, renamed by the build
+void Firmware_Main(void);
+
+static void Usage(const char *pcName)
+{
+    fprintf(stderr, "Usage: %s [-p port] [-b address] [-s script] [-t fd] [-q]\n", pcName);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *pcScript = NULL;
+    int iTraceFd = -1;
+    struct in_addr sBroadcast;
+    int iOpt;
+
+    while ((iOpt = getopt(argc, argv, "p:b:s:t:qh")) != -1)
+    {
+        switch (iOpt)
+        {
+            case 'p':
+                g_usSimPort = (unsigned short)strtoul(optarg, NULL, 10);
+                break;
+            case 'b':
+                if (inet_pton(AF_INET, optarg, &sBroadcast) != 1)
+                {
+                    fprintf(stderr, "Not an IPv4 address: %s\n", optarg);
+                    return 1;
+                }
+                g_ulSimBroadcastAddr = ntohl(sBroadcast.s_addr);
+                break;
+            case 's':
+                pcScript = optarg;
+                break;
+            case 't':
+                iTraceFd = (int)strtol(optarg, NULL, 10);
+                break;
+            case 'q':
+                g_bSimQuiet = true;
+                break;
+            default:
+                Usage(argv[0]);
+                return (iOpt == 'h') ? 0 : 1;
+        }
+    }
+
+    if (pcScript != NULL && Sim_HandLoadScript(pcScript) != 0)
+    {
+        return 1;
+    }
+
+    Sim_PCA9685Init(PWM_ADDRESS);
+    if (iTraceFd >= 0)
+    {
+        Sim_PCA9685SetTrace(iTraceFd);
+    }
+    Sim_ADS1015Init(ADS1015_ADDRESS);
+    Sim_StartTick();
+
+    Firmware_Main();
+
+    return 0;
+}
@@ -0,0 +1,285 @@
+//*****************************************************************************
+//
+// sim_nvic.c
+//
+// Simulated interrupt controller. Handlers run one at a time and never
+// nest, as with every interrupt at the same priority on the CC3200.
+//
+// The host timer signal plays the role of the hardware raising interrupts
+// asynchronously: it interrupts the firmware wherever it is and runs the
+// pending handlers unless interrupts are masked or a handler is already
+// running. Interrupts raised by the firmware itself, such as the I2C master
+// completing a command, run as soon as interrupts are unmasked.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+// Driverlib includes
+#include "hw_types.h"
+#include "hw_ints.h"
+#include "hw_nvic.h"
+#include "interrupt.h"
+
+#include "sim.h"
+
+// Exceptions below 16 are always enabled
+#define SIM_SYSTEM_EXCEPTIONS   0xFFFFULL
+
+static void (*g_pfnHandler[NUM_INTERRUPTS])(void);
+static volatile unsigned long long g_ullPending = 0;
+static volatile unsigned long long g_ullEnabled = SIM_SYSTEM_EXCEPTIONS;
+static volatile sig_atomic_t g_bMasked = 0;
+static volatile sig_atomic_t g_bInHandler = 0;
+
+static struct timespec g_Start;
+static volatile unsigned long g_ulScratchReg;
+
+static void Dispatch(void);
+static void TryDispatch(void);
+static void TickHandler(int iSignal);
+
+//****************************************************************************
+//
+//! Returns host time since the simulator started
+//!
+//! \param None
+//!
+//! \return time in nanoseconds
+//
+//****************************************************************************
+unsigned long long Sim_GetNanos(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)(now.tv_sec - g_Start.tv_sec)*1000000000ULL +
+           (unsigned long long)now.tv_nsec - (unsigned long long)g_Start.tv_nsec;
+}
+
+//****************************************************************************
+//
+//! Returns host time since the simulator started
+//!
+//! \param None
+//!
+//! \return time in microseconds
+//
+//****************************************************************************
+unsigned long long Sim_GetMicros(void)
+{
+    return Sim_GetNanos()/1000;
+}
+
+//****************************************************************************
+//
+//! Starts the host timer that raises timer interrupts
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void Sim_StartTick(void)
+{
+    struct sigaction action;
+    struct itimerval interval;
+
+    clock_gettime(CLOCK_MONOTONIC, &g_Start);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = TickHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGALRM, &action, NULL);
+
+    interval.it_interval.tv_sec = 0;
+    interval.it_interval.tv_usec = SIM_TICK_US;
+    interval.it_value = interval.it_interval;
+    setitimer(ITIMER_REAL, &interval, NULL);
+}
+
+//****************************************************************************
+//
+//! Marks an interrupt pending and runs it if interrupts are enabled and no
+//! handler is running
+//!
+//! \param ulInterrupt is the interrupt number
+//!
+//! \return None
+//
+//****************************************************************************
+void Sim_RaiseInterrupt(unsigned long ulInterrupt)
+{
+    if (ulInterrupt >= NUM_INTERRUPTS)
+    {
+        return;
+    }
+
+    __atomic_fetch_or(&g_ullPending, 1ULL << ulInterrupt, __ATOMIC_SEQ_CST);
+    TryDispatch();
+}
+
+//****************************************************************************
+//
+//! Returns the simulated register at an address. Only the SysTick pending
+//! bit of the interrupt control register reads back anything meaningful;
+//! other registers accept writes and read back what was last written.
+//!
+//! \param ulAddr is the register address
+//!
+//! \return pointer to the register
+//
+//****************************************************************************
+volatile unsigned long *SimHwReg(unsigned long ulAddr)
+{
+    if (ulAddr == NVIC_INT_CTRL)
+    {
+        g_ulScratchReg = Sim_SysTickPending() ? NVIC_INT_CTRL_PENDSTSET : 0;
+    }
+
+    return &g_ulScratchReg;
+}
+
+//****************************************************************************
+//                      Driverlib interrupt.h stand-ins
+//****************************************************************************
+void IntRegister(unsigned long ulInterrupt, void (*pfnHandler)(void))
+{
+    if (ulInterrupt < NUM_INTERRUPTS)
+    {
+        g_pfnHandler[ulInterrupt] = pfnHandler;
+    }
+}
+
+void IntUnregister(unsigned long ulInterrupt)
+{
+    if (ulInterrupt < NUM_INTERRUPTS)
+    {
+        g_pfnHandler[ulInterrupt] = NULL;
+    }
+}
+
+void IntEnable(unsigned long ulInterrupt)
+{
+    if (ulInterrupt < NUM_INTERRUPTS)
+    {
+        __atomic_fetch_or(&g_ullEnabled, 1ULL << ulInterrupt, __ATOMIC_SEQ_CST);
+        TryDispatch();
+    }
+}
+
+void IntDisable(unsigned long ulInterrupt)
+{
+    if (ulInterrupt < NUM_INTERRUPTS && (1ULL << ulInterrupt) & ~SIM_SYSTEM_EXCEPTIONS)
+    {
+        __atomic_fetch_and(&g_ullEnabled, ~(1ULL << ulInterrupt), __ATOMIC_SEQ_CST);
+    }
+}
+
+void IntVTableBaseSet(unsigned long ulVtableBase)
+{
+}
+
+void IntPrioritySet(unsigned long ulInterrupt, unsigned char ucPriority)
+{
+}
+
+tBoolean IntMasterEnable(void)
+{
+    tBoolean bWasMasked = g_bMasked;
+
+    g_bMasked = 0;
+    TryDispatch();
+
+    return bWasMasked;
+}
+
+tBoolean IntMasterDisable(void)
+{
+    tBoolean bWasMasked = g_bMasked;
+
+    g_bMasked = 1;
+
+    return bWasMasked;
+}
+
+//****************************************************************************
+//
+//! Runs pending handlers, lowest interrupt number first, until none are
+//! left or a handler leaves interrupts masked
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void Dispatch(void)
+{
+    unsigned long long ullReady;
+    unsigned long ulInterrupt;
+
+    do
+    {
+        g_bInHandler = 1;
+        while (!g_bMasked && (ullReady = g_ullPending & g_ullEnabled) != 0)
+        {
+            ulInterrupt = __builtin_ctzll(ullReady);
+            __atomic_fetch_and(&g_ullPending, ~(1ULL << ulInterrupt), __ATOMIC_SEQ_CST);
+            if (g_pfnHandler[ulInterrupt] != NULL)
+            {
+                g_pfnHandler[ulInterrupt]();
+            }
+        }
+        g_bInHandler = 0;
+
+    // An interrupt raised by the host timer after the last check above but
+    // before the flag was cleared would otherwise wait for the next tick
+    } while (!g_bMasked && (g_ullPending & g_ullEnabled) != 0);
+}
+
+static void TryDispatch(void)
+{
+    if (!g_bMasked && !g_bInHandler)
+    {
+        Dispatch();
+    }
+}
+
+//****************************************************************************
+//
+//! Host timer signal, raises expired timers and runs their handlers
+//!
+//! \param iSignal is SIGALRM
+//!
+//! \return None
+//
+//****************************************************************************
+static void TickHandler(int iSignal)
+{
+    int iSavedErrno = errno;
+
+    Sim_PollTimers(Sim_GetNanos());
+    TryDispatch();
+
+    errno = iSavedErrno;
+}
@@ -0,0 +1,474 @@
+//*****************************************************************************
+//
+// sim_osi.c
+//
+// OS abstraction stand-in. Each task is a host thread, but like on the
+// CC3200 only one of them runs firmware code at a time: a task holds the
+// simulated CPU until it blocks in an OSI call or in a host socket call,
+// and the CPU then goes to the highest priority task waiting for it.
+// Scheduling is cooperative between tasks; a task that becomes ready does
+// not preempt a running task of lower priority until that task blocks.
+//
+// Interrupts still come from the host timer signal. Only the thread holding
+// the CPU accepts the signal, so handlers run on top of the running task as
+// they would on the CC3200. While every task is blocked, the thread that
+// called osi_start() holds the CPU as the idle task so timers keep running.
+//
+// The OSI calls must not be made from interrupt handlers.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hw_types.h"
+#include "osi.h"
+
+#include "sim.h"
+
+// Task priorities above this are treated as this
+#define SIM_OSI_MAX_PRIORITY    15
+
+struct Sim_Task {
+    pthread_t thread;
+    P_OSI_TASK_ENTRY pfnEntry;
+    void *pvParameters;
+    unsigned long ulPriority;
+};
+
+struct Sim_MsgQ {
+    pthread_mutex_t lock;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+    unsigned long ulMsgSize;
+    unsigned long ulMaxMsgs;
+    unsigned long ulHead;
+    unsigned long ulCount;
+    unsigned char *pucMsgs;
+};
+
+static pthread_mutex_t g_Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_CpuFree = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t g_IdleWake = PTHREAD_COND_INITIALIZER;
+
+// The thread that runs main() holds the CPU until it calls osi_start()
+static tBoolean g_bCpuBusy = true;
+static tBoolean g_bIdle = false;
+static unsigned long g_ulWaiting[SIM_OSI_MAX_PRIORITY + 1];
+
+// Task run by the calling thread, NULL outside tasks
+static __thread struct Sim_Task *t_pTask = NULL;
+
+static void *TaskThread(void *pvArg);
+static void AcquireCpu(unsigned long ulPriority);
+static void ReleaseCpu(void);
+static tBoolean HigherWaiting(unsigned long ulPriority);
+static void SetTickSignalBlocked(tBoolean bBlocked);
+static void GetExpiry(struct timespec *pExpiry, OsiTime_t Timeout);
+
+//****************************************************************************
+//                      OSI tasks
+//****************************************************************************
+OsiReturnVal_e osi_TaskCreate(P_OSI_TASK_ENTRY pEntry, const signed char * const pcName,
+                              unsigned short usStackDepth, void *pvParameters,
+                              unsigned long uxPriority, OsiTaskHandle *pTaskHandle)
+{
+    struct Sim_Task *pTask;
+    sigset_t oldMask;
+    sigset_t tickMask;
+    int iStatus;
+
+    pTask = malloc(sizeof(*pTask));
+    if (pTask == NULL)
+    {
+        return OSI_MEMORY_ALLOCATION_FAILURE;
+    }
+
+    pTask->pfnEntry = pEntry;
+    pTask->pvParameters = pvParameters;
+    pTask->ulPriority = uxPriority > SIM_OSI_MAX_PRIORITY ? SIM_OSI_MAX_PRIORITY : uxPriority;
+
+    // The thread starts with the timer signal blocked, it has no CPU yet
+    sigemptyset(&tickMask);
+    sigaddset(&tickMask, SIGALRM);
+    pthread_sigmask(SIG_BLOCK, &tickMask, &oldMask);
+    iStatus = pthread_create(&pTask->thread, NULL, TaskThread, pTask);
+    pthread_sigmask(SIG_SETMASK, &oldMask, NULL);
+
+    if (iStatus != 0)
+    {
+        free(pTask);
+        return OSI_OPERATION_FAILED;
+    }
+    pthread_detach(pTask->thread);
+
+    if (pTaskHandle != NULL)
+    {
+        *pTaskHandle = pTask;
+    }
+
+    return OSI_OK;
+}
+
+void osi_Sleep(unsigned int MilliSecs)
+{
+    struct timespec delay;
+
+    delay.tv_sec = MilliSecs/1000;
+    delay.tv_nsec = (long)(MilliSecs%1000)*1000000L;
+
+    Sim_OsiBlock();
+    while (nanosleep(&delay, &delay) != 0 && errno == EINTR)
+    {
+    }
+    Sim_OsiUnblock();
+}
+
+//****************************************************************************
+//
+//! Makes the calling thread the idle task. Tasks run from here on.
+//!
+//! \param None
+//!
+//! \return Never returns
+//
+//****************************************************************************
+void osi_start(void)
+{
+    struct timespec expiry;
+
+    pthread_mutex_lock(&g_Lock);
+    for (;;)
+    {
+        // Hand the CPU to the tasks while any of them wants it
+        SetTickSignalBlocked(true);
+        g_bIdle = false;
+        g_bCpuBusy = false;
+        pthread_cond_broadcast(&g_CpuFree);
+        while (g_bCpuBusy || HigherWaiting(0) || g_ulWaiting[0] != 0)
+        {
+            pthread_cond_wait(&g_CpuFree, &g_Lock);
+        }
+
+        // Idle with interrupts running until a task wants the CPU back. The
+        // wait is bounded as the timer signal can land in the wait and a
+        // wakeup sent meanwhile is then missed.
+        g_bCpuBusy = true;
+        g_bIdle = true;
+        SetTickSignalBlocked(false);
+        while (!HigherWaiting(0) && g_ulWaiting[0] == 0)
+        {
+            GetExpiry(&expiry, 1);
+            pthread_cond_timedwait(&g_IdleWake, &g_Lock, &expiry);
+        }
+    }
+}
+
+//****************************************************************************
+//                      OSI message queues
+//****************************************************************************
+OsiReturnVal_e osi_MsgQCreate(OsiMsgQ_t *pMsgQ, char *pMsgQName,
+                              unsigned long MsgSize, unsigned long MaxMsgs)
+{
+    struct Sim_MsgQ *pQueue;
+
+    if (pMsgQ == NULL || MsgSize == 0 || MaxMsgs == 0)
+    {
+        return OSI_INVALID_PARAMS;
+    }
+
+    pQueue = calloc(1, sizeof(*pQueue));
+    if (pQueue == NULL)
+    {
+        return OSI_MEMORY_ALLOCATION_FAILURE;
+    }
+    pQueue->pucMsgs = malloc(MsgSize*MaxMsgs);
+    if (pQueue->pucMsgs == NULL)
+    {
+        free(pQueue);
+        return OSI_MEMORY_ALLOCATION_FAILURE;
+    }
+
+    pthread_mutex_init(&pQueue->lock, NULL);
+    pthread_cond_init(&pQueue->notEmpty, NULL);
+    pthread_cond_init(&pQueue->notFull, NULL);
+    pQueue->ulMsgSize = MsgSize;
+    pQueue->ulMaxMsgs = MaxMsgs;
+
+    *pMsgQ = pQueue;
+    return OSI_OK;
+}
+
+OsiReturnVal_e osi_MsgQWrite(OsiMsgQ_t *pMsgQ, void *pMsg, OsiTime_t Timeout)
+{
+    struct Sim_MsgQ *pQueue = (struct Sim_MsgQ *)*pMsgQ;
+    struct timespec expiry;
+    tBoolean bBlocked = false;
+    OsiReturnVal_e eRetVal = OSI_OK;
+    unsigned long ulTail;
+
+    GetExpiry(&expiry, Timeout);
+
+    pthread_mutex_lock(&pQueue->lock);
+    while (pQueue->ulCount == pQueue->ulMaxMsgs && eRetVal == OSI_OK)
+    {
+        if (Timeout == OSI_NO_WAIT)
+        {
+            eRetVal = OSI_OPERATION_FAILED;
+            break;
+        }
+        if (!bBlocked)
+        {
+            pthread_mutex_unlock(&pQueue->lock);
+            Sim_OsiBlock();
+            bBlocked = true;
+            pthread_mutex_lock(&pQueue->lock);
+            continue;
+        }
+        if (Timeout == OSI_WAIT_FOREVER)
+        {
+            pthread_cond_wait(&pQueue->notFull, &pQueue->lock);
+        }
+        else if (pthread_cond_timedwait(&pQueue->notFull, &pQueue->lock, &expiry) == ETIMEDOUT)
+        {
+            eRetVal = OSI_TIMEOUT;
+        }
+    }
+
+    if (eRetVal == OSI_OK)
+    {
+        ulTail = (pQueue->ulHead + pQueue->ulCount) % pQueue->ulMaxMsgs;
+        memcpy(&pQueue->pucMsgs[ulTail*pQueue->ulMsgSize], pMsg, pQueue->ulMsgSize);
+        pQueue->ulCount++;
+        pthread_cond_signal(&pQueue->notEmpty);
+    }
+    pthread_mutex_unlock(&pQueue->lock);
+
+    if (bBlocked)
+    {
+        Sim_OsiUnblock();
+    }
+
+    return eRetVal;
+}
+
+OsiReturnVal_e osi_MsgQRead(OsiMsgQ_t *pMsgQ, void *pMsg, OsiTime_t Timeout)
+{
+    struct Sim_MsgQ *pQueue = (struct Sim_MsgQ *)*pMsgQ;
+    struct timespec expiry;
+    tBoolean bBlocked = false;
+    OsiReturnVal_e eRetVal = OSI_OK;
+
+    GetExpiry(&expiry, Timeout);
+
+    pthread_mutex_lock(&pQueue->lock);
+    while (pQueue->ulCount == 0 && eRetVal == OSI_OK)
+    {
+        if (Timeout == OSI_NO_WAIT)
+        {
+            eRetVal = OSI_OPERATION_FAILED;
+            break;
+        }
+        if (!bBlocked)
+        {
+            pthread_mutex_unlock(&pQueue->lock);
+            Sim_OsiBlock();
+            bBlocked = true;
+            pthread_mutex_lock(&pQueue->lock);
+            continue;
+        }
+        if (Timeout == OSI_WAIT_FOREVER)
+        {
+            pthread_cond_wait(&pQueue->notEmpty, &pQueue->lock);
+        }
+        else if (pthread_cond_timedwait(&pQueue->notEmpty, &pQueue->lock, &expiry) == ETIMEDOUT)
+        {
+            eRetVal = OSI_TIMEOUT;
+        }
+    }
+
+    if (eRetVal == OSI_OK)
+    {
+        memcpy(pMsg, &pQueue->pucMsgs[pQueue->ulHead*pQueue->ulMsgSize], pQueue->ulMsgSize);
+        pQueue->ulHead = (pQueue->ulHead + 1) % pQueue->ulMaxMsgs;
+        pQueue->ulCount--;
+        pthread_cond_signal(&pQueue->notFull);
+    }
+    pthread_mutex_unlock(&pQueue->lock);
+
+    if (bBlocked)
+    {
+        Sim_OsiUnblock();
+    }
+
+    return eRetVal;
+}
+
+OsiReturnVal_e VStartSimpleLinkSpawnTask(unsigned long uxPriority)
+{
+    return OSI_OK;
+}
+
+//****************************************************************************
+//
+//! Gives up the CPU before a call that blocks the host thread. Does nothing
+//! outside tasks, so the firmware can block as before osi_start().
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void Sim_OsiBlock(void)
+{
+    if (t_pTask != NULL)
+    {
+        ReleaseCpu();
+    }
+}
+
+//****************************************************************************
+//
+//! Takes the CPU back after a call that blocked the host thread. errno is
+//! left as the call set it.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void Sim_OsiUnblock(void)
+{
+    int iSavedErrno = errno;
+
+    if (t_pTask != NULL)
+    {
+        AcquireCpu(t_pTask->ulPriority);
+    }
+
+    errno = iSavedErrno;
+}
+
+//****************************************************************************
+//
+//! Runs a task once it gets the CPU. A task that returns gives the CPU up
+//! for good.
+//!
+//! \param pvArg is the task
+//!
+//! \return NULL
+//
+//****************************************************************************
+static void *TaskThread(void *pvArg)
+{
+    t_pTask = (struct Sim_Task *)pvArg;
+
+    AcquireCpu(t_pTask->ulPriority);
+    t_pTask->pfnEntry(t_pTask->pvParameters);
+    ReleaseCpu();
+
+    return NULL;
+}
+
+//****************************************************************************
+//
+//! Waits until the CPU is free and no task of higher priority waits for it,
+//! taking it from the idle task if needed
+//!
+//! \param ulPriority is the priority of the calling task
+//!
+//! \return None
+//
+//****************************************************************************
+static void AcquireCpu(unsigned long ulPriority)
+{
+    pthread_mutex_lock(&g_Lock);
+    g_ulWaiting[ulPriority]++;
+    if (g_bIdle)
+    {
+        pthread_cond_signal(&g_IdleWake);
+    }
+    while (g_bCpuBusy || HigherWaiting(ulPriority))
+    {
+        pthread_cond_wait(&g_CpuFree, &g_Lock);
+    }
+    g_ulWaiting[ulPriority]--;
+    g_bCpuBusy = true;
+    pthread_mutex_unlock(&g_Lock);
+
+    SetTickSignalBlocked(false);
+}
+
+//****************************************************************************
+//
+//! Gives the CPU to the next task, or to the idle task
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void ReleaseCpu(void)
+{
+    SetTickSignalBlocked(true);
+
+    pthread_mutex_lock(&g_Lock);
+    g_bCpuBusy = false;
+    pthread_cond_broadcast(&g_CpuFree);
+    pthread_mutex_unlock(&g_Lock);
+}
+
+static tBoolean HigherWaiting(unsigned long ulPriority)
+{
+    unsigned long i;
+
+    for (i = ulPriority + 1; i <= SIM_OSI_MAX_PRIORITY; i++)
+    {
+        if (g_ulWaiting[i] != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void SetTickSignalBlocked(tBoolean bBlocked)
+{
+    sigset_t tickMask;
+
+    sigemptyset(&tickMask);
+    sigaddset(&tickMask, SIGALRM);
+    pthread_sigmask(bBlocked ? SIG_BLOCK : SIG_UNBLOCK, &tickMask, NULL);
+}
+
+static void GetExpiry(struct timespec *pExpiry, OsiTime_t Timeout)
+{
+    clock_gettime(CLOCK_REALTIME, pExpiry);
+    if (Timeout != OSI_WAIT_FOREVER)
+    {
+        pExpiry->tv_sec += Timeout/1000;
+        pExpiry->tv_nsec += (long)(Timeout%1000)*1000000L;
+        if (pExpiry->tv_nsec >= 1000000000L)
+        {
+            pExpiry->tv_sec++;
+            pExpiry->tv_nsec -= 1000000000L;
+        }
+    }
+}
@@ -0,0 +1,264 @@
+//*****************************************************************************
+//
+// sim_pca9685.c
+//
+// Register model of the PCA9685 16-channel PWM controller on the PWM
+// breakout board.
+//
+// The first byte written after a start selects the register; later bytes
+// are written to it, moving on to the next register only when MODE1 has
+// auto-increment enabled. The prescaler can only be changed while the
+// oscillator is asleep, and the outputs are off while it sleeps, as on the
+// part.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <fcntl.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hw_types.h"
+
+#include "pwm_break_out_if.h"
+#include "sim.h"
+
+#define PCA9685_MODE2           0x01
+#define PCA9685_NUM_CHANNELS    16
+#define PCA9685_STEPS           4096
+
+#define MODE1_SLEEP             0x10
+#define MODE1_AI                0x20
+#define LED_FULL                0x10    // Full on/off bit of LEDn_ON_H/OFF_H
+
+// The internal oscillator is nominally 25 MHz but runs fast on the breakout
+// boards; setPWMFreq() asks for 90% of the frequency it wants to correct
+// for it. Running the model at 25 MHz / 0.9 gives the frequency intended.
+#define PCA9685_OSC_HZ          27777778ULL
+
+static unsigned char g_ucReg[256];
+static unsigned char g_ucPointer = 0;
+static tBoolean g_bPointerSet = false;
+
+// Pulse width trace
+static int g_iTraceFd = -1;
+static unsigned long g_ulTraced[PCA9685_NUM_CHANNELS];
+
+static void Start(tBoolean bRead);
+static tBoolean Write(unsigned char ucData);
+static unsigned char Read(void);
+static void Stop(void);
+static void WriteRegister(unsigned char ucReg, unsigned char ucData);
+static void AdvancePointer(void);
+static void TraceChanges(void);
+
+static struct Sim_I2CDevice g_Device = {
+    0, Start, Write, Read, Stop
+};
+
+//****************************************************************************
+//
+//! Resets the PWM controller and attaches it to the I2C bus
+//!
+//! \param ucAddr is its 7-bit I2C address
+//!
+//! \return None
+//
+//****************************************************************************
+void Sim_PCA9685Init(unsigned char ucAddr)
+{
+    unsigned char ucChannel;
+
+    memset(g_ucReg, 0, sizeof(g_ucReg));
+    g_ucReg[PCA9685_MODE1] = MODE1_SLEEP | 0x01;
+    g_ucReg[PCA9685_MODE2] = 0x04;
+    g_ucReg[PCA9685_PRESCALE] = 0x1E;
+    for (ucChannel = 0; ucChannel < PCA9685_NUM_CHANNELS; ucChannel++)
+    {
+        g_ucReg[LED0_OFF_H + 4*ucChannel] = LED_FULL;
+    }
+    g_ucReg[ALLLED_OFF_H] = LED_FULL;
+
+    g_Device.ucAddr = ucAddr;
+    Sim_I2CAttach(&g_Device);
+}
+
+//****************************************************************************
+//
+//! Returns the pulse width on a channel
+//!
+//! \param ucChannel is the channel, 0 to 15
+//!
+//! \return pulse width in microseconds, 0 when the output is off
+//
+//****************************************************************************
+unsigned long Sim_PCA9685GetPulse(unsigned char ucChannel)
+{
+    unsigned char *pucLed = &g_ucReg[LED0_ON_L + 4*ucChannel];
+    unsigned long long ullPeriodNanos;
+    unsigned long ulOn;
+    unsigned long ulOff;
+    unsigned long ulSteps;
+
+    if (ucChannel >= PCA9685_NUM_CHANNELS || (g_ucReg[PCA9685_MODE1] & MODE1_SLEEP))
+    {
+        return 0;
+    }
+
+    ullPeriodNanos = (g_ucReg[PCA9685_PRESCALE] + 1ULL)*PCA9685_STEPS*1000000000ULL/PCA9685_OSC_HZ;
+
+    if (pucLed[3] & LED_FULL)
+    {
+        return 0;
+    }
+    if (pucLed[1] & LED_FULL)
+    {
+        return (unsigned long)(ullPeriodNanos/1000);
+    }
+
+    ulOn = ((pucLed[1] & 0x0F) << 8) | pucLed[0];
+    ulOff = ((pucLed[3] & 0x0F) << 8) | pucLed[2];
+    ulSteps = (ulOff - ulOn) & (PCA9685_STEPS - 1);
+
+    return (unsigned long)(ullPeriodNanos*ulSteps/PCA9685_STEPS/1000);
+}
+
+//****************************************************************************
+//
+//! Starts or stops tracing pulse width changes. The descriptor is made
+//! non-blocking, as the bus runs from interrupt handlers.
+//!
+//! \param iFd is where to write struct Sim_PulseEvent records, -1 for none
+//!
+//! \return None
+//
+//****************************************************************************
+void Sim_PCA9685SetTrace(int iFd)
+{
+    unsigned char ucChannel;
+
+    if (iFd >= 0)
+    {
+        fcntl(iFd, F_SETFL, fcntl(iFd, F_GETFL) | O_NONBLOCK);
+    }
+
+    for (ucChannel = 0; ucChannel < PCA9685_NUM_CHANNELS; ucChannel++)
+    {
+        g_ulTraced[ucChannel] = Sim_PCA9685GetPulse(ucChannel);
+    }
+    g_iTraceFd = iFd;
+}
+
+static void Start(tBoolean bRead)
+{
+    // A write selects the register with its first byte, a read continues
+    // from the register selected last
+    g_bPointerSet = bRead;
+}
+
+static tBoolean Write(unsigned char ucData)
+{
+    if (!g_bPointerSet)
+    {
+        g_ucPointer = ucData;
+        g_bPointerSet = true;
+        return true;
+    }
+
+    WriteRegister(g_ucPointer, ucData);
+    AdvancePointer();
+    return true;
+}
+
+static unsigned char Read(void)
+{
+    unsigned char ucData = g_ucReg[g_ucPointer];
+
+    AdvancePointer();
+    return ucData;
+}
+
+static void Stop(void)
+{
+    // The firmware writes a channel's four registers in one transaction
+    if (g_iTraceFd >= 0)
+    {
+        TraceChanges();
+    }
+}
+
+static void WriteRegister(unsigned char ucReg, unsigned char ucData)
+{
+    unsigned char ucChannel;
+
+    if (ucReg == PCA9685_PRESCALE)
+    {
+        if (g_ucReg[PCA9685_MODE1] & MODE1_SLEEP)
+        {
+            g_ucReg[PCA9685_PRESCALE] = ucData < 3 ? 3 : ucData;
+        }
+        return;
+    }
+
+    g_ucReg[ucReg] = ucData;
+
+    // The ALL_LED registers write the same value to every channel
+    if (ucReg >= ALLLED_ON_L && ucReg <= ALLLED_OFF_H)
+    {
+        for (ucChannel = 0; ucChannel < PCA9685_NUM_CHANNELS; ucChannel++)
+        {
+            g_ucReg[LED0_ON_L + 4*ucChannel + (ucReg - ALLLED_ON_L)] = ucData;
+        }
+    }
+}
+
+static void AdvancePointer(void)
+{
+    if (g_ucReg[PCA9685_MODE1] & MODE1_AI)
+    {
+        g_ucPointer++;
+    }
+}
+
+static void TraceChanges(void)
+{
+    struct Sim_PulseEvent event;
+    struct timespec now;
+    unsigned char ucChannel;
+    unsigned long ulPulse;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    memset(&event, 0, sizeof(event));
+    event.ullMonoNanos = (unsigned long long)now.tv_sec*1000000000ULL + now.tv_nsec;
+
+    for (ucChannel = 0; ucChannel < PCA9685_NUM_CHANNELS; ucChannel++)
+    {
+        ulPulse = Sim_PCA9685GetPulse(ucChannel);
+        if (ulPulse == g_ulTraced[ucChannel])
+        {
+            continue;
+        }
+
+        g_ulTraced[ucChannel] = ulPulse;
+        event.ulPulse = ulPulse;
+        event.ucChannel = ucChannel;
+        if (write(g_iTraceFd, &event, sizeof(event)) < 0)
+        {
+            // Full or closed, the reader loses this change
+        }
+    }
+}
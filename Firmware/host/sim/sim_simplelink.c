@@ -0,0 +1,410 @@
+//*****************************************************************************
+//
+// sim_simplelink.c
+//
+// SimpleLink stand-in. The BSD socket calls are passed to host sockets,
+// with errors returned as negative errno values the way SimpleLink returns
+// them (SL_EAGAIN is -EAGAIN, and so on). The simulated network processor
+// is always connected, so the WLAN start-up in tcp_socket.c is replaced by
+// a WlanStart() and WlanConnect() that only report the host's address.
+//
+// The MAC address is made up from the port the simulator listens on, so
+// simulators started on different ports tell themselves apart in their
+// discovery beacons. Broadcasts can be redirected with -b.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+
+#include "simplelink.h"
+#include "common.h"
+#include "uart_if.h"
+
+#include "tcp_socket.h"
+#include "sim.h"
+
+static _i16 SocketError(void);
+static void ToHostAddr(const SlSockAddr_t *pSlAddr, struct sockaddr_in *pAddr);
+static void FromHostAddr(const struct sockaddr_in *pAddr, SlSockAddr_t *pSlAddr);
+static void ToHostFdSet(SlFdSet_t *pSlSet, fd_set *pSet, int iFds);
+static void FromHostFdSet(fd_set *pSet, SlFdSet_t *pSlSet, int iFds);
+
+//****************************************************************************
+//                      WLAN (replaces tcp_socket.c)
+//****************************************************************************
+long WlanStart()
+{
+    UART_PRINT("Device started as STATION \n\r");
+    return SUCCESS;
+}
+
+long WlanConnect(char *cSSID, char *cSecurityType, char*cSecurityKey)
+{
+    WlanStart();
+
+    UART_PRINT("Connected to AP: %s (simulated, using host network)\n\r",
+               cSSID != NULL ? cSSID : SSID_NAME);
+    return SUCCESS;
+}
+
+//****************************************************************************
+//                      Device
+//****************************************************************************
+_i16 sl_Start(const void *pIfHdl, _i8 *pDevName, const void *pInitCallBack)
+{
+    return 0;
+}
+
+_i16 sl_Stop(_u16 timeout)
+{
+    return 0;
+}
+
+//****************************************************************************
+//                      Network configuration
+//****************************************************************************
+_i32 sl_NetCfgGet(_u8 ConfigId, _u8 *pConfigOpt, _u8 *pConfigLen, _u8 *pValues)
+{
+    unsigned short usPort = g_usSimPort != 0 ? g_usSimPort : PORT_NUM;
+
+    if (ConfigId != SL_MAC_ADDRESS_GET || pConfigLen == NULL ||
+        *pConfigLen < SL_MAC_ADDR_LEN || pValues == NULL)
+    {
+        return SL_EINVAL;
+    }
+
+    // A locally administered address ending in the port
+    memset(pValues, 0, SL_MAC_ADDR_LEN);
+    pValues[0] = 0x02;
+    pValues[SL_MAC_ADDR_LEN-2] = (_u8)(usPort >> 8);
+    pValues[SL_MAC_ADDR_LEN-1] = (_u8)usPort;
+    *pConfigLen = SL_MAC_ADDR_LEN;
+
+    return SL_SOC_OK;
+}
+
+//****************************************************************************
+//                      BSD sockets
+//****************************************************************************
+_i16 sl_Socket(_i16 Domain, _i16 Type, _i16 Protocol)
+{
+    int iSocket;
+    int iReuse = 1;
+    int iBroadcast = 1;
+
+    if (Domain != SL_AF_INET)
+    {
+        return SL_EINVAL;
+    }
+
+    iSocket = socket(AF_INET, Type == SL_SOCK_DGRAM ? SOCK_DGRAM : SOCK_STREAM,
+                     Protocol);
+    if (iSocket < 0)
+    {
+        return SocketError();
+    }
+
+    // Lets the simulator restart straight away on the same port
+    setsockopt(iSocket, SOL_SOCKET, SO_REUSEADDR, &iReuse, sizeof(iReuse));
+
+    // The CC3200 sends to the broadcast address without being asked to
+    if (Type == SL_SOCK_DGRAM)
+    {
+        setsockopt(iSocket, SOL_SOCKET, SO_BROADCAST, &iBroadcast, sizeof(iBroadcast));
+    }
+
+    return (_i16)iSocket;
+}
+
+_i16 sl_Close(_i16 sd)
+{
+    return close(sd) == 0 ? SL_SOC_OK : SocketError();
+}
+
+_i16 sl_Bind(_i16 sd, const SlSockAddr_t *addr, _i16 addrlen)
+{
+    struct sockaddr_in sAddr;
+
+    ToHostAddr(addr, &sAddr);
+    if (g_usSimPort != 0)
+    {
+        // The firmware reports the port it really listens on
+        sAddr.sin_port = htons(g_usSimPort);
+        g_uiPortNum = g_usSimPort;
+    }
+
+    return bind(sd, (struct sockaddr *)&sAddr, sizeof(sAddr)) == 0 ?
+           SL_SOC_OK : SocketError();
+}
+
+_i16 sl_Listen(_i16 sd, _i16 backlog)
+{
+    return listen(sd, backlog > 0 ? backlog : 1) == 0 ? SL_SOC_OK : SocketError();
+}
+
+_i16 sl_Accept(_i16 sd, SlSockAddr_t *addr, SlSocklen_t *addrlen)
+{
+    struct sockaddr_in sAddr;
+    socklen_t iAddrLen = sizeof(sAddr);
+    int iSocket;
+
+    Sim_OsiBlock();
+    iSocket = accept(sd, (struct sockaddr *)&sAddr, &iAddrLen);
+    Sim_OsiUnblock();
+    if (iSocket < 0)
+    {
+        return SocketError();
+    }
+
+    if (addr != NULL)
+    {
+        FromHostAddr(&sAddr, addr);
+    }
+    if (addrlen != NULL)
+    {
+        *addrlen = sizeof(SlSockAddrIn_t);
+    }
+
+    return (_i16)iSocket;
+}
+
+_i16 sl_Recv(_i16 sd, void *buf, _i16 Len, _i16 flags)
+{
+    ssize_t iLen;
+
+    Sim_OsiBlock();
+    iLen = recv(sd, buf, Len, 0);
+    Sim_OsiUnblock();
+
+    return iLen >= 0 ? (_i16)iLen : SocketError();
+}
+
+_i16 sl_Send(_i16 sd, const void *buf, _i16 Len, _i16 flags)
+{
+    ssize_t iLen;
+
+    // A peer that went away is an error, not a signal
+    Sim_OsiBlock();
+    iLen = send(sd, buf, Len, MSG_NOSIGNAL);
+    Sim_OsiUnblock();
+
+    return iLen >= 0 ? (_i16)iLen : SocketError();
+}
+
+_i16 sl_SendTo(_i16 sd, const void *buf, _i16 Len, _i16 flags,
+                const SlSockAddr_t *to, SlSocklen_t tolen)
+{
+    struct sockaddr_in sAddr;
+    ssize_t iLen;
+
+    if (to == NULL)
+    {
+        return SL_EINVAL;
+    }
+
+    ToHostAddr(to, &sAddr);
+    if (sAddr.sin_addr.s_addr == htonl(INADDR_BROADCAST) && g_ulSimBroadcastAddr != 0)
+    {
+        sAddr.sin_addr.s_addr = htonl((uint32_t)g_ulSimBroadcastAddr);
+    }
+
+    Sim_OsiBlock();
+    iLen = sendto(sd, buf, Len, MSG_NOSIGNAL, (struct sockaddr *)&sAddr, sizeof(sAddr));
+    Sim_OsiUnblock();
+
+    return iLen >= 0 ? (_i16)iLen : SocketError();
+}
+
+_i16 sl_SetSockOpt(_i16 sd, _i16 level, _i16 optname, const void *optval, SlSocklen_t optlen)
+{
+    const SlSockNonblocking_t *pNonblocking;
+    const SlTimeval_t *pTimeval;
+    const SlSockWinsize_t *pWinsize;
+    struct timeval timeout;
+    int iFlags;
+
+    if (level != SL_SOL_SOCKET || optval == NULL)
+    {
+        return SL_EINVAL;
+    }
+
+    switch (optname)
+    {
+        case SL_SO_NONBLOCKING:
+            pNonblocking = (const SlSockNonblocking_t *)optval;
+            iFlags = fcntl(sd, F_GETFL, 0);
+            if (iFlags < 0)
+            {
+                return SocketError();
+            }
+            iFlags = pNonblocking->NonblockingEnabled ? (iFlags | O_NONBLOCK) :
+                                                        (iFlags & ~O_NONBLOCK);
+            return fcntl(sd, F_SETFL, iFlags) == 0 ? SL_SOC_OK : SocketError();
+
+        case SL_SO_RCVTIMEO:
+            pTimeval = (const SlTimeval_t *)optval;
+            timeout.tv_sec = pTimeval->tv_sec;
+            timeout.tv_usec = pTimeval->tv_usec;
+            return setsockopt(sd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0 ?
+                   SL_SOC_OK : SocketError();
+
+        case SL_SO_RCVBUF:
+            pWinsize = (const SlSockWinsize_t *)optval;
+            iFlags = pWinsize->Winsize;
+            return setsockopt(sd, SOL_SOCKET, SO_RCVBUF, &iFlags, sizeof(iFlags)) == 0 ?
+                   SL_SOC_OK : SocketError();
+
+        default:
+            return SL_EINVAL;
+    }
+}
+
+_i16 sl_Select(_i16 nfds, SlFdSet_t *readsds, SlFdSet_t *writesds, SlFdSet_t *exceptsds,
+               struct SlTimeval_t *timeout)
+{
+    fd_set readSet;
+    fd_set writeSet;
+    fd_set exceptSet;
+    struct timeval tv;
+    int iReady;
+
+    if (nfds < 0 || nfds > SL_FD_SETSIZE)
+    {
+        return SL_EINVAL;
+    }
+
+    ToHostFdSet(readsds, &readSet, nfds);
+    ToHostFdSet(writesds, &writeSet, nfds);
+    ToHostFdSet(exceptsds, &exceptSet, nfds);
+    if (timeout != NULL)
+    {
+        tv.tv_sec = timeout->tv_sec;
+        tv.tv_usec = timeout->tv_usec;
+    }
+
+    Sim_OsiBlock();
+    iReady = select(nfds, &readSet, &writeSet, &exceptSet, timeout != NULL ? &tv : NULL);
+    Sim_OsiUnblock();
+    if (iReady < 0)
+    {
+        return SocketError();
+    }
+
+    FromHostFdSet(&readSet, readsds, nfds);
+    FromHostFdSet(&writeSet, writesds, nfds);
+    FromHostFdSet(&exceptSet, exceptsds, nfds);
+
+    return (_i16)iReady;
+}
+
+void SL_FD_SET(_i16 fd, SlFdSet_t *fdset)
+{
+    fdset->fd_array[fd/32] |= 1UL << (fd%32);
+}
+
+void SL_FD_CLR(_i16 fd, SlFdSet_t *fdset)
+{
+    fdset->fd_array[fd/32] &= ~(1UL << (fd%32));
+}
+
+_i16 SL_FD_ISSET(_i16 fd, SlFdSet_t *fdset)
+{
+    return (fdset->fd_array[fd/32] & (1UL << (fd%32))) != 0;
+}
+
+void SL_FD_ZERO(SlFdSet_t *fdset)
+{
+    memset(fdset, 0, sizeof(*fdset));
+}
+
+_u32 sl_Htonl(_u32 val)
+{
+    return htonl((uint32_t)val);
+}
+
+_u16 sl_Htons(_u16 val)
+{
+    return htons(val);
+}
+
+static _i16 SocketError(void)
+{
+    if (errno == EWOULDBLOCK)
+    {
+        return SL_EAGAIN;
+    }
+
+    return (_i16)-errno;
+}
+
+static void ToHostAddr(const SlSockAddr_t *pSlAddr, struct sockaddr_in *pAddr)
+{
+    const SlSockAddrIn_t *pSlAddrIn = (const SlSockAddrIn_t *)pSlAddr;
+
+    memset(pAddr, 0, sizeof(*pAddr));
+    pAddr->sin_family = AF_INET;
+    pAddr->sin_port = pSlAddrIn->sin_port;
+    pAddr->sin_addr.s_addr = (in_addr_t)pSlAddrIn->sin_addr.s_addr;
+}
+
+static void FromHostAddr(const struct sockaddr_in *pAddr, SlSockAddr_t *pSlAddr)
+{
+    SlSockAddrIn_t *pSlAddrIn = (SlSockAddrIn_t *)pSlAddr;
+
+    memset(pSlAddrIn, 0, sizeof(*pSlAddrIn));
+    pSlAddrIn->sin_family = SL_AF_INET;
+    pSlAddrIn->sin_port = pAddr->sin_port;
+    pSlAddrIn->sin_addr.s_addr = pAddr->sin_addr.s_addr;
+}
+
+static void ToHostFdSet(SlFdSet_t *pSlSet, fd_set *pSet, int iFds)
+{
+    int i;
+
+    FD_ZERO(pSet);
+    for (i = 0; pSlSet != NULL && i < iFds; i++)
+    {
+        if (SL_FD_ISSET(i, pSlSet))
+        {
+            FD_SET(i, pSet);
+        }
+    }
+}
+
+static void FromHostFdSet(fd_set *pSet, SlFdSet_t *pSlSet, int iFds)
+{
+    int i;
+
+    if (pSlSet == NULL)
+    {
+        return;
+    }
+
+    SL_FD_ZERO(pSlSet);
+    for (i = 0; i < iFds; i++)
+    {
+        if (FD_ISSET(i, pSet))
+        {
+            SL_FD_SET(i, pSlSet);
+        }
+    }
+}
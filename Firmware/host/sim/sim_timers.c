@@ -0,0 +1,353 @@
+//*****************************************************************************
+//
+// sim_timers.c
+//
+// Simulated SysTick, general purpose timers and busy-wait delays, all
+// following the host monotonic clock.
+//
+// SysTick counts down at 80 MHz from the time it is enabled, so
+// SysTickValueGet() is accurate to the host clock. Its interrupt is raised
+// once per reload; if the host timer signal arrives late, the missed
+// reloads are delivered back-to-back so that a millisecond count kept by
+// the handler stays in step with the counter.
+//
+// Timers started through Timer_IF raise their interrupt every period from
+// the host timer signal, so periods are whole milliseconds. Missed periods
+// are dropped, as the hardware would.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdlib.h>
+#include <time.h>
+
+// Driverlib includes
+#include "hw_types.h"
+#include "hw_ints.h"
+#include "hw_memmap.h"
+#include "interrupt.h"
+#include "systick.h"
+#include "timer.h"
+#include "utils.h"
+#include "timer_if.h"
+
+#include "sim.h"
+
+#define SIM_SYS_CLK_MHZ     80
+#define SIM_NUM_TIMERS      8       // TIMERA0 to TIMERA3, halves A and B
+
+struct Sim_Timer {
+    unsigned long ulInterrupt;
+    unsigned long long ullPeriod;   // Nanoseconds, 0 when stopped
+    unsigned long long ullNextDue;
+};
+
+static struct Sim_Timer g_Timer[SIM_NUM_TIMERS] = {
+    { INT_TIMERA0A, 0, 0 }, { INT_TIMERA0B, 0, 0 },
+    { INT_TIMERA1A, 0, 0 }, { INT_TIMERA1B, 0, 0 },
+    { INT_TIMERA2A, 0, 0 }, { INT_TIMERA2B, 0, 0 },
+    { INT_TIMERA3A, 0, 0 }, { INT_TIMERA3B, 0, 0 },
+};
+
+static unsigned long g_ulSysTickPeriod = 0x01000000;
+static tBoolean g_bSysTickEnabled = false;
+static tBoolean g_bSysTickIntEnabled = false;
+static unsigned long long g_ullSysTickStart = 0;
+static volatile unsigned long long g_ullSysTickServed = 0;
+static void (*g_pfnSysTick)(void) = NULL;
+
+static struct Sim_Timer *GetTimer(unsigned long ulBase, unsigned long ulTimer);
+static unsigned long long SysTickReloadsDue(void);
+static void SysTickIntHandler(void);
+
+//****************************************************************************
+//
+//! Raises the interrupts of expired timers. Called from the host timer
+//! signal.
+//!
+//! \param ullNanos is the current host time
+//!
+//! \return None
+//
+//****************************************************************************
+void Sim_PollTimers(unsigned long long ullNanos)
+{
+    int i;
+
+    if (g_bSysTickIntEnabled && Sim_SysTickPending())
+    {
+        Sim_RaiseInterrupt(FAULT_SYSTICK);
+    }
+
+    for (i = 0; i < SIM_NUM_TIMERS; i++)
+    {
+        if (g_Timer[i].ullPeriod == 0 || ullNanos < g_Timer[i].ullNextDue)
+        {
+            continue;
+        }
+
+        while (g_Timer[i].ullNextDue <= ullNanos)
+        {
+            g_Timer[i].ullNextDue += g_Timer[i].ullPeriod;
+        }
+        Sim_RaiseInterrupt(g_Timer[i].ulInterrupt);
+    }
+}
+
+//****************************************************************************
+//
+//! Returns true when SysTick has reloaded more often than its interrupt has
+//! run
+//!
+//! \param None
+//!
+//! \return reload pending
+//
+//****************************************************************************
+tBoolean Sim_SysTickPending(void)
+{
+    return g_bSysTickEnabled && SysTickReloadsDue() > g_ullSysTickServed;
+}
+
+//****************************************************************************
+//                      Driverlib systick.h stand-ins
+//****************************************************************************
+void SysTickEnable(void)
+{
+    g_ullSysTickStart = Sim_GetNanos();
+    g_ullSysTickServed = 0;
+    g_bSysTickEnabled = true;
+}
+
+void SysTickDisable(void)
+{
+    g_bSysTickEnabled = false;
+}
+
+void SysTickIntRegister(void (*pfnHandler)(void))
+{
+    g_pfnSysTick = pfnHandler;
+    IntRegister(FAULT_SYSTICK, SysTickIntHandler);
+}
+
+void SysTickIntUnregister(void)
+{
+    g_pfnSysTick = NULL;
+}
+
+void SysTickIntEnable(void)
+{
+    g_bSysTickIntEnabled = true;
+}
+
+void SysTickIntDisable(void)
+{
+    g_bSysTickIntEnabled = false;
+}
+
+void SysTickPeriodSet(unsigned long ulPeriod)
+{
+    g_ulSysTickPeriod = ulPeriod;
+}
+
+unsigned long SysTickPeriodGet(void)
+{
+    return g_ulSysTickPeriod;
+}
+
+unsigned long SysTickValueGet(void)
+{
+    unsigned long long ullTicks;
+
+    if (!g_bSysTickEnabled)
+    {
+        return 0;
+    }
+
+    ullTicks = (Sim_GetNanos() - g_ullSysTickStart)*SIM_SYS_CLK_MHZ/1000;
+
+    return g_ulSysTickPeriod - 1 - (unsigned long)(ullTicks % g_ulSysTickPeriod);
+}
+
+//****************************************************************************
+//                      Common interface timer_if.h stand-ins
+//****************************************************************************
+void Timer_IF_Init(unsigned long ePeripheralc, unsigned long ulBase,
+                   unsigned long ulConfig, unsigned long ulTimer,
+                   unsigned long ulValue)
+{
+    struct Sim_Timer *pTimer = GetTimer(ulBase, ulTimer);
+
+    if (pTimer != NULL)
+    {
+        pTimer->ullPeriod = 0;
+    }
+}
+
+void Timer_IF_IntSetup(unsigned long ulBase, unsigned long ulTimer,
+                       void (*TimerBaseIntHandler)(void))
+{
+    struct Sim_Timer *pTimer = GetTimer(ulBase, ulTimer);
+
+    if (pTimer != NULL)
+    {
+        IntRegister(pTimer->ulInterrupt, TimerBaseIntHandler);
+        IntEnable(pTimer->ulInterrupt);
+    }
+}
+
+void Timer_IF_InterruptClear(unsigned long ulBase)
+{
+}
+
+void Timer_IF_Start(unsigned long ulBase, unsigned long ulTimer,
+                    unsigned long ulValue)
+{
+    struct Sim_Timer *pTimer = GetTimer(ulBase, ulTimer);
+
+    if (pTimer != NULL && ulValue > 0)
+    {
+        pTimer->ullNextDue = Sim_GetNanos() + ulValue*1000000ULL;
+        pTimer->ullPeriod = ulValue*1000000ULL;
+    }
+}
+
+void Timer_IF_Stop(unsigned long ulBase, unsigned long ulTimer)
+{
+    struct Sim_Timer *pTimer = GetTimer(ulBase, ulTimer);
+
+    if (pTimer != NULL)
+    {
+        pTimer->ullPeriod = 0;
+    }
+}
+
+void Timer_IF_DeInit(unsigned long ulBase, unsigned long ulTimer)
+{
+    struct Sim_Timer *pTimer = GetTimer(ulBase, ulTimer);
+
+    if (pTimer != NULL)
+    {
+        pTimer->ullPeriod = 0;
+        IntDisable(pTimer->ulInterrupt);
+        IntUnregister(pTimer->ulInterrupt);
+    }
+}
+
+void Timer_IF_ReLoad(unsigned long ulBase, unsigned long ulTimer,
+                     unsigned long ulValue)
+{
+    Timer_IF_Start(ulBase, ulTimer, ulValue);
+}
+
+unsigned int Timer_IF_GetCount(unsigned long ulBase, unsigned long ulTimer)
+{
+    return 0;
+}
+
+//****************************************************************************
+//                      Driverlib timer.h stand-ins
+//
+// Only used by the GPT PWM servo path in servo_driver.c, which drives pins
+// the simulator does not model.
+//****************************************************************************
+void TimerConfigure(unsigned long ulBase, unsigned long ulConfig)
+{
+}
+
+void TimerControlLevel(unsigned long ulBase, unsigned long ulTimer, tBoolean bInvert)
+{
+}
+
+void TimerPrescaleSet(unsigned long ulBase, unsigned long ulTimer, unsigned long ulValue)
+{
+}
+
+void TimerPrescaleMatchSet(unsigned long ulBase, unsigned long ulTimer, unsigned long ulValue)
+{
+}
+
+void TimerLoadSet(unsigned long ulBase, unsigned long ulTimer, unsigned long ulValue)
+{
+}
+
+void TimerMatchSet(unsigned long ulBase, unsigned long ulTimer, unsigned long ulValue)
+{
+}
+
+void TimerEnable(unsigned long ulBase, unsigned long ulTimer)
+{
+}
+
+void TimerDisable(unsigned long ulBase, unsigned long ulTimer)
+{
+}
+
+//****************************************************************************
+//
+//! Waits for the time UtilsDelay() takes on the CC3200, 3 cycles per loop
+//! at 80 MHz
+//!
+//! \param ulCount is the number of loops
+//!
+//! \return None
+//
+//****************************************************************************
+void UtilsDelay(unsigned long ulCount)
+{
+    unsigned long long ullNanos = (unsigned long long)ulCount*3*1000/SIM_SYS_CLK_MHZ;
+    struct timespec delay;
+
+    delay.tv_sec = ullNanos/1000000000ULL;
+    delay.tv_nsec = ullNanos%1000000000ULL;
+    while (nanosleep(&delay, &delay) != 0)
+    {
+    }
+}
+
+static struct Sim_Timer *GetTimer(unsigned long ulBase, unsigned long ulTimer)
+{
+    int iIndex;
+
+    if (ulBase < TIMERA0_BASE || ulBase > TIMERA3_BASE ||
+        (ulBase - TIMERA0_BASE) % 0x1000 != 0)
+    {
+        return NULL;
+    }
+
+    iIndex = (ulBase - TIMERA0_BASE)/0x1000*2 + (ulTimer == TIMER_B ? 1 : 0);
+
+    return &g_Timer[iIndex];
+}
+
+static unsigned long long SysTickReloadsDue(void)
+{
+    return (Sim_GetNanos() - g_ullSysTickStart)*SIM_SYS_CLK_MHZ/1000/g_ulSysTickPeriod;
+}
+
+static void SysTickIntHandler(void)
+{
+    g_ullSysTickServed++;
+
+    if (g_pfnSysTick != NULL)
+    {
+        g_pfnSysTick();
+    }
+
+    // Deliver reloads missed while the host timer signal was late
+    if (Sim_SysTickPending())
+    {
+        Sim_RaiseInterrupt(FAULT_SYSTICK);
+    }
+}
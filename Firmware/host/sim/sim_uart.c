@@ -0,0 +1,88 @@
+//*****************************************************************************
+//
+// sim_uart.c
+//
+// Terminal stand-in. The firmware's UART output goes to stdout, with the
+// "\n\r" line endings it uses for serial terminals turned into plain
+// newlines, and GetCmd() reads a line from stdin.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hw_types.h"
+#include "uart_if.h"
+
+#include "sim.h"
+
+#define TERM_MAX_LINE   512
+
+void InitTerm(void)
+{
+    setvbuf(stdout, NULL, _IOLBF, 0);
+}
+
+void ClearTerm(void)
+{
+}
+
+void Message(const char *format)
+{
+    Report("%s", format);
+}
+
+int GetCmd(char *pcBuffer, unsigned int uiBufLen)
+{
+    if (uiBufLen == 0 || fgets(pcBuffer, uiBufLen, stdin) == NULL)
+    {
+        return -1;
+    }
+
+    pcBuffer[strcspn(pcBuffer, "\r\n")] = '\0';
+    return (int)strlen(pcBuffer);
+}
+
+int Report(const char *format, ...)
+{
+    char pcLine[TERM_MAX_LINE];
+    char *pcIn;
+    char *pcOut;
+    va_list args;
+    int iLen;
+
+    if (g_bSimQuiet)
+    {
+        return 0;
+    }
+
+    va_start(args, format);
+    iLen = vsnprintf(pcLine, sizeof(pcLine), format, args);
+    va_end(args);
+
+    // Drop the carriage returns
+    for (pcIn = pcOut = pcLine; *pcIn != '\0'; pcIn++)
+    {
+        if (*pcIn != '\r')
+        {
+            *pcOut++ = *pcIn;
+        }
+    }
+    *pcOut = '\0';
+
+    fputs(pcLine, stdout);
+    return iLen;
+}
@@ -0,0 +1,211 @@
+//*****************************************************************************
+//
+// test_frame_reader.c
+//
+// Feeds the HIRCP frame reader streams split and merged at every length,
+// with garbage and false starts mixed in, and checks that the packets come
+// out whole, in order, with the out-of-step bytes counted.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdio.h>
+#include <string.h>
+
+#include "hw_types.h"
+
+#include "hircp.h"
+#include "frame_reader_if.h"
+
+#define CHECK(cond, ...)                                    \
+    do {                                                    \
+        g_ulChecks++;                                       \
+        if (!(cond))                                        \
+        {                                                   \
+            g_ulFailures++;                                 \
+            fprintf(stderr, "%s:%d: ", __FILE__, __LINE__); \
+            fprintf(stderr, __VA_ARGS__);                   \
+            fprintf(stderr, "\n");                          \
+        }                                                   \
+    } while (0)
+
+#define NUM_PACKETS                 40
+#define MAX_STREAM_LEN              (NUM_PACKETS*(HIRCP_MAX_PACKET_LEN + 8))
+
+// hircp.c stand-in
+const unsigned char HIRCP_CONSTANT[] = "HIRC";
+
+static unsigned long g_ulChecks;
+static unsigned long g_ulFailures;
+
+//****************************************************************************
+// Writes packet i of a stream: a DATA packet whose payload counts from i
+//****************************************************************************
+static void MakePacket(int i, unsigned char *pucPacket)
+{
+    int j;
+
+    memcpy(pucPacket, HIRCP_CONSTANT, HIRCP_CONSTANT_LEN);
+    pucPacket[HIRCP_CONSTANT_LEN] = HIRCP_DATA;
+    for (j = 0; j < HIRCP_MAX_PAYLOAD_LEN; j++)
+    {
+        pucPacket[HIRCP_CONSTANT_LEN + HIRCP_OPCODE_LEN + j] = (unsigned char)(i + j);
+    }
+}
+
+//****************************************************************************
+// Feeds the stream in reads of iChunk bytes, taking packets out after each
+// read. Returns the number of packets out, which are checked to be the
+// stream's packets in order.
+//****************************************************************************
+static int FeedStream(struct FrameReader *pReader, const unsigned char *pucStream,
+                      int iLen, int iChunk)
+{
+    unsigned char ucPacket[HIRCP_MAX_PACKET_LEN];
+    unsigned char ucExpected[HIRCP_MAX_PACKET_LEN];
+    unsigned char *pucSpace;
+    int iFed = 0;
+    int iSpace;
+    int iRead;
+    int iPackets = 0;
+
+    while (iFed < iLen)
+    {
+        iSpace = FrameReaderSpace(pReader, &pucSpace);
+        CHECK(iSpace > 0, "reader full with %d of %d bytes fed", iFed, iLen);
+        if (iSpace <= 0)
+        {
+            break;
+        }
+        iRead = iChunk < iSpace ? iChunk : iSpace;
+        iRead = iRead < iLen - iFed ? iRead : iLen - iFed;
+        memcpy(pucSpace, pucStream + iFed, iRead);
+        FrameReaderCommit(pReader, iRead);
+        iFed += iRead;
+
+        while (FrameReaderNext(pReader, ucPacket))
+        {
+            MakePacket(iPackets, ucExpected);
+            CHECK(memcmp(ucPacket, ucExpected, HIRCP_MAX_PACKET_LEN) == 0,
+                  "packet %d differs, reads of %d bytes", iPackets, iChunk);
+            iPackets++;
+        }
+    }
+
+    return iPackets;
+}
+
+static void TestSplitAndMerged(void)
+{
+    unsigned char ucStream[MAX_STREAM_LEN];
+    struct FrameReader reader;
+    int iLen = 0;
+    int iChunk;
+    int iPackets;
+    int i;
+
+    for (i = 0; i < NUM_PACKETS; i++)
+    {
+        MakePacket(i, ucStream + iLen);
+        iLen += HIRCP_MAX_PACKET_LEN;
+    }
+
+    for (iChunk = 1; iChunk <= FRAME_READER_SIZE; iChunk++)
+    {
+        FrameReaderReset(&reader);
+        iPackets = FeedStream(&reader, ucStream, iLen, iChunk);
+        CHECK(iPackets == NUM_PACKETS, "%d packets out of %d, reads of %d bytes",
+              iPackets, NUM_PACKETS, iChunk);
+        CHECK(reader.ulDiscarded == 0, "%lu bytes discarded, reads of %d bytes",
+              reader.ulDiscarded, iChunk);
+    }
+}
+
+static void TestResync(void)
+{
+    // Garbage holding a partial constant, a constant with no valid opcode
+    // and a false start cut short by the next packet
+    static const unsigned char ucGarbage[][8] = {
+        { 'x', 'H', 'I', 'y' },
+        { 'H', 'I', 'R', 'C', 0 },
+        { 'H', 'I', 'R', 'C', HIRCP_NUM_TYPES },
+        { 'H', 'I', 'R' },
+    };
+    static const int iGarbageLen[] = { 4, 5, 5, 3 };
+    int iGarbageCount = sizeof(iGarbageLen)/sizeof(iGarbageLen[0]);
+    unsigned char ucStream[MAX_STREAM_LEN];
+    struct FrameReader reader;
+    unsigned long ulExpected = 0;
+    int iLen = 0;
+    int iChunk;
+    int iPackets;
+    int i;
+
+    for (i = 0; i < NUM_PACKETS; i++)
+    {
+        if (i % 3 == 0)
+        {
+            memcpy(ucStream + iLen, ucGarbage[i % iGarbageCount],
+                   iGarbageLen[i % iGarbageCount]);
+            iLen += iGarbageLen[i % iGarbageCount];
+            ulExpected += iGarbageLen[i % iGarbageCount];
+        }
+        MakePacket(i, ucStream + iLen);
+        iLen += HIRCP_MAX_PACKET_LEN;
+    }
+
+    for (iChunk = 1; iChunk <= FRAME_READER_SIZE; iChunk++)
+    {
+        FrameReaderReset(&reader);
+        iPackets = FeedStream(&reader, ucStream, iLen, iChunk);
+        CHECK(iPackets == NUM_PACKETS, "%d packets out of %d, reads of %d bytes",
+              iPackets, NUM_PACKETS, iChunk);
+        CHECK(reader.ulDiscarded == ulExpected,
+              "%lu bytes discarded, expected %lu, reads of %d bytes",
+              reader.ulDiscarded, ulExpected, iChunk);
+    }
+}
+
+static void TestPartialPacketWaits(void)
+{
+    unsigned char ucPacket[HIRCP_MAX_PACKET_LEN];
+    unsigned char ucOut[HIRCP_MAX_PACKET_LEN];
+    unsigned char *pucSpace;
+    struct FrameReader reader;
+    int i;
+
+    FrameReaderReset(&reader);
+    MakePacket(7, ucPacket);
+
+    for (i = 0; i < HIRCP_MAX_PACKET_LEN; i++)
+    {
+        CHECK(!FrameReaderNext(&reader, ucOut), "packet out after %d bytes", i);
+        FrameReaderSpace(&reader, &pucSpace);
+        *pucSpace = ucPacket[i];
+        FrameReaderCommit(&reader, 1);
+    }
+    CHECK(FrameReaderNext(&reader, ucOut), "no packet out after all bytes");
+    CHECK(memcmp(ucOut, ucPacket, HIRCP_MAX_PACKET_LEN) == 0, "packet differs");
+    CHECK(reader.ulDiscarded == 0, "%lu bytes discarded", reader.ulDiscarded);
+}
+
+int main(void)
+{
+    TestSplitAndMerged();
+    TestResync();
+    TestPartialPacketWaits();
+
+    printf("%lu checks, %lu failures\n", g_ulChecks, g_ulFailures);
+    return g_ulFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+//*****************************************************************************
+//
+// test_servo_tables.c
+//
+// Checks the servo lookup tables built by InitServoTables_PWM_Breakout()
+// against the calibration math they replace: CheckDegreeAgainstLimit(),
+// Convert_Degrees_To_DutyCycle_PWM_Breakout() and the duty cycle to tick
+// conversion of setPWM_DutyCycle(), for every joint and input position.
+// I2C writes are captured instead of going to a bus, so the registers
+// MoveServo_PWM_Breakout() writes are checked as well.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdio.h>
+#include <string.h>
+
+#include "hw_types.h"
+
+#include "servo_driver_if.h"
+#include "pwm_break_out_if.h"
+#include "i2c_queue_if.h"
+#include "sim.h"
+
+#define CHECK(cond, ...)                                    \
+    do {                                                    \
+        g_ulChecks++;                                       \
+        if (!(cond))                                        \
+        {                                                   \
+            g_ulFailures++;                                 \
+            fprintf(stderr, "%s:%d: ", __FILE__, __LINE__); \
+            fprintf(stderr, __VA_ARGS__);                   \
+            fprintf(stderr, "\n");                          \
+        }                                                   \
+    } while (0)
+
+unsigned short g_usSimPort = 0;
+tBoolean g_bSimQuiet = true;
+
+static unsigned long g_ulChecks;
+static unsigned long g_ulFailures;
+
+// Last I2C write queued by the driver
+static unsigned char g_ucWriteAddr;
+static unsigned char g_ucWriteData[8];
+static unsigned char g_ucWriteLen;
+static unsigned long g_ulWrites;
+
+//****************************************************************************
+// I2C queue stand-ins: record writes, reads return 0
+//****************************************************************************
+int I2C_Queue_Submit(unsigned char ucDevAddr,
+                     const unsigned char *pucWrData, unsigned char ucWrLen,
+                     unsigned char ucRdLen,
+                     I2C_Callback pfnDone, void *pvArg)
+{
+    (void)ucRdLen;
+    (void)pfnDone;
+    (void)pvArg;
+
+    g_ucWriteAddr = ucDevAddr;
+    g_ucWriteLen = ucWrLen < sizeof(g_ucWriteData) ? ucWrLen : sizeof(g_ucWriteData);
+    memcpy(g_ucWriteData, pucWrData, g_ucWriteLen);
+    g_ulWrites++;
+    return 0;
+}
+
+int I2C_Queue_Transfer(unsigned char ucDevAddr,
+                       const unsigned char *pucWrData, unsigned char ucWrLen,
+                       unsigned char *pucRdData, unsigned char ucRdLen)
+{
+    I2C_Queue_Submit(ucDevAddr, pucWrData, ucWrLen, ucRdLen, NULL, NULL);
+    if (pucRdData != NULL)
+    {
+        memset(pucRdData, 0, ucRdLen);
+    }
+    return 0;
+}
+
+void Timebase_Delay(unsigned long ulMicros)
+{
+    (void)ulMicros;
+}
+
+//****************************************************************************
+// Ticks setPWM_DutyCycle() wrote before the tables: the duty cycle is scaled
+// to 12-bit steps, with 0 and 4095 standing for fully off and fully on
+//****************************************************************************
+static void ReferenceSteps(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint,
+                           unsigned short *pusOn, unsigned short *pusOff)
+{
+    float fDutyCycle;
+    uint16_t usStep;
+
+    CheckDegreeAgainstLimit(&ucDegrees, eServoJoint);
+    fDutyCycle = Convert_Degrees_To_DutyCycle_PWM_Breakout(ucDegrees, eServoJoint);
+    usStep = fDutyCycle*4095/100;
+
+    if (usStep == 4095)
+    {
+        *pusOn = 4096;
+        *pusOff = 0;
+    }
+    else if (usStep == 0)
+    {
+        *pusOn = 0;
+        *pusOff = 4096;
+    }
+    else
+    {
+        *pusOn = 0;
+        *pusOff = usStep;
+    }
+}
+
+static void TestTablesMatchMath(void)
+{
+    unsigned short usOn;
+    unsigned short usOff;
+    unsigned short usRefOn;
+    unsigned short usRefOff;
+    int i;
+    int j;
+
+    for (i = 0; i < NUM_SERVOS; i++)
+    {
+        for (j = 0; j < SERVO_STEP_TABLE_LEN; j++)
+        {
+            ReferenceSteps((unsigned char)j, (enum Servo_Joint_Type)i, &usRefOn, &usRefOff);
+            GetServoSteps_PWM_Breakout((unsigned char)j, (enum Servo_Joint_Type)i, &usOn, &usOff);
+            CHECK(usOn == usRefOn && usOff == usRefOff,
+                  "joint %d, %d degrees: table %u/%u, math %u/%u",
+                  i, j, usOn, usOff, usRefOn, usRefOff);
+        }
+    }
+}
+
+static void TestMoveServoWritesTable(void)
+{
+    static const unsigned char ucChannel[NUM_SERVOS] = {
+        FINGER_THUMB_MAPPING,
+        FINGER_INDEX_MAPPING,
+        FINGER_MIDDLE_MAPPING,
+        FINGER_RING_MAPPING,
+        FINGER_PINKY_MAPPING,
+        FINGER_WRIST_MAPPING
+    };
+    unsigned char ucExpected[5];
+    unsigned char ucDegrees;
+    float fDutyCycle;
+    int i;
+    int j;
+
+    for (i = 0; i < NUM_SERVOS; i++)
+    {
+        for (j = 0; j < SERVO_STEP_TABLE_LEN; j++)
+        {
+            // What the driver wrote before the tables
+            ucDegrees = (unsigned char)j;
+            CheckDegreeAgainstLimit(&ucDegrees, (enum Servo_Joint_Type)i);
+            fDutyCycle = Convert_Degrees_To_DutyCycle_PWM_Breakout(ucDegrees, (enum Servo_Joint_Type)i);
+            setPWM_DutyCycle(ucChannel[i], fDutyCycle);
+            CHECK(g_ucWriteLen == 5, "setPWM_DutyCycle wrote %u bytes", g_ucWriteLen);
+            memcpy(ucExpected, g_ucWriteData, sizeof(ucExpected));
+
+            g_ucWriteLen = 0;
+            MoveServo_PWM_Breakout((unsigned char)j, (enum Servo_Joint_Type)i);
+            CHECK(g_ucWriteAddr == PWM_ADDRESS && g_ucWriteLen == 5 &&
+                  memcmp(g_ucWriteData, ucExpected, sizeof(ucExpected)) == 0,
+                  "joint %d, %d degrees: MoveServo_PWM_Breakout wrote different registers", i, j);
+            CHECK(GetServoPosition_PWM_Breakout((enum Servo_Joint_Type)i) == j,
+                  "joint %d: position %u, expected %d",
+                  i, GetServoPosition_PWM_Breakout((enum Servo_Joint_Type)i), j);
+        }
+    }
+}
+
+static void TestInvalidJoint(void)
+{
+    unsigned short usOn = 1;
+    unsigned short usOff = 1;
+    unsigned long ulWrites = g_ulWrites;
+
+    MoveServo_PWM_Breakout(90, (enum Servo_Joint_Type)NUM_SERVOS);
+    CHECK(g_ulWrites == ulWrites, "invalid joint was written");
+
+    GetServoSteps_PWM_Breakout(90, (enum Servo_Joint_Type)NUM_SERVOS, &usOn, &usOff);
+    CHECK(usOn == 0 && usOff == 0, "invalid joint has ticks %u/%u", usOn, usOff);
+}
+
+int main(void)
+{
+    InitServos_PWM_Breakout();
+
+    TestTablesMatchMath();
+    TestMoveServoWritesTable();
+    TestInvalidJoint();
+
+    printf("%lu checks, %lu failures\n", g_ulChecks, g_ulFailures);
+    return g_ulFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// i2c_if.h
+//
+// I2C interface APIs. Operates in a polled mode.
+//
+// Copyright (C) 2014 Texas Instruments Incorporated - http://www.ti.com/
+//
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//    Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+//    Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the
+//    distribution.
+//
+//    Neither the name of Texas Instruments Incorporated nor the names of
+//    its contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+//  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+//  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+//  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+//  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+//  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+//  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+//  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+//  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//*****************************************************************************
+
+#ifndef __I2C_IF_H__
+#define __I2C_IF_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// I2C transaction time-out value.
+// Set to value 0x7D. (@100KHz it is 20ms, @400Khz it is 5 ms)
+//
+//*****************************************************************************
+#define I2C_TIMEOUT_VAL         0x7D
+
+//*****************************************************************************
+//
+// Values that can be passed to I2COpen as the ulMode parameter.
+//
+//*****************************************************************************
+#define I2C_MASTER_MODE_STD     0
+#define I2C_MASTER_MODE_FST     1
+#define I2C_MRIS_CLKTOUT        0x2
+
+//*****************************************************************************
+//
+// API Function prototypes
+//
+//*****************************************************************************
+extern int I2C_IF_Open(unsigned long ulMode);
+extern int I2C_IF_Close();
+extern int I2C_IF_Write(unsigned char ucDevAddr,
+             unsigned char *pucData,
+             unsigned char ucLen,
+             unsigned char ucStop);
+extern int I2C_IF_Read(unsigned char ucDevAddr,
+            unsigned char *pucData,
+            unsigned char ucLen);
+extern int I2C_IF_ReadFrom(unsigned char ucDevAddr,
+            unsigned char *pucWrDataBuf,
+            unsigned char ucWrLen,
+            unsigned char *pucRdDataBuf,
+            unsigned char ucRdLen);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __I2C_IF_H__
@@ -0,0 +1,501 @@
+//*****************************************************************************
+//
+// i2c_queue_if.c
+//
+// Interrupt-driven I2C transaction queue for the CC3200 I2C master.
+//
+// Each transaction is a write phase, an optional repeated start, and a read
+// phase, issued with the same command sequence as the polled i2c_if driver.
+// Instead of spinning on the raw interrupt status after every byte, the next
+// byte is issued from the I2C interrupt. When a transaction finishes, its
+// callback runs and the next queued transaction starts immediately.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <string.h>
+
+// Driverlib includes
+#include "hw_types.h"
+#include "hw_memmap.h"
+#include "hw_ints.h"
+#include "hw_i2c.h"
+#include "i2c.h"
+#include "rom.h"
+#include "rom_map.h"
+#include "interrupt.h"
+
+// Common interface includes
+#include "common.h"
+#include "i2c_if.h"
+
+#include "profiler_if.h"
+#include "i2c_queue_if.h"
+
+#define I2C_BASE                I2CA0_BASE
+#define SYS_CLK                 80000000
+
+enum I2C_Phase {
+    I2C_PHASE_WRITE=0,
+    I2C_PHASE_READ
+};
+
+struct I2C_Transaction {
+    unsigned char ucDevAddr;
+    unsigned char ucWrLen;
+    unsigned char ucRdLen;
+    unsigned char pucWrData[I2C_QUEUE_MAX_DATA];
+    unsigned char pucRdData[I2C_QUEUE_MAX_DATA];
+    I2C_Callback pfnDone;
+    void *pvArg;
+};
+
+struct I2C_DeviceMode {
+    unsigned char ucDevAddr;
+    unsigned long ulMode;
+};
+
+// Circular queue, the transaction at g_ucHead is the one on the bus
+static struct I2C_Transaction g_Queue[I2C_QUEUE_DEPTH];
+static volatile unsigned char g_ucHead = 0;
+static volatile unsigned char g_ucCount = 0;
+
+// Progress of the transaction on the bus
+static enum I2C_Phase g_ePhase;
+static unsigned char g_ucIndex;
+static unsigned long g_ulLastCmd;
+static unsigned long g_ulBegin;
+
+static struct I2C_DeviceMode g_DeviceMode[I2C_QUEUE_MAX_DEVICES];
+static unsigned char g_ucNumDevices = 0;
+static unsigned long g_ulBusMode = I2C_MASTER_MODE_STD;
+
+static volatile unsigned long g_ulDropCount = 0;
+
+static void I2CQueueIntHandler(void);
+static void StartTransaction(void);
+static void StartReadPhase(struct I2C_Transaction *pTransaction);
+static void FinishTransaction(int iStatus);
+static void IssueCommand(unsigned long ulCmd);
+static unsigned long GetDeviceMode(unsigned char ucDevAddr);
+static tBoolean EnterCritical(void);
+static void ExitCritical(tBoolean bWasDisabled);
+
+//****************************************************************************
+//
+//! Switches the I2C peripheral to interrupt-driven operation. The polled
+//! I2C_IF read/write calls must not be used afterwards.
+//!
+//! \param None
+//!
+//! \return 0: Success, < 0: Failure.
+//
+//****************************************************************************
+int I2C_Queue_Open(void)
+{
+    g_ucHead = 0;
+    g_ucCount = 0;
+
+    MAP_I2CMasterIntClearEx(I2C_BASE, MAP_I2CMasterIntStatusEx(I2C_BASE, false));
+    MAP_I2CMasterTimeoutSet(I2C_BASE, I2C_TIMEOUT_VAL);
+    MAP_I2CIntRegister(I2C_BASE, I2CQueueIntHandler);
+    MAP_I2CMasterIntEnableEx(I2C_BASE, I2C_MASTER_INT_DATA | I2C_MASTER_INT_TIMEOUT);
+
+    return SUCCESS;
+}
+
+//****************************************************************************
+//
+//! Sets the bus speed used for transactions with a device. The bus is
+//! reclocked between transactions when consecutive devices differ.
+//!
+//! \param ucDevAddr is the 7-bit I2C slave address
+//! \param ulMode is I2C_MASTER_MODE_STD (100 kHz) or I2C_MASTER_MODE_FST
+//!        (400 kHz)
+//!
+//! \return 0: Success, < 0: Failure.
+//
+//****************************************************************************
+int I2C_Queue_SetDeviceMode(unsigned char ucDevAddr, unsigned long ulMode)
+{
+    unsigned char i;
+
+    for (i = 0; i < g_ucNumDevices; i++)
+    {
+        if (g_DeviceMode[i].ucDevAddr == ucDevAddr)
+        {
+            g_DeviceMode[i].ulMode = ulMode;
+            return SUCCESS;
+        }
+    }
+
+    if (g_ucNumDevices == I2C_QUEUE_MAX_DEVICES)
+    {
+        return FAILURE;
+    }
+
+    g_DeviceMode[g_ucNumDevices].ucDevAddr = ucDevAddr;
+    g_DeviceMode[g_ucNumDevices].ulMode = ulMode;
+    g_ucNumDevices++;
+
+    return SUCCESS;
+}
+
+//****************************************************************************
+//
+//! Queues a transaction. The write data is copied, so the caller's buffer
+//! may be reused as soon as this returns. Safe to call from interrupt
+//! context.
+//!
+//! \param ucDevAddr is the 7-bit I2C slave address
+//! \param pucWrData is the data to write (register address first)
+//! \param ucWrLen is the number of bytes to write, up to I2C_QUEUE_MAX_DATA
+//! \param ucRdLen is the number of bytes to read, up to I2C_QUEUE_MAX_DATA
+//! \param pfnDone is called from the I2C interrupt on completion, or NULL
+//! \param pvArg is passed to pfnDone
+//!
+//! \return 0: Success, < 0: Failure (queue full or invalid lengths).
+//
+//****************************************************************************
+int I2C_Queue_Submit(unsigned char ucDevAddr,
+                     const unsigned char *pucWrData, unsigned char ucWrLen,
+                     unsigned char ucRdLen,
+                     I2C_Callback pfnDone, void *pvArg)
+{
+    struct I2C_Transaction *pTransaction;
+    tBoolean bWasDisabled;
+
+    if ((ucWrLen == 0 && ucRdLen == 0) ||
+        ucWrLen > I2C_QUEUE_MAX_DATA || ucRdLen > I2C_QUEUE_MAX_DATA ||
+        (ucWrLen > 0 && pucWrData == NULL))
+    {
+        return FAILURE;
+    }
+
+    bWasDisabled = EnterCritical();
+
+    if (g_ucCount == I2C_QUEUE_DEPTH)
+    {
+        g_ulDropCount++;
+        ExitCritical(bWasDisabled);
+        return FAILURE;
+    }
+
+    pTransaction = &g_Queue[(g_ucHead + g_ucCount) % I2C_QUEUE_DEPTH];
+    pTransaction->ucDevAddr = ucDevAddr;
+    pTransaction->ucWrLen = ucWrLen;
+    pTransaction->ucRdLen = ucRdLen;
+    if (ucWrLen > 0)
+    {
+        memcpy(pTransaction->pucWrData, pucWrData, ucWrLen);
+    }
+    pTransaction->pfnDone = pfnDone;
+    pTransaction->pvArg = pvArg;
+
+    // Bus is idle, start this transaction right away
+    if (g_ucCount++ == 0)
+    {
+        StartTransaction();
+    }
+
+    ExitCritical(bWasDisabled);
+
+    return SUCCESS;
+}
+
+struct I2C_TransferResult {
+    volatile tBoolean bDone;
+    int iStatus;
+    unsigned char *pucRdData;
+};
+
+static void TransferDone(int iStatus, unsigned char *pucRdData,
+                         unsigned char ucRdLen, void *pvArg)
+{
+    struct I2C_TransferResult *pResult = (struct I2C_TransferResult *)pvArg;
+
+    if (iStatus == SUCCESS && ucRdLen > 0)
+    {
+        memcpy(pResult->pucRdData, pucRdData, ucRdLen);
+    }
+    pResult->iStatus = iStatus;
+    pResult->bDone = true;
+}
+
+//****************************************************************************
+//
+//! Queues a transaction and waits for it to complete. Intended for device
+//! set-up; must not be called from interrupt context.
+//!
+//! \param ucDevAddr is the 7-bit I2C slave address
+//! \param pucWrData is the data to write (register address first)
+//! \param ucWrLen is the number of bytes to write
+//! \param pucRdData receives the data read
+//! \param ucRdLen is the number of bytes to read
+//!
+//! \return 0: Success, < 0: Failure.
+//
+//****************************************************************************
+int I2C_Queue_Transfer(unsigned char ucDevAddr,
+                       const unsigned char *pucWrData, unsigned char ucWrLen,
+                       unsigned char *pucRdData, unsigned char ucRdLen)
+{
+    struct I2C_TransferResult result;
+
+    result.bDone = false;
+    result.iStatus = FAILURE;
+    result.pucRdData = pucRdData;
+
+    if (I2C_Queue_Submit(ucDevAddr, pucWrData, ucWrLen, ucRdLen,
+                         TransferDone, &result) != SUCCESS)
+    {
+        return FAILURE;
+    }
+
+    while (!result.bDone)
+    {
+    }
+
+    return result.iStatus;
+}
+
+//****************************************************************************
+//
+//! Returns the number of transactions dropped because the queue was full
+//!
+//! \param None
+//!
+//! \return drop count since boot
+//
+//****************************************************************************
+unsigned long I2C_Queue_GetDropCount(void)
+{
+    return g_ulDropCount;
+}
+
+//****************************************************************************
+//
+//! I2C interrupt. Checks the byte that just completed and issues the next
+//! command of the transaction, or completes it.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void I2CQueueIntHandler(void)
+{
+    struct I2C_Transaction *pTransaction = &g_Queue[g_ucHead];
+    unsigned long ulStatus;
+
+    ulStatus = MAP_I2CMasterIntStatusEx(I2C_BASE, true);
+    MAP_I2CMasterIntClearEx(I2C_BASE, ulStatus);
+
+    if (g_ucCount == 0)
+    {
+        return;
+    }
+
+    //
+    // Abort the transaction on a time-out, NACK or lost arbitration
+    //
+    if ((ulStatus & I2C_MASTER_INT_TIMEOUT) ||
+        MAP_I2CMasterErr(I2C_BASE) != I2C_MASTER_ERR_NONE)
+    {
+        if (g_ePhase == I2C_PHASE_WRITE)
+        {
+            MAP_I2CMasterControl(I2C_BASE, I2C_MASTER_CMD_BURST_SEND_ERROR_STOP);
+        }
+        else
+        {
+            MAP_I2CMasterControl(I2C_BASE, I2C_MASTER_CMD_BURST_RECEIVE_ERROR_STOP);
+        }
+        FinishTransaction(FAILURE);
+        return;
+    }
+
+    if (g_ePhase == I2C_PHASE_WRITE)
+    {
+        if (g_ulLastCmd == I2C_MASTER_CMD_BURST_SEND_STOP)
+        {
+            FinishTransaction(SUCCESS);
+        }
+        else if (g_ucIndex < pTransaction->ucWrLen)
+        {
+            MAP_I2CMasterDataPut(I2C_BASE, pTransaction->pucWrData[g_ucIndex++]);
+            IssueCommand(I2C_MASTER_CMD_BURST_SEND_CONT);
+        }
+        else if (pTransaction->ucRdLen > 0)
+        {
+            StartReadPhase(pTransaction);
+        }
+        else
+        {
+            IssueCommand(I2C_MASTER_CMD_BURST_SEND_STOP);
+        }
+    }
+    else
+    {
+        pTransaction->pucRdData[g_ucIndex++] = MAP_I2CMasterDataGet(I2C_BASE);
+
+        if (g_ucIndex == pTransaction->ucRdLen)
+        {
+            FinishTransaction(SUCCESS);
+        }
+        else if (g_ucIndex + 1 < pTransaction->ucRdLen)
+        {
+            IssueCommand(I2C_MASTER_CMD_BURST_RECEIVE_CONT);
+        }
+        else
+        {
+            IssueCommand(I2C_MASTER_CMD_BURST_RECEIVE_FINISH);
+        }
+    }
+}
+
+//****************************************************************************
+//
+//! Puts the transaction at the head of the queue on the bus. Called with
+//! interrupts disabled or from the I2C interrupt.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void StartTransaction(void)
+{
+    struct I2C_Transaction *pTransaction = &g_Queue[g_ucHead];
+    unsigned long ulMode;
+
+    g_ulBegin = ProfileBegin();
+
+    ulMode = GetDeviceMode(pTransaction->ucDevAddr);
+    if (ulMode != g_ulBusMode)
+    {
+        MAP_I2CMasterInitExpClk(I2C_BASE, SYS_CLK, ulMode == I2C_MASTER_MODE_FST);
+        g_ulBusMode = ulMode;
+    }
+
+    g_ucIndex = 0;
+
+    if (pTransaction->ucWrLen == 0)
+    {
+        StartReadPhase(pTransaction);
+        return;
+    }
+
+    g_ePhase = I2C_PHASE_WRITE;
+    MAP_I2CMasterSlaveAddrSet(I2C_BASE, pTransaction->ucDevAddr, false);
+    MAP_I2CMasterDataPut(I2C_BASE, pTransaction->pucWrData[g_ucIndex++]);
+    IssueCommand(I2C_MASTER_CMD_BURST_SEND_START);
+}
+
+//****************************************************************************
+//
+//! Starts the read phase of a transaction, with a repeated start if the
+//! write phase left the bus claimed
+//!
+//! \param pTransaction is the transaction on the bus
+//!
+//! \return None
+//
+//****************************************************************************
+static void StartReadPhase(struct I2C_Transaction *pTransaction)
+{
+    g_ePhase = I2C_PHASE_READ;
+    g_ucIndex = 0;
+    MAP_I2CMasterSlaveAddrSet(I2C_BASE, pTransaction->ucDevAddr, true);
+    if (pTransaction->ucRdLen == 1)
+    {
+        IssueCommand(I2C_MASTER_CMD_SINGLE_RECEIVE);
+    }
+    else
+    {
+        IssueCommand(I2C_MASTER_CMD_BURST_RECEIVE_START);
+    }
+}
+
+//****************************************************************************
+//
+//! Completes the transaction at the head of the queue and starts the next
+//!
+//! \param iStatus is SUCCESS or FAILURE
+//!
+//! \return None
+//
+//****************************************************************************
+static void FinishTransaction(int iStatus)
+{
+    struct I2C_Transaction *pTransaction = &g_Queue[g_ucHead];
+
+    ProfileEnd(PROFILE_I2C, g_ulBegin);
+
+    if (pTransaction->pfnDone != NULL)
+    {
+        pTransaction->pfnDone(iStatus, pTransaction->pucRdData,
+                              (iStatus == SUCCESS) ? pTransaction->ucRdLen : 0,
+                              pTransaction->pvArg);
+    }
+
+    g_ucHead = (g_ucHead + 1) % I2C_QUEUE_DEPTH;
+    g_ucCount--;
+
+    if (g_ucCount > 0)
+    {
+        StartTransaction();
+    }
+}
+
+static void IssueCommand(unsigned long ulCmd)
+{
+    g_ulLastCmd = ulCmd;
+    MAP_I2CMasterControl(I2C_BASE, ulCmd);
+}
+
+static unsigned long GetDeviceMode(unsigned char ucDevAddr)
+{
+    unsigned char i;
+
+    for (i = 0; i < g_ucNumDevices; i++)
+    {
+        if (g_DeviceMode[i].ucDevAddr == ucDevAddr)
+        {
+            return g_DeviceMode[i].ulMode;
+        }
+    }
+
+    return I2C_MASTER_MODE_STD;
+}
+
+//****************************************************************************
+//
+//! Masks interrupts around queue updates, which may be made from the main
+//! loop, the sampler timer interrupt and the I2C interrupt itself.
+//!
+//! \return whether interrupts were already disabled
+//
+//****************************************************************************
+static tBoolean EnterCritical(void)
+{
+    return MAP_IntMasterDisable();
+}
+
+static void ExitCritical(tBoolean bWasDisabled)
+{
+    if (!bWasDisabled)
+    {
+        MAP_IntMasterEnable();
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef __I2C_QUEUE_IF_H__
+#define __I2C_QUEUE_IF_H__
+//*****************************************************************************
+//
+// i2c_queue_if.h
+//
+// Header file for the interrupt-driven I2C transaction queue. Transactions
+// are copied into a fixed-size queue and run back-to-back from the I2C
+// interrupt, so callers never wait on the bus unless they ask to.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "i2c_if.h"
+
+// Number of transactions that can be queued at once
+#define I2C_QUEUE_DEPTH         16
+
+// Maximum number of bytes written or read by one transaction
+#define I2C_QUEUE_MAX_DATA      8
+
+// Maximum number of devices with a bus speed registered
+#define I2C_QUEUE_MAX_DEVICES   4
+
+//****************************************************************************
+// Called from the I2C interrupt when a transaction completes.
+// iStatus is SUCCESS or FAILURE, pucRdData holds ucRdLen bytes read from the
+// device and is only valid for the duration of the call.
+//****************************************************************************
+typedef void (*I2C_Callback)(int iStatus, unsigned char *pucRdData,
+                             unsigned char ucRdLen, void *pvArg);
+
+//****************************************************************************
+// Switches the I2C peripheral to interrupt-driven operation.
+// I2C_IF_Open() must be called first.
+//****************************************************************************
+int I2C_Queue_Open(void);
+
+//****************************************************************************
+// Sets the bus speed (I2C_MASTER_MODE_STD or I2C_MASTER_MODE_FST) used for
+// transactions with a device. Unregistered devices use the standard mode.
+//****************************************************************************
+int I2C_Queue_SetDeviceMode(unsigned char ucDevAddr, unsigned long ulMode);
+
+//****************************************************************************
+// Queues a write of ucWrLen bytes followed by a read of ucRdLen bytes, using
+// a repeated start between the two. Either length may be 0. Safe to call
+// from interrupt context. pfnDone may be NULL.
+//****************************************************************************
+int I2C_Queue_Submit(unsigned char ucDevAddr,
+                     const unsigned char *pucWrData, unsigned char ucWrLen,
+                     unsigned char ucRdLen,
+                     I2C_Callback pfnDone, void *pvArg);
+
+//****************************************************************************
+// Queues a transaction and waits for it to complete.
+// Must not be called from interrupt context.
+//****************************************************************************
+int I2C_Queue_Transfer(unsigned char ucDevAddr,
+                       const unsigned char *pucWrData, unsigned char ucWrLen,
+                       unsigned char *pucRdData, unsigned char ucRdLen);
+
+//****************************************************************************
+// Returns the number of transactions dropped because the queue was full
+//****************************************************************************
+unsigned long I2C_Queue_GetDropCount(void);
+
+#endif //  __I2C_QUEUE_IF_H__
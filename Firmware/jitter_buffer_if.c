@@ -0,0 +1,429 @@
+//*****************************************************************************
+//
+// jitter_buffer_if.c
+//
+// Pose jitter buffer. DATA payloads are stamped with their arrival time and
+// queued; a timer interrupt ticking once per PCA9685 PWM period plays each
+// one a fixed playout delay after it arrived, by handing it to the servo
+// motion profiles in servo_driver_if.c, and steps the profiles.
+//
+// The playout delay is a whole number of ticks, the target depth, so a pose
+// that arrives up to that late still plays on time. It follows the measured
+// arrival jitter: the spread of packet inter-arrival times around their
+// mean, smoothed over about 16 packets. A tick that finds nothing to play
+// when the next pose was due is an underrun; the joints carry on to the
+// last target. A pose that is superseded by a newer one due on the same
+// tick, or pushed out of a full buffer, is an overrun.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <string.h>
+
+// Driverlib includes
+#include "hw_types.h"
+#include "hw_ints.h"
+#include "hw_memmap.h"
+#include "rom.h"
+#include "rom_map.h"
+#include "interrupt.h"
+#include "timer.h"
+#include "prcm.h"
+
+// Common interface includes
+#include "common.h"
+#include "timer_if.h"
+#include "timebase_if.h"
+
+#include "servo_driver_if.h"
+#include "profiler_if.h"
+#include "trajectory_if.h"
+#include "jitter_buffer_if.h"
+
+#define JITTER_TICK_US              (JITTER_BUFFER_TICK_MS*1000UL)
+
+// Smoothing of the jitter and latency estimates, each update moves them
+// 1/JITTER_SMOOTHING of the way
+#define JITTER_SMOOTHING            16
+
+// The target depth covers a packet this many times the jitter late
+#define JITTER_DEPTH_MARGIN         2
+
+// A longer gap between packets is a pause in the stream, not jitter
+#define JITTER_MAX_INTERVAL_US      ((long)(JITTER_BUFFER_SIZE*JITTER_TICK_US))
+
+struct JitterPose {
+    unsigned char ucDegrees[NUM_SERVOS];
+    unsigned long ulArrival;            // Timebase_GetMicros() on arrival
+};
+
+static struct JitterPose g_Pose[JITTER_BUFFER_SIZE];
+static volatile unsigned char g_ucHead = 0;     // Next slot to write
+static volatile unsigned char g_ucTail = 0;     // Next slot to apply
+static volatile unsigned char g_ucDepth = 0;
+
+static tBoolean g_bPlayed = false;
+static tBoolean g_bLate = false;
+static unsigned long g_ulLastPlayout = 0;
+
+static tBoolean g_bArrived = false;
+static unsigned long g_ulLastArrival = 0;
+static long g_lMeanInterval = 0;
+
+static struct JitterBufferStats g_Stats;
+
+static void JitterBufferIntHandler(void);
+static void DropOldest(void);
+static void UpdateJitter(unsigned long ulNow);
+static tBoolean EnterCritical(void);
+static void ExitCritical(tBoolean bWasDisabled);
+
+//****************************************************************************
+//
+//! Sets up the playback timer. The timebase must be initialized first.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void InitJitterBuffer(void)
+{
+    Timer_IF_Init(JITTER_BUFFER_TIMER_PRCM, JITTER_BUFFER_TIMER_BASE,
+                  TIMER_CFG_PERIODIC, JITTER_BUFFER_TIMER, 0);
+    Timer_IF_IntSetup(JITTER_BUFFER_TIMER_BASE, JITTER_BUFFER_TIMER,
+                      JitterBufferIntHandler);
+}
+
+//****************************************************************************
+//
+//! Empties the buffer, clears the statistics and starts playback from the
+//! current servo positions
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void StartJitterBuffer(void)
+{
+    g_ucHead = 0;
+    g_ucTail = 0;
+    g_ucDepth = 0;
+    g_bPlayed = false;
+    g_bLate = false;
+    g_bArrived = false;
+    g_lMeanInterval = 0;
+
+    memset(&g_Stats, 0, sizeof(g_Stats));
+    g_Stats.ucTargetDepth = JITTER_BUFFER_MIN_DEPTH;
+
+    // Joints start from wherever the servos were left
+    ResetServoMotion_PWM_Breakout();
+
+    Timer_IF_Start(JITTER_BUFFER_TIMER_BASE, JITTER_BUFFER_TIMER,
+                   JITTER_BUFFER_TICK_MS);
+}
+
+//****************************************************************************
+//
+//! Stops playback. Buffered poses are discarded, the servos hold the last
+//! pose applied.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void StopJitterBuffer(void)
+{
+    Timer_IF_Stop(JITTER_BUFFER_TIMER_BASE, JITTER_BUFFER_TIMER);
+    g_ucDepth = 0;
+    g_ucTail = g_ucHead;
+}
+
+//****************************************************************************
+//
+//! Queues a DATA payload. If the buffer is full the oldest pose is
+//! discarded. Must not be called from interrupt context.
+//!
+//! \param pucPose holds NUM_SERVOS joint positions in degrees
+//!
+//! \return None
+//
+//****************************************************************************
+void PushJitterBuffer(const unsigned char *pucPose)
+{
+    unsigned long ulNow = Timebase_GetMicros();
+    tBoolean bWasDisabled;
+
+    bWasDisabled = EnterCritical();
+
+    UpdateJitter(ulNow);
+
+    if (g_ucDepth == JITTER_BUFFER_SIZE)
+    {
+        DropOldest();
+    }
+
+    memcpy(g_Pose[g_ucHead].ucDegrees, pucPose, NUM_SERVOS);
+    g_Pose[g_ucHead].ulArrival = ulNow;
+    g_ucHead = (g_ucHead + 1) % JITTER_BUFFER_SIZE;
+    g_ucDepth++;
+
+    ExitCritical(bWasDisabled);
+}
+
+//****************************************************************************
+//
+//! Copies the playback statistics
+//!
+//! \param pStats receives the statistics
+//!
+//! \return None
+//
+//****************************************************************************
+void GetJitterBufferStats(struct JitterBufferStats *pStats)
+{
+    tBoolean bWasDisabled;
+
+    bWasDisabled = EnterCritical();
+    memcpy(pStats, &g_Stats, sizeof(*pStats));
+    pStats->ucDepth = g_ucDepth;
+    ExitCritical(bWasDisabled);
+}
+
+//****************************************************************************
+//
+//! Writes the playback statistics into a STATS payload. Fields are
+//! big-endian and saturate rather than wrap:
+//!   bytes 0-1 underruns, 2-3 overruns, 4 target depth, 5 depth,
+//!   6-7 jitter and 8-9 average delay, both in units of 100 microseconds
+//!
+//! \param pucPayload receives JITTER_BUFFER_STATS_LEN bytes
+//!
+//! \return None
+//
+//****************************************************************************
+void PackJitterBufferStats(unsigned char *pucPayload)
+{
+    struct JitterBufferStats stats;
+    unsigned long ulField[4];
+    int i;
+
+    GetJitterBufferStats(&stats);
+
+    ulField[0] = stats.ulUnderruns;
+    ulField[1] = stats.ulOverruns;
+    ulField[2] = (unsigned long)stats.lJitter/100;
+    ulField[3] = (unsigned long)stats.lLatency/100;
+    for (i = 0; i < 4; i++)
+    {
+        if (ulField[i] > 0xFFFF)
+        {
+            ulField[i] = 0xFFFF;
+        }
+    }
+
+    pucPayload[0] = (ulField[0] >> 8) & 0xFF;
+    pucPayload[1] = ulField[0] & 0xFF;
+    pucPayload[2] = (ulField[1] >> 8) & 0xFF;
+    pucPayload[3] = ulField[1] & 0xFF;
+    pucPayload[4] = stats.ucTargetDepth;
+    pucPayload[5] = stats.ucDepth;
+    pucPayload[6] = (ulField[2] >> 8) & 0xFF;
+    pucPayload[7] = ulField[2] & 0xFF;
+    pucPayload[8] = (ulField[3] >> 8) & 0xFF;
+    pucPayload[9] = ulField[3] & 0xFF;
+}
+
+//****************************************************************************
+//
+//! Playback tick. Hands the newest pose that is due to the servo motion
+//! profiles, then advances them. While an uploaded trajectory is active its
+//! frame is used instead and buffered poses are discarded. Returns without
+//! waiting for the bus.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void JitterBufferIntHandler(void)
+{
+    unsigned char ucDegrees[NUM_SERVOS];
+    unsigned long ulNow;
+    unsigned long ulDelay;
+    unsigned long ulArrival;
+    unsigned long ulBegin;
+    tBoolean bDue = false;
+    int i;
+
+    Timer_IF_InterruptClear(JITTER_BUFFER_TIMER_BASE);
+
+    ulNow = Timebase_GetMicros();
+    ulDelay = g_Stats.ucTargetDepth*JITTER_TICK_US;
+
+    if (StepTrajectory(ulNow, ucDegrees))
+    {
+        for (i = 0; i < NUM_SERVOS; i++)
+        {
+            SetServoTarget_PWM_Breakout(ucDegrees[i], (enum Servo_Joint_Type)i);
+        }
+
+        // DATA poses pick up after the trajectory without counting the gap
+        g_ucDepth = 0;
+        g_ucTail = g_ucHead;
+        g_ulLastPlayout = ulNow;
+        g_bLate = false;
+    }
+
+    // Poses are due the playout delay after they arrived. Of several due on
+    // the same tick only the newest is used.
+    while (g_ucDepth > 0 && TIMEBASE_ELAPSED(ulNow, g_Pose[g_ucTail].ulArrival) >= ulDelay)
+    {
+        if (bDue)
+        {
+            g_Stats.ulOverruns++;
+        }
+        memcpy(ucDegrees, g_Pose[g_ucTail].ucDegrees, NUM_SERVOS);
+        ulArrival = g_Pose[g_ucTail].ulArrival;
+        g_ucTail = (g_ucTail + 1) % JITTER_BUFFER_SIZE;
+        g_ucDepth--;
+        bDue = true;
+    }
+
+    if (bDue)
+    {
+        for (i = 0; i < NUM_SERVOS; i++)
+        {
+            SetServoTarget_PWM_Breakout(ucDegrees[i], (enum Servo_Joint_Type)i);
+        }
+
+        // The estimates step down as well as up, so they are kept signed
+        // and never let below zero
+        g_Stats.lLatency += ((long)TIMEBASE_ELAPSED(ulNow, ulArrival) -
+                             g_Stats.lLatency)/JITTER_SMOOTHING;
+        if (g_Stats.lLatency < 0)
+        {
+            g_Stats.lLatency = 0;
+        }
+        g_ulLastPlayout = ulNow;
+        g_bPlayed = true;
+        g_bLate = false;
+    }
+    else if (g_bPlayed && !g_bLate && g_ucDepth == 0 &&
+             (long)TIMEBASE_ELAPSED(ulNow, g_ulLastPlayout) > g_lMeanInterval + (long)JITTER_TICK_US)
+    {
+        // The next pose should have been played by now; the joints carry on
+        // to the last target meanwhile
+        g_Stats.ulUnderruns++;
+        g_bLate = true;
+    }
+
+    ulBegin = ProfileBegin();
+    StepServoMotion_PWM_Breakout(JITTER_BUFFER_TICK_MS);
+    ProfileEnd(PROFILE_SERVO, ulBegin);
+}
+
+//****************************************************************************
+//
+//! Discards the oldest buffered pose. Interrupts must be masked.
+//
+//****************************************************************************
+static void DropOldest(void)
+{
+    g_ucTail = (g_ucTail + 1) % JITTER_BUFFER_SIZE;
+    g_ucDepth--;
+    g_Stats.ulOverruns++;
+}
+
+//****************************************************************************
+//
+//! Updates the arrival jitter estimate and the target depth with a new
+//! arrival. Interrupts must be masked.
+//!
+//! \param ulNow is the arrival time in microseconds
+//
+//****************************************************************************
+static void UpdateJitter(unsigned long ulNow)
+{
+    long lInterval;
+    long lDeviation;
+    unsigned long ulDepth;
+
+    if (!g_bArrived)
+    {
+        g_bArrived = true;
+        g_ulLastArrival = ulNow;
+        return;
+    }
+
+    lInterval = (long)TIMEBASE_ELAPSED(ulNow, g_ulLastArrival);
+    g_ulLastArrival = ulNow;
+    if (lInterval > JITTER_MAX_INTERVAL_US)
+    {
+        return;
+    }
+
+    if (g_lMeanInterval == 0)
+    {
+        g_lMeanInterval = lInterval;
+    }
+    else
+    {
+        g_lMeanInterval += (lInterval - g_lMeanInterval)/JITTER_SMOOTHING;
+    }
+
+    lDeviation = lInterval - g_lMeanInterval;
+    if (lDeviation < 0)
+    {
+        lDeviation = -lDeviation;
+    }
+    g_Stats.lJitter += (lDeviation - g_Stats.lJitter)/JITTER_SMOOTHING;
+    if (g_Stats.lJitter < 0)
+    {
+        g_Stats.lJitter = 0;
+    }
+
+    // Enough ticks to cover a late packet of a few times the jitter
+    ulDepth = JITTER_BUFFER_MIN_DEPTH +
+              (JITTER_DEPTH_MARGIN*(unsigned long)g_Stats.lJitter + JITTER_TICK_US - 1)/JITTER_TICK_US;
+    if (ulDepth > JITTER_BUFFER_MAX_DEPTH)
+    {
+        ulDepth = JITTER_BUFFER_MAX_DEPTH;
+    }
+    g_Stats.ucTargetDepth = (unsigned char)ulDepth;
+}
+
+//****************************************************************************
+//
+//! Masks interrupts around buffer updates made from the main loop, which
+//! race with the playback interrupt.
+//!
+//! \return whether interrupts were already disabled
+//
+//****************************************************************************
+static tBoolean EnterCritical(void)
+{
+    return MAP_IntMasterDisable();
+}
+
+static void ExitCritical(tBoolean bWasDisabled)
+{
+    if (!bWasDisabled)
+    {
+        MAP_IntMasterEnable();
+    }
+}
@@ -0,0 +1,90 @@
+#ifndef __JITTER_BUFFER_IF_H__
+#define __JITTER_BUFFER_IF_H__
+//*****************************************************************************
+//
+// jitter_buffer_if.h
+//
+// Header file for the pose jitter buffer. Poses from DATA packets are queued
+// as they arrive and played a fixed delay later from a timer interrupt that
+// ticks once per PWM period, so bursty network delivery does not reach the
+// hand. Played poses become the targets of the servo motion profiles.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "servo_driver_if.h"
+
+// Timer used to pace playback. It is set up as one full-width timer, which
+// takes all of TIMERA3, so playback cannot run alongside the GPT PWM path in
+// servo_driver.c: InitPWMModules() splits TIMERA3 to drive two servos. Only
+// the PCA9685 breakout board can drive the servos meanwhile.
+#define JITTER_BUFFER_TIMER_PRCM    PRCM_TIMERA3
+#define JITTER_BUFFER_TIMER_BASE    TIMERA3_BASE
+#define JITTER_BUFFER_TIMER         TIMER_A
+
+// Playback and the servo motion profiles tick once per PCA9685 PWM period,
+// which is when the board outputs a new servo pulse
+#define JITTER_BUFFER_TICK_MS       SERVO_PWM_PERIOD_MS
+
+// Number of poses that can be buffered. The playout delay is between
+// JITTER_BUFFER_MIN_DEPTH and JITTER_BUFFER_MAX_DEPTH ticks.
+#define JITTER_BUFFER_SIZE          8
+#define JITTER_BUFFER_MIN_DEPTH     1
+#define JITTER_BUFFER_MAX_DEPTH     (JITTER_BUFFER_SIZE - 1)
+
+// Length of a STATS payload
+#define JITTER_BUFFER_STATS_LEN     10
+
+struct JitterBufferStats {
+    unsigned long ulUnderruns;      // Times the next pose was not there in time
+    unsigned long ulOverruns;       // Poses discarded without being played
+    unsigned char ucTargetDepth;    // Playout delay in ticks
+    unsigned char ucDepth;          // Poses currently buffered
+    long lJitter;                   // Arrival jitter estimate in microseconds
+    long lLatency;                  // Average buffering delay in microseconds
+};
+
+//****************************************************************************
+// Sets up the playback timer. The timebase must be initialized first.
+//****************************************************************************
+void InitJitterBuffer(void);
+
+//****************************************************************************
+// Empties the buffer, clears the statistics and starts playback
+//****************************************************************************
+void StartJitterBuffer(void);
+
+//****************************************************************************
+// Stops playback. Buffered poses are discarded, the servos hold the last
+// pose applied.
+//****************************************************************************
+void StopJitterBuffer(void);
+
+//****************************************************************************
+// Queues a DATA payload of NUM_SERVOS joint positions in degrees.
+// Must not be called from interrupt context.
+//****************************************************************************
+void PushJitterBuffer(const unsigned char *pucPose);
+
+//****************************************************************************
+// Copies the playback statistics
+//****************************************************************************
+void GetJitterBufferStats(struct JitterBufferStats *pStats);
+
+//****************************************************************************
+// Writes the playback statistics into a STATS payload of
+// JITTER_BUFFER_STATS_LEN bytes
+//****************************************************************************
+void PackJitterBufferStats(unsigned char *pucPayload);
+
+#endif //  __JITTER_BUFFER_IF_H__
@@ -12,7 +12,7 @@
 //
 // Created: December 21, 2015
 //
-// Modified: March 19, 2016
+// Modified: October 19, 2026
 //
 //*****************************************************************************
 // Standard includes
@@ -44,27 +44,23 @@
 #include "uart_if.h"
 #endif
 
-#include "pin_mux_config.h"
-#include "tcp_socket.h"
-#include "servo_driver_if.h"
-#include "servo_driver_search_pressure_if.h"
-#include "adc_driver_if.h"
-//#include "adc_break_out_if.h"
-#include "i2c_if.h"
-
-#include "pwm_break_out_if.h"
-#include "adc_break_out_if.h"
+// OS includes
+#include "osi.h"
 
-// HTTP Client lib
-#include <http/client/httpcli.h>
-#include <http/client/common.h>
-#include "hircp.h"
+#include "pin_mux_config.h"
+#include "timebase_if.h"
+#include "profiler_if.h"
+#include "control_task_if.h"
+#include "network_task_if.h"
 
 /* Config for the TCP */
 #define APPLICATION_NAME        "Human Interface for Robotic Control"
 #define APPLICATION_VERSION     "0.0.1"
 #define DBG_PRINT               Report
 
+// The SimpleLink host driver's task runs above the application tasks
+#define SPAWN_TASK_PRIORITY     9
+
 /***************************END OF TCP CONFIG ************************************/
 
 //****************************************************************************
@@ -72,7 +68,6 @@
 //****************************************************************************
 static void DisplayBanner();
 static void BoardInit();
-static void UserInput(char *input_message, char* output_message, long out_length);
 //*****************************************************************************
 //                 GLOBAL VARIABLES -- Start
 //*****************************************************************************
@@ -140,236 +135,115 @@ static void BoardInit(void)
     PRCMCC3200MCUInit();
 }
 
+#ifdef USE_FREERTOS
+//*****************************************************************************
+//
+//! Application defined hook (or callback) function - the tick hook.
+//! The tick interrupt can optionally call this
+//!
+//! \param  none
+//!
+//! \return none
+//!
+//*****************************************************************************
+void vApplicationTickHook(void)
+{
+    // The kernel owns SysTick, count the timebase's milliseconds from here
+    Timebase_Tick();
+}
+
+//*****************************************************************************
+//
+//! Application defined idle task hook
+//!
+//! \param  none
+//!
+//! \return none
+//!
+//*****************************************************************************
+void vApplicationIdleHook(void)
+{
+    //Handle Idle Hook for Profiling, Power Management etc
+}
+
+//*****************************************************************************
+//
+//! Application defined malloc failed hook
+//!
+//! \param  none
+//!
+//! \return none
+//!
+//*****************************************************************************
+void vApplicationMallocFailedHook(void)
+{
+    //Handle Memory Allocation Errors
+    while(1)
+    {
+    }
+}
+
+//*****************************************************************************
+//
+//! Application defined stack overflow hook
+//!
+//! \param  none
+//!
+//! \return none
+//!
+//*****************************************************************************
+void vApplicationStackOverflowHook(OsiTaskHandle *pxTask, signed char *pcTaskName)
+{
+    //Handle FreeRTOS Stack Overflow
+    while(1)
+    {
+    }
+}
+#endif //USE_FREERTOS
+
 //****************************************************************************
 //                            MAIN FUNCTION
 //****************************************************************************
 void main()
 {
     long lRetVal = 0;
-    char ssid[50];
-    char password[50];
-    char security_type[50];
-    unsigned char recv_data[HIRCP_MAX_PACKET_LEN];
-    unsigned char send_data[HIRCP_MAX_PACKET_LEN];
-    unsigned char recv_payload[HIRCP_MAX_PAYLOAD_LEN];
-    unsigned char send_payload[HIRCP_MAX_PAYLOAD_LEN];
-    unsigned char highByte, lowByte;
-    unsigned short adc_reading;
-    int i;
-    tBoolean connected;
-
-    HIRCP_Packet *sendPacket = HIRCP_CreatePacket();
-    HIRCP_Packet *recvPacket = HIRCP_CreatePacket();
-
-    // Zeroes out memory buffers
-    memset(recv_data, 0, HIRCP_MAX_PACKET_LEN);
-    memset(send_data, 0, HIRCP_MAX_PACKET_LEN);
 
     // Board Initialization
     BoardInit();
 
+    // Start the cycle counter used to profile the firmware
+    InitProfiler();
+
+    // Start the shared timebase used by the drivers for timestamps and waits
+    Timebase_Init();
+
     // Configure the pinmux settings for the peripherals exercised
     PinMuxConfig();
 
     // Configuring UART
     InitTerm();
 
-    // Configure I2C
-    I2C_IF_Open(I2C_MASTER_MODE_STD);
-
-    // Initialize the PWM outputs on the board
-    InitServos_PWM_Breakout();
-
-    // Initialize the sensor ADC
-    InitSensorADC();
-
     // Display banner
     DisplayBanner(APPLICATION_NAME);
 
-    // Connect to WIFI using default info
-    /* Getting user WIFI by user input */
-    /*
-    UserInput("Enter SSID:",ssid, sizeof(ssid));
-    UserInput("Enter Password:", password, sizeof(password));
-    UserInput("Enter Security_Type:", security_type, sizeof(security_type));
-    WlanConnect(ssid, security_type, password);
-    */
-    /*Hard-coded approach*/
-    //WlanConnect("Nagui's Network", "wpa", "19520605");
-    //WlanConnect("NETGEAR31", "SL_SEC_TYPE_WPA", "happystar329");
-    //WlanConnect("Minh's iPhone", "SL_SEC_TYPE_WPA", "minh1234");
-    WlanConnect("robotic", "wpa", "robotichand");
-
-    // Setup the TCP Server Socket for listening
-    BsdTcpServerSetup(PORT_NUM);
-
-    while (TRUE)
+    // Start the SimpleLink host driver's task
+    lRetVal = VStartSimpleLinkSpawnTask(SPAWN_TASK_PRIORITY);
+    if (lRetVal < 0)
     {
-        connected = false;
-        while (!connected)
-        {
-            // Accept incoming connections
-            if (BsdTcpServerAccept() != SUCCESS)
-            {
-                UART_PRINT("Accept() failed.n\r");
-                continue;
-            }
-
-            if (!HIRCP_InitiateConnectionSequence())
-            {
-                UART_PRINT("Received invalid packet... aborting connection\n\r");
-                continue;
-            }
-
-            connected = true;
-        }
-
-        while (lRetVal >= 0)
-        {
-            // Receive packet data
-            lRetVal = BsdTcpServerReceive(recv_data, HIRCP_MAX_PACKET_LEN);
-            if (lRetVal < 0)
-            {
-            	break;
-            }
-
-            // Populates packet structure and checks validity
-            HIRCP_Populate(recvPacket, recv_data, HIRCP_MAX_PACKET_LEN);
-            if (HIRCP_IsValid(recvPacket))
-            {
-                if (HIRCP_GetType(recvPacket) == HIRCP_DATA)
-                {
-                    // Get packet payload
-                    HIRCP_GetPayload(recvPacket, recv_payload, HIRCP_MAX_PAYLOAD_LEN);
-                    UART_PRINT("Received DATA packet.\n\r");
-                }
-                else if (HIRCP_GetType(recvPacket) == HIRCP_MODE)
-                {
-                    UART_PRINT("Received MODE packet.\n\r");
-                    HIRCP_GetPayload(recvPacket, recv_payload, HIRCP_MAX_PAYLOAD_LEN);
-
-                    //
-                    // Check for mode
-                    //
-                    HIRCP_GetPayload(recvPacket, recv_payload, HIRCP_MAX_PAYLOAD_LEN);
-                    if (recv_payload[0] != HIRCP_NORMAL && recv_payload[0] != HIRCP_CLOSED_LOOP)
-                    {
-                        UART_PRINT("Invalid mode.\n\r");
-                        //
-                        // TODO (Brandon): Send ERR packet
-                        //
-                        break;
-                    }
-                    g_hircp_mode = recv_payload[0];
-
-                    // Sends ACK
-                    /*HIRCP_ClearPacket(sendPacket);
-                    HIRCP_SetType(sendPacket, HIRCP_ACK);
-                    HIRCP_GetData(sendPacket, send_data, HIRCP_MAX_PACKET_LEN);
-                    lRetVal = BsdTcpServerSend(send_data, HIRCP_MAX_PACKET_LEN);
-                    if (lRetVal < 0)
-                    {
-            	        break;
-                    }
-                    UART_PRINT("Sent ACK packet.\n\r");*/
-                    continue;
-                }
-                else if (HIRCP_GetType(recvPacket) == HIRCP_TRQ)
-                {
-                    UART_PRINT("Received TRQ packet.\n\r");
-                    HIRCP_InitiateTerminationSequence();
-                    break;
-                }
-            }
-            else
-            {
-                // TODO (Brandon): Handle invalid packets
-                continue;
-            }
-
-            if (g_hircp_mode == HIRCP_NORMAL)
-            {
-                // Moves servo motors using data from packet
-                for (i = 0; i<NUM_SERVOS; i++)
-                {
-                    MoveServo_PWM_Breakout((unsigned char)recv_payload[i], (enum Servo_Joint_Type)i);
-                }
-
-                // Gets pressure readings from sensors and populates buffer to be used as payload for sending
-                for (i = 0; i<NUM_SENSORS; i++)
-                {
-                    adc_reading = GetSensorReading((enum Fingertip_Sensor_Type)i);
-                    //adc_reading = 2048;
-                    UART_PRINT("Finger: %d, reading: %d,\n\r", i, adc_reading);
-
-                    UnsignedShort_to_UnsignedChar(adc_reading, &highByte, &lowByte);
-                    send_payload[i*2] = (char)highByte;
-                    send_payload[i*2+1] = (char)lowByte;
-                }
-            }
-            else if (g_hircp_mode == HIRCP_CLOSED_LOOP)
-            {
-                MoveServo_SearchPressure(CMD_CLOSE, send_payload);
-            }
-            else
-            {
-                UART_PRINT("ERROR UNSUPPORTED MODE.\n\r");
-            }
-
-            // Configure packet fields and gets packet data to send
-            HIRCP_SetType(sendPacket, HIRCP_DACK);
-            HIRCP_SetPayload(sendPacket, send_payload, HIRCP_MAX_PAYLOAD_LEN);
-            HIRCP_GetData(sendPacket, send_data, HIRCP_MAX_PACKET_LEN);
-
-            // Sends data
-            lRetVal = BsdTcpServerSend(send_data, HIRCP_MAX_PACKET_LEN);
-            if (lRetVal < 0)
-            {
-            	break;
-            }
-            UART_PRINT("Sent DACK packet.\n\r");
-        }
+        UART_PRINT("Unable to start simpelink spawn task\n\r");
+        LOOP_FOREVER();
     }
 
-    // Frees resources held by HIRCP_Packet
-    HIRCP_DestroyPacket(sendPacket);
-    HIRCP_DestroyPacket(recvPacket);
+    // The control task brings up the servos and sensors and drives the hand
+    InitControlTask();
 
-    // Closes listening socket
-    BsdTcpServerClose();
+    // The network tasks serve HIRCP connections and feed the control task
+    InitNetworkTasks();
 
-    // Power off the network processor
-    lRetVal = sl_Stop(SL_STOP_TIMEOUT);
+    // Start the task scheduler, never returns
+    osi_start();
 }
 
-//*****************************************************************************
-//
-//! UserInput
-//!
-//! This function
-//!        1. Function for reading the user input for UDP RX/TX
-//!
-//!  \return 0 : Success, -ve : failure
-//
-//*****************************************************************************
-static void UserInput(char *input_message, char* output_message, long out_length)
-{
-    int lRetVal;
-    do
-    {
-
-        UART_PRINT("%s",input_message);
-        lRetVal = GetCmd(output_message, out_length);
-        if(lRetVal == 0)
-        {
-          //
-          // No input. Just an enter pressed probably. Display a prompt.
-          //
-          UART_PRINT("\n\n\rPlease Enter Valid Input.\n\r");
-        }
-        UART_PRINT("\n\r");
-    }while(lRetVal <= 0);
-}
 //*****************************************************************************
 //
 // Copyright (C) 2014 Texas Instruments Incorporated - http://www.ti.com/
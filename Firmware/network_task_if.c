@@ -0,0 +1,717 @@
+//*****************************************************************************
+//
+// network_task_if.c
+//
+// Network tasks. The receive task connects to the access point and serves
+// one HIRCP connection at a time. Commands for the hand are posted to the
+// control task; DACK and STATS replies are built straight away from the
+// sensor snapshot and playback statistics and queued for the transmit task.
+//
+// While a connection is served the discovery task advertises the robot as
+// busy.
+//
+// The client socket is non-blocking. Each time data arrives the receive
+// task reads all of it into a frame reader, which hands out whole packets
+// however TCP split or merged them. Poses that queued up while the hand was
+// busy are not played one after another: only the newest DATA is applied
+// and answered, and the skipped ones are counted.
+//
+// Only one connection is served at a time. A controller reconnecting after
+// its link dropped usually finds the old connection still open here, as
+// nothing was sent to close it, so a connection that has been quiet for a
+// poll period gives way to a client waiting to be accepted. A connection
+// that has received nothing at all for NETWORK_INACTIVITY_TIMEOUT_MS is
+// ended even with nobody waiting; controllers send PING packets to keep an
+// idle connection open. PINGs are answered straight away and do not make a
+// pending pose apply early. The PONG carries this clock, from which the
+// controller estimates how far its own is ahead; with the stamped DATA
+// option it then stamps every pose with its send time on this clock, and
+// the one-way latency of the poses is collected here for STATS.
+//
+// The transmit task sends queued replies in order. A failed send is noted
+// and ends the connection the next time the receive task looks. Before a
+// connection is torn down the receive task flushes the queue, so replies
+// never go out on the next connection and the termination ACK follows them.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <string.h>
+
+// simplelink includes
+#include "simplelink.h"
+
+// Driverlib includes
+#include "hw_types.h"
+
+// OS includes
+#include "osi.h"
+
+// Common interface includes
+#include "common.h"
+#ifndef NOTERM
+#include "uart_if.h"
+#endif
+
+#include "tcp_socket.h"
+#include "hircp.h"
+#include "sensor_sampler_if.h"
+#include "jitter_buffer_if.h"
+#include "control_task_if.h"
+#include "profiler_if.h"
+#include "trajectory_if.h"
+#include "frame_reader_if.h"
+#include "discovery_task_if.h"
+#include "timebase_if.h"
+#include "network_task_if.h"
+
+enum Network_Tx_Type {
+    NETWORK_TX_SEND = 1,        // Send the packet
+    NETWORK_TX_FLUSH            // Signal the receive task once reached
+};
+
+struct NetworkTxMessage {
+    unsigned char ucType;
+    unsigned char ucData[HIRCP_MAX_PACKET_LEN];
+};
+
+static OsiMsgQ_t g_TxQueue;
+static OsiMsgQ_t g_TxFlushedQueue;
+
+// Set by the transmit task when a send fails, cleared per connection
+static volatile tBoolean g_bTxFailed = false;
+
+static HIRCP_Packet *g_pSendPacket;
+
+// DATA packets dropped because a newer one was already waiting
+static volatile unsigned long g_ulSkippedPoses = 0;
+
+// One-way latency of stamped DATA packets, cleared per connection
+struct UplinkStats {
+    unsigned long ulCount;
+    long lMin;                  // Microseconds, negative if clocks disagree
+    long lMax;
+    long long llTotal;
+};
+static struct UplinkStats g_Uplink;
+
+static void NetworkRxTask(void *pvParameters);
+static void NetworkTxTask(void *pvParameters);
+static void ServeConnection(void);
+static void HandlePose(unsigned char *pucPayload);
+static void HandlePing(HIRCP_Packet *pPacket);
+static void RecordUplink(unsigned char *pucPayload, unsigned long ulArrival);
+static void PackUplinkStats(unsigned char *pucPayload);
+static tBoolean HandlePacket(HIRCP_Packet *pPacket);
+static void QueueReply(HIRCP_Type eType, unsigned char *pucPayload);
+static void FlushReplies(void);
+
+//****************************************************************************
+//
+//! Creates the transmit queue and both tasks
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void InitNetworkTasks(void)
+{
+    long lRetVal;
+
+    g_pSendPacket = HIRCP_CreatePacket();
+
+    lRetVal = osi_MsgQCreate(&g_TxQueue, "NetworkTxQueue",
+                             sizeof(struct NetworkTxMessage), NETWORK_TX_QUEUE_LEN);
+    if (lRetVal == OSI_OK)
+    {
+        lRetVal = osi_MsgQCreate(&g_TxFlushedQueue, "NetworkTxFlushed",
+                                 sizeof(unsigned char), 1);
+    }
+    if (lRetVal != OSI_OK)
+    {
+        UART_PRINT("Network queue creation failed\n\r");
+        LOOP_FOREVER();
+    }
+
+    lRetVal = osi_TaskCreate(NetworkTxTask, (const signed char *)"NetworkTx",
+                             NETWORK_TASK_STACK_SIZE, NULL,
+                             NETWORK_TX_TASK_PRIORITY, NULL);
+    if (lRetVal == OSI_OK)
+    {
+        lRetVal = osi_TaskCreate(NetworkRxTask, (const signed char *)"NetworkRx",
+                                 NETWORK_TASK_STACK_SIZE, NULL,
+                                 NETWORK_RX_TASK_PRIORITY, NULL);
+    }
+    if (lRetVal != OSI_OK)
+    {
+        UART_PRINT("Network task creation failed\n\r");
+        LOOP_FOREVER();
+    }
+}
+
+//****************************************************************************
+//
+//! Receive task entry. Connects to the access point, then accepts and
+//! serves connections one after another.
+//!
+//! \param pvParameters is unused
+//!
+//! \return Never returns
+//
+//****************************************************************************
+static void NetworkRxTask(void *pvParameters)
+{
+    unsigned char ucStart[HIRCP_MAX_PAYLOAD_LEN];
+    tBoolean connected;
+
+    // Connect to WIFI using default info
+    /*Hard-coded approach*/
+    //WlanConnect("Nagui's Network", "wpa", "19520605");
+    //WlanConnect("NETGEAR31", "SL_SEC_TYPE_WPA", "happystar329");
+    //WlanConnect("Minh's iPhone", "SL_SEC_TYPE_WPA", "minh1234");
+    WlanConnect("robotic", "wpa", "robotichand");
+
+    // Setup the TCP Server Socket for listening
+    BsdTcpServerSetup(PORT_NUM);
+
+    // Lets controllers on the network find the server
+    StartDiscovery();
+
+    while (TRUE)
+    {
+        connected = false;
+        while (!connected)
+        {
+            // Accept incoming connections
+            if (BsdTcpServerAccept() != SUCCESS)
+            {
+                UART_PRINT("Accept() failed.n\r");
+                continue;
+            }
+
+            if (!HIRCP_InitiateConnectionSequence())
+            {
+                UART_PRINT("Received invalid packet... aborting connection\n\r");
+                continue;
+            }
+
+            connected = true;
+        }
+
+        // A failed send on the previous connection must not end this one
+        g_bTxFailed = false;
+
+        SetDiscoveryBusy(true);
+
+        // Profile statistics restart with every connection
+        ResetProfiler();
+        memset(&g_Uplink, 0, sizeof(g_Uplink));
+
+        memset(ucStart, 0, HIRCP_MAX_PAYLOAD_LEN);
+        ucStart[0] = (unsigned char)g_hircp_mode;
+        PostControlMessage(CONTROL_START, ucStart);
+
+        ServeConnection();
+
+        // Fingers hold their position until the next connection
+        PostControlMessage(CONTROL_STOP, NULL);
+        FlushReplies();
+
+        SetDiscoveryBusy(false);
+    }
+}
+
+//****************************************************************************
+//
+//! Reads and handles packets until the connection ends. Everything the
+//! client has sent is read at once and only the newest DATA of it is
+//! applied; the other packets are handled in the order they came.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void ServeConnection(void)
+{
+    long lRetVal;
+    int iSpace;
+    unsigned char *pucSpace;
+    unsigned char recv_data[HIRCP_MAX_PACKET_LEN];
+    unsigned char pose_payload[HIRCP_MAX_PAYLOAD_LEN];
+    tBoolean bPosePending = false;
+    tBoolean bDrained;
+    tBoolean bDone = false;
+    tBoolean bValid;
+    tBoolean bFramed;
+    HIRCP_Packet *recvPacket = HIRCP_CreatePacket();
+    struct FrameReader reader;
+    unsigned long ulSkipped = g_ulSkippedPoses;
+    unsigned long ulBegin;
+    unsigned long ulArrival;
+    struct Deadline inactivity;
+
+    FrameReaderReset(&reader);
+    Timebase_SetDeadline(&inactivity, NETWORK_INACTIVITY_TIMEOUT_MS*1000UL);
+
+    while (!bDone && !g_bTxFailed)
+    {
+        // Wakes up now and then to notice a failed send
+        lRetVal = BsdTcpServerWaitReceive(NETWORK_RX_POLL_MS);
+        if (lRetVal < 0)
+        {
+            break;
+        }
+        else if (lRetVal == 0)
+        {
+            // A controller that lost the link connects again while this
+            // connection still looks open. Once it has gone quiet the new
+            // one takes over.
+            if (BsdTcpServerWaitAccept(0) > 0)
+            {
+                UART_PRINT("Client waiting, dropping idle connection.\n\r");
+                break;
+            }
+
+            // The controller went away without closing the connection
+            if (Timebase_DeadlineExpired(&inactivity))
+            {
+                UART_PRINT("Client inactive, ending connection.\n\r");
+                break;
+            }
+            continue;
+        }
+
+        // Reads until the socket is drained or the reader is full. A read
+        // that fills the space offered means more may be waiting.
+        ulBegin = ProfileBegin();
+        bDrained = false;
+        while (!bDrained && (iSpace = FrameReaderSpace(&reader, &pucSpace)) > 0)
+        {
+            lRetVal = BsdTcpServerReceiveAvailable(pucSpace, iSpace);
+            if (lRetVal < 0)
+            {
+                break;
+            }
+            FrameReaderCommit(&reader, lRetVal);
+            bDrained = lRetVal < iSpace;
+        }
+        ProfileEnd(PROFILE_RECEIVE, ulBegin);
+        if (lRetVal < 0)
+        {
+            break;
+        }
+        Timebase_SetDeadline(&inactivity, NETWORK_INACTIVITY_TIMEOUT_MS*1000UL);
+        ulArrival = Timebase_GetMicros();
+
+        while (!bDone)
+        {
+            // Takes the next whole packet, skipping bytes out of step
+            ulBegin = ProfileBegin();
+            bFramed = FrameReaderNext(&reader, recv_data);
+            if (bFramed)
+            {
+                HIRCP_Populate(recvPacket, recv_data, HIRCP_MAX_PACKET_LEN);
+                bValid = HIRCP_IsValid(recvPacket);
+            }
+            ProfileEnd(PROFILE_PARSE, ulBegin);
+            if (!bFramed)
+            {
+                break;
+            }
+            if (!bValid)
+            {
+                // TODO (Brandon): Handle invalid packets
+                continue;
+            }
+
+            if (HIRCP_GetType(recvPacket) == HIRCP_DATA)
+            {
+                // A newer pose replaces one not yet applied
+                if (bPosePending)
+                {
+                    g_ulSkippedPoses++;
+                }
+                HIRCP_GetPayload(recvPacket, pose_payload, HIRCP_MAX_PAYLOAD_LEN);
+                bPosePending = true;
+                RecordUplink(pose_payload, ulArrival);
+            }
+            else if (HIRCP_GetType(recvPacket) == HIRCP_PING)
+            {
+                // Answered at once so the round trip leaves out the hand
+                HandlePing(recvPacket);
+            }
+            else
+            {
+                // Packets that came after a pose see it applied
+                if (bPosePending)
+                {
+                    HandlePose(pose_payload);
+                    bPosePending = false;
+                }
+                bDone = HandlePacket(recvPacket);
+            }
+        }
+
+        // The pose is applied once the socket is drained
+        if (bPosePending && !bDone && bDrained)
+        {
+            HandlePose(pose_payload);
+            bPosePending = false;
+        }
+    }
+
+    if (reader.ulDiscarded != 0)
+    {
+        UART_PRINT("Discarded %lu bytes out of step.\n\r", reader.ulDiscarded);
+    }
+    if (g_ulSkippedPoses != ulSkipped)
+    {
+        UART_PRINT("Skipped %lu stale DATA packets.\n\r", g_ulSkippedPoses - ulSkipped);
+    }
+
+    HIRCP_DestroyPacket(recvPacket);
+}
+
+//****************************************************************************
+//
+//! Applies a pose and replies with the sensor snapshot
+//!
+//! \param pucPayload is the DATA payload
+//!
+//! \return None
+//
+//****************************************************************************
+static void HandlePose(unsigned char *pucPayload)
+{
+    unsigned char send_payload[HIRCP_MAX_PAYLOAD_LEN];
+    tBoolean bTimedDack = (g_hircp_options & HIRCP_OPTION_TIMED_DACK) != 0;
+
+    UART_PRINT("Received DATA packet.\n\r");
+
+    // The reply goes out before the control task takes the pose, so its
+    // round trip is only the network and the parsing
+    if (bTimedDack)
+    {
+        PackTimedSensorSnapshot(send_payload);
+        QueueReply(HIRCP_DACK, send_payload);
+    }
+
+    if (g_hircp_mode == HIRCP_NORMAL || g_hircp_mode == HIRCP_HYBRID)
+    {
+        PostControlMessage(CONTROL_POSE, pucPayload);
+    }
+    else if (g_hircp_mode != HIRCP_CLOSED_LOOP)
+    {
+        UART_PRINT("ERROR UNSUPPORTED MODE.\n\r");
+    }
+
+    // Fingers are moved by the control task, only report
+    if (!bTimedDack)
+    {
+        PackSensorSnapshot(send_payload);
+        QueueReply(HIRCP_DACK, send_payload);
+    }
+}
+
+//****************************************************************************
+//
+//! Answers a PING with a PONG carrying its sequence and timestamp, and the
+//! time on this clock
+//!
+//! \param pPacket is a PING packet
+//!
+//! \return None
+//
+//****************************************************************************
+static void HandlePing(HIRCP_Packet *pPacket)
+{
+    unsigned char payload[HIRCP_MAX_PAYLOAD_LEN];
+    unsigned long ulNow = Timebase_GetMicros();
+
+    HIRCP_GetPayload(pPacket, payload, HIRCP_MAX_PAYLOAD_LEN);
+    payload[6] = (ulNow >> 24) & 0xFF;
+    payload[7] = (ulNow >> 16) & 0xFF;
+    payload[8] = (ulNow >> 8) & 0xFF;
+    payload[9] = ulNow & 0xFF;
+    QueueReply(HIRCP_PONG, payload);
+}
+
+//****************************************************************************
+//
+//! Adds the one-way latency of a DATA packet when the stamped DATA option
+//! was granted. A stamp of 0 means the controller has not measured the
+//! clocks yet.
+//!
+//! \param pucPayload is the DATA payload
+//! \param ulArrival is when it was read, in microseconds
+//!
+//! \return None
+//
+//****************************************************************************
+static void RecordUplink(unsigned char *pucPayload, unsigned long ulArrival)
+{
+    unsigned long ulStamp;
+    long lLatency;
+
+    if ((g_hircp_options & HIRCP_OPTION_STAMPED_DATA) == 0)
+    {
+        return;
+    }
+
+    ulStamp = ((unsigned long)pucPayload[6] << 24) |
+              ((unsigned long)pucPayload[7] << 16) |
+              ((unsigned long)pucPayload[8] << 8) | pucPayload[9];
+    if (ulStamp == 0)
+    {
+        return;
+    }
+
+    // The difference survives the clock wrapping
+    lLatency = (long)TIMEBASE_ELAPSED(ulArrival, ulStamp);
+    if (g_Uplink.ulCount == 0 || lLatency < g_Uplink.lMin)
+    {
+        g_Uplink.lMin = lLatency;
+    }
+    if (g_Uplink.ulCount == 0 || lLatency > g_Uplink.lMax)
+    {
+        g_Uplink.lMax = lLatency;
+    }
+    g_Uplink.llTotal += lLatency;
+    g_Uplink.ulCount++;
+}
+
+//****************************************************************************
+//
+//! Writes the one-way latency of stamped DATA packets into a STATS payload:
+//! the count as a big-endian 16-bit value, the minimum, average and maximum
+//! as big-endian signed 16-bit values in units of 100 microseconds, and the
+//! average time poses are held before they are applied. Values saturate.
+//!
+//! \param pucPayload receives HIRCP_MAX_PAYLOAD_LEN bytes
+//!
+//! \return None
+//
+//****************************************************************************
+static void PackUplinkStats(unsigned char *pucPayload)
+{
+    struct JitterBufferStats stats;
+    long lField[5];
+    int i;
+
+    GetJitterBufferStats(&stats);
+
+    lField[0] = g_Uplink.ulCount > 0xFFFF ? 0xFFFF : (long)g_Uplink.ulCount;
+    lField[1] = g_Uplink.lMin/100;
+    lField[2] = g_Uplink.ulCount == 0 ? 0 :
+                (long)(g_Uplink.llTotal/(long long)g_Uplink.ulCount)/100;
+    lField[3] = g_Uplink.lMax/100;
+    lField[4] = stats.lLatency/100 > 0xFFFF ? 0xFFFF : stats.lLatency/100;
+    for (i = 1; i < 4; i++)
+    {
+        if (lField[i] > 32767)
+        {
+            lField[i] = 32767;
+        }
+        else if (lField[i] < -32768)
+        {
+            lField[i] = -32768;
+        }
+    }
+
+    for (i = 0; i < 5; i++)
+    {
+        pucPayload[2*i] = (unsigned char)((unsigned long)lField[i] >> 8);
+        pucPayload[2*i + 1] = (unsigned char)lField[i];
+    }
+}
+
+//****************************************************************************
+//
+//! Handles a packet other than DATA
+//!
+//! \param pPacket is a valid packet
+//!
+//! \return true if the connection ends, false otherwise
+//
+//****************************************************************************
+static tBoolean HandlePacket(HIRCP_Packet *pPacket)
+{
+    unsigned char recv_payload[HIRCP_MAX_PAYLOAD_LEN];
+    unsigned char send_payload[HIRCP_MAX_PAYLOAD_LEN];
+
+    HIRCP_GetPayload(pPacket, recv_payload, HIRCP_MAX_PAYLOAD_LEN);
+
+    if (HIRCP_GetType(pPacket) == HIRCP_MODE)
+    {
+        UART_PRINT("Received MODE packet.\n\r");
+        if (recv_payload[0] != HIRCP_NORMAL && recv_payload[0] != HIRCP_CLOSED_LOOP &&
+            recv_payload[0] != HIRCP_HYBRID)
+        {
+            UART_PRINT("Invalid mode.\n\r");
+            //
+            // TODO (Brandon): Send ERR packet
+            //
+            return true;
+        }
+        g_hircp_mode = (HIRCP_Mode)recv_payload[0];
+        PostControlMessage(CONTROL_MODE, recv_payload);
+    }
+    else if (HIRCP_GetType(pPacket) == HIRCP_FSET)
+    {
+        UART_PRINT("Received FSET packet.\n\r");
+        PostControlMessage(CONTROL_FSET, recv_payload);
+    }
+    else if (HIRCP_GetType(pPacket) == HIRCP_STATS)
+    {
+        UART_PRINT("Received STATS packet.\n\r");
+
+        // Replies with the statistics asked for
+        memset(send_payload, 0, HIRCP_MAX_PAYLOAD_LEN);
+        if (recv_payload[0] == HIRCP_STATS_PROFILE)
+        {
+            PackProfileStats(recv_payload[1], send_payload);
+        }
+        else if (recv_payload[0] == HIRCP_STATS_LATENCY)
+        {
+            PackUplinkStats(send_payload);
+        }
+        else
+        {
+            PackJitterBufferStats(send_payload);
+        }
+        QueueReply(HIRCP_STATS, send_payload);
+    }
+    else if (HIRCP_GetType(pPacket) == HIRCP_TRAJ)
+    {
+        // Chunks of an upload are not answered
+        if (HandleTrajectoryCommand(recv_payload, (unsigned char)g_hircp_mode, send_payload))
+        {
+            QueueReply(HIRCP_TRAJ, send_payload);
+        }
+    }
+    else if (HIRCP_GetType(pPacket) == HIRCP_TRQ)
+    {
+        UART_PRINT("Received TRQ packet.\n\r");
+
+        // The ACK must follow every reply already queued
+        FlushReplies();
+        HIRCP_InitiateTerminationSequence();
+        return true;
+    }
+
+    return false;
+}
+
+//****************************************************************************
+//
+//! Returns the number of DATA packets dropped because a newer one was
+//! waiting behind them
+//!
+//! \param None
+//!
+//! \return Count since reset
+//
+//****************************************************************************
+unsigned long GetSkippedPoseCount(void)
+{
+    return g_ulSkippedPoses;
+}
+
+//****************************************************************************
+//
+//! Transmit task entry. Sends queued replies until a send fails, then
+//! drops them until the receive task starts a new connection.
+//!
+//! \param pvParameters is unused
+//!
+//! \return Never returns
+//
+//****************************************************************************
+static void NetworkTxTask(void *pvParameters)
+{
+    struct NetworkTxMessage msg;
+    unsigned char ucFlushed = 0;
+    unsigned long ulBegin;
+    long lRetVal;
+
+    while (TRUE)
+    {
+        if (osi_MsgQRead(&g_TxQueue, &msg, OSI_WAIT_FOREVER) != OSI_OK)
+        {
+            continue;
+        }
+
+        if (msg.ucType == NETWORK_TX_FLUSH)
+        {
+            osi_MsgQWrite(&g_TxFlushedQueue, &ucFlushed, OSI_WAIT_FOREVER);
+        }
+        else if (!g_bTxFailed)
+        {
+            ulBegin = ProfileBegin();
+            lRetVal = BsdTcpServerSend(msg.ucData, HIRCP_MAX_PACKET_LEN);
+            ProfileEnd(PROFILE_SEND, ulBegin);
+            if (lRetVal < 0)
+            {
+                UART_PRINT("ERROR SENDING DATA.\n\r");
+                g_bTxFailed = true;
+            }
+        }
+    }
+}
+
+//****************************************************************************
+//
+//! Builds a reply and queues it for the transmit task
+//!
+//! \param eType is the packet type
+//! \param pucPayload holds HIRCP_MAX_PAYLOAD_LEN bytes
+//!
+//! \return None
+//
+//****************************************************************************
+static void QueueReply(HIRCP_Type eType, unsigned char *pucPayload)
+{
+    struct NetworkTxMessage msg;
+
+    // Configure packet fields and gets packet data to send
+    HIRCP_ClearPacket(g_pSendPacket);
+    HIRCP_SetType(g_pSendPacket, eType);
+    HIRCP_SetPayload(g_pSendPacket, pucPayload, HIRCP_MAX_PAYLOAD_LEN);
+
+    msg.ucType = NETWORK_TX_SEND;
+    HIRCP_GetData(g_pSendPacket, msg.ucData, HIRCP_MAX_PACKET_LEN);
+
+    osi_MsgQWrite(&g_TxQueue, &msg, OSI_WAIT_FOREVER);
+}
+
+//****************************************************************************
+//
+//! Waits until the transmit task has handled every queued reply
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void FlushReplies(void)
+{
+    struct NetworkTxMessage msg;
+    unsigned char ucFlushed;
+
+    msg.ucType = NETWORK_TX_FLUSH;
+    osi_MsgQWrite(&g_TxQueue, &msg, OSI_WAIT_FOREVER);
+    osi_MsgQRead(&g_TxFlushedQueue, &ucFlushed, OSI_WAIT_FOREVER);
+}
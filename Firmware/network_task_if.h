@@ -0,0 +1,55 @@
+#ifndef __NETWORK_TASK_IF_H__
+#define __NETWORK_TASK_IF_H__
+//*****************************************************************************
+//
+// network_task_if.h
+//
+// Header file for the network tasks. The receive task runs the HIRCP server:
+// it accepts connections, reads packets and posts commands to the control
+// task. Replies go through a queue to the transmit task, so a send that
+// blocks holds up neither the hand nor the next receive.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hircp.h"
+
+// Below the control task. Transmit runs above receive so replies go out
+// before the next packet is read.
+#define NETWORK_TX_TASK_PRIORITY    2
+#define NETWORK_RX_TASK_PRIORITY    1
+#define NETWORK_TASK_STACK_SIZE     2048
+
+// Replies that can wait for the transmit task
+#define NETWORK_TX_QUEUE_LEN        4
+
+// Longest the receive task waits for data before checking for a failed send
+#define NETWORK_RX_POLL_MS          100
+
+// A connection that receives nothing for this long is ended. Controllers
+// send a PING at least every 500 ms, so several must be missed.
+#define NETWORK_INACTIVITY_TIMEOUT_MS   3000
+
+//****************************************************************************
+// Creates the transmit queue and both tasks. The receive task connects to
+// the access point once the scheduler starts.
+//****************************************************************************
+void InitNetworkTasks(void);
+
+//****************************************************************************
+// Returns the number of DATA packets dropped unapplied because a newer one
+// had already arrived
+//****************************************************************************
+unsigned long GetSkippedPoseCount(void);
+
+#endif //  __NETWORK_TASK_IF_H__
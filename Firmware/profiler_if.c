@@ -0,0 +1,246 @@
+//*****************************************************************************
+//
+// profiler_if.c
+//
+// Firmware profiler. Times come from the DWT cycle counter of the Cortex-M4,
+// which counts system clock cycles and wraps every ~53 seconds, so a section
+// must be shorter than that. Samples are added with interrupts masked as
+// they come from the tasks, the timer interrupts and the I2C interrupt.
+//
+// The host build has no cycle counter; it reads the monotonic clock instead
+// and converts it to 80 MHz cycles, so the statistics keep the same units.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <string.h>
+#ifdef HOST_BUILD
+#include <time.h>
+#endif
+
+// Driverlib includes
+#include "hw_types.h"
+#include "rom.h"
+#include "rom_map.h"
+#include "interrupt.h"
+
+#include "hircp.h"
+#include "timebase_if.h"
+#include "profiler_if.h"
+
+// Cortex-M4 debug registers that enable and hold the cycle counter
+#define PROFILER_DEMCR              0xE000EDFC
+#define PROFILER_DEMCR_TRCENA       0x01000000
+#define PROFILER_DWT_CTRL           0xE0001000
+#define PROFILER_DWT_CTRL_CYCCNTENA 0x00000001
+#define PROFILER_DWT_CYCCNT         0xE0001004
+
+static struct ProfileStats g_Stats[NUM_PROFILE_SECTIONS];
+
+static void PackSaturated(unsigned long ulValue, unsigned char *pucBytes, int iLen);
+static tBoolean EnterCritical(void);
+static void ExitCritical(tBoolean bWasDisabled);
+
+//****************************************************************************
+//
+//! Starts the cycle counter and clears the statistics
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void InitProfiler(void)
+{
+#ifndef HOST_BUILD
+    HWREG(PROFILER_DEMCR) |= PROFILER_DEMCR_TRCENA;
+    HWREG(PROFILER_DWT_CYCCNT) = 0;
+    HWREG(PROFILER_DWT_CTRL) |= PROFILER_DWT_CTRL_CYCCNTENA;
+#endif
+
+    ResetProfiler();
+}
+
+//****************************************************************************
+//
+//! Clears the statistics of every section
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void ResetProfiler(void)
+{
+    tBoolean bWasDisabled;
+
+    bWasDisabled = EnterCritical();
+    memset(g_Stats, 0, sizeof(g_Stats));
+    ExitCritical(bWasDisabled);
+}
+
+//****************************************************************************
+//
+//! Returns the cycle count at the start of a section
+//!
+//! \param None
+//!
+//! \return cycle count, to be passed to ProfileEnd()
+//
+//****************************************************************************
+unsigned long ProfileBegin(void)
+{
+#ifdef HOST_BUILD
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long)now.tv_sec*TIMEBASE_SYS_CLK +
+           (unsigned long)now.tv_nsec*TIMEBASE_TICKS_PER_US/1000;
+#else
+    return HWREG(PROFILER_DWT_CYCCNT);
+#endif
+}
+
+//****************************************************************************
+//
+//! Adds the cycles since the start of a section to its statistics
+//!
+//! \param eSection is the section timed
+//! \param ulBegin is the value ProfileBegin() returned at its start
+//!
+//! \return None
+//
+//****************************************************************************
+void ProfileEnd(enum Profile_Section eSection, unsigned long ulBegin)
+{
+    struct ProfileStats *pStats = &g_Stats[eSection];
+    unsigned long ulCycles;
+    tBoolean bWasDisabled;
+
+    ulCycles = ProfileBegin() - ulBegin;
+
+    bWasDisabled = EnterCritical();
+    if (pStats->ulCount == 0 || ulCycles < pStats->ulMin)
+    {
+        pStats->ulMin = ulCycles;
+    }
+    if (ulCycles > pStats->ulMax)
+    {
+        pStats->ulMax = ulCycles;
+    }
+    pStats->ullTotal += ulCycles;
+    pStats->ulCount++;
+    ExitCritical(bWasDisabled);
+}
+
+//****************************************************************************
+//
+//! Copies the statistics of a section
+//!
+//! \param eSection is the section
+//! \param pStats receives the statistics
+//!
+//! \return None
+//
+//****************************************************************************
+void GetProfileStats(enum Profile_Section eSection, struct ProfileStats *pStats)
+{
+    tBoolean bWasDisabled;
+
+    bWasDisabled = EnterCritical();
+    memcpy(pStats, &g_Stats[eSection], sizeof(*pStats));
+    ExitCritical(bWasDisabled);
+}
+
+//****************************************************************************
+//
+//! Writes the statistics of a section into a STATS payload
+//!
+//! \param ucSection is the section, as enum Profile_Section
+//! \param pucPayload receives HIRCP_STATS_PAYLOAD_LEN bytes
+//!
+//! \return None
+//
+//****************************************************************************
+void PackProfileStats(unsigned char ucSection, unsigned char *pucPayload)
+{
+    struct ProfileStats stats;
+
+    memset(pucPayload, 0, HIRCP_STATS_PAYLOAD_LEN);
+    pucPayload[0] = ucSection;
+    if (ucSection >= NUM_PROFILE_SECTIONS)
+    {
+        return;
+    }
+
+    GetProfileStats((enum Profile_Section)ucSection, &stats);
+    if (stats.ulCount == 0)
+    {
+        return;
+    }
+
+    PackSaturated(stats.ulCount, &pucPayload[1], 2);
+    PackSaturated(stats.ulMin/PROFILER_UNIT_CYCLES, &pucPayload[3], 2);
+    PackSaturated((unsigned long)(stats.ullTotal/stats.ulCount/PROFILER_UNIT_CYCLES),
+                  &pucPayload[5], 2);
+    PackSaturated(stats.ulMax/PROFILER_UNIT_CYCLES, &pucPayload[7], 3);
+}
+
+//****************************************************************************
+//
+//! Writes a value big-endian, saturated to the bytes given
+//!
+//! \param ulValue is the value
+//! \param pucBytes receives iLen bytes
+//! \param iLen is the width, up to 4 bytes
+//!
+//! \return None
+//
+//****************************************************************************
+static void PackSaturated(unsigned long ulValue, unsigned char *pucBytes, int iLen)
+{
+    unsigned long ulMax = (iLen >= 4) ? 0xFFFFFFFF : (1UL << (iLen*8)) - 1;
+    int i;
+
+    if (ulValue > ulMax)
+    {
+        ulValue = ulMax;
+    }
+
+    for (i = iLen - 1; i >= 0; i--)
+    {
+        pucBytes[i] = (unsigned char)(ulValue & 0xFF);
+        ulValue >>= 8;
+    }
+}
+
+//****************************************************************************
+//
+//! Masks interrupts around updates of the statistics
+//!
+//! \return whether interrupts were already disabled
+//
+//****************************************************************************
+static tBoolean EnterCritical(void)
+{
+    return MAP_IntMasterDisable();
+}
+
+static void ExitCritical(tBoolean bWasDisabled)
+{
+    if (!bWasDisabled)
+    {
+        MAP_IntMasterEnable();
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef __PROFILER_IF_H__
+#define __PROFILER_IF_H__
+//*****************************************************************************
+//
+// profiler_if.h
+//
+// Header file for the firmware profiler. Sections of the receive, control
+// and sensor paths are timed with the Cortex-M4 cycle counter and collected
+// into count, minimum, average and maximum per section, which the controller
+// reads with STATS packets.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Unit of the times in a profile STATS payload, in cycles (0.1 us)
+#define PROFILER_UNIT_CYCLES        8
+
+enum Profile_Section {
+    PROFILE_RECEIVE = 0,        // Reading what the client sent
+    PROFILE_PARSE,              // Checking one received packet
+    PROFILE_SERVO,              // Servo update of one playback or force tick
+    PROFILE_I2C,                // One I2C transaction on the bus
+    PROFILE_ADC,                // One sensor conversion, read queued to stored
+    PROFILE_SEND,               // Sending one reply
+    NUM_PROFILE_SECTIONS
+};
+
+struct ProfileStats {
+    unsigned long ulCount;      // Samples since reset
+    unsigned long ulMin;        // Shortest sample in cycles
+    unsigned long ulMax;        // Longest sample in cycles
+    unsigned long long ullTotal;    // Sum of the samples in cycles
+};
+
+//****************************************************************************
+// Starts the cycle counter and clears the statistics
+//****************************************************************************
+void InitProfiler(void);
+
+//****************************************************************************
+// Clears the statistics of every section
+//****************************************************************************
+void ResetProfiler(void);
+
+//****************************************************************************
+// Returns the cycle count at the start of a section. Safe to call from
+// interrupt context.
+//****************************************************************************
+unsigned long ProfileBegin(void);
+
+//****************************************************************************
+// Adds the cycles since ulBegin to a section. Safe to call from interrupt
+// context.
+//****************************************************************************
+void ProfileEnd(enum Profile_Section eSection, unsigned long ulBegin);
+
+//****************************************************************************
+// Copies the statistics of a section
+//****************************************************************************
+void GetProfileStats(enum Profile_Section eSection, struct ProfileStats *pStats);
+
+//****************************************************************************
+// Writes the statistics of a section into a STATS payload: the section,
+// the sample count as a big-endian 16-bit value, then the minimum and
+// average as big-endian 16-bit values and the maximum as a big-endian 24-bit
+// value, in PROFILER_UNIT_CYCLES. Values saturate. An unknown section is
+// reported with no samples.
+//****************************************************************************
+void PackProfileStats(unsigned char ucSection, unsigned char *pucPayload);
+
+#endif //  __PROFILER_IF_H__
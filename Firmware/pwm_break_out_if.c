@@ -44,21 +44,17 @@
 #include "uart_if.h"
 #endif
 #include "i2c_if.h"
-
-#include "timer.h"
+#include "i2c_queue_if.h"
+#include "timebase_if.h"
 
 #define FAILURE                 -1
 #define SUCCESS                 0
-#define SYS_CLK                 80000000
-#define PRESCALE                255UL
 #define MAXSTEP                 4095
-#define MILLISECONDS_TO_TICKS(ms)   (((SYS_CLK/PRESCALE -1)/1000) * (ms))
 #define DUTYCYCLE_TO_STEPS(percent) (percent*MAXSTEP/100)
 
 /* HELPER FUNCTION */
 static uint8_t read(uint8_t regAddress);
 static int write(uint8_t regAddress, uint8_t data);
-static void delay(int time_ms);
 
 //****************************************************************************
 //
@@ -104,7 +100,7 @@ void setPWMFreq(float freq)
     write(PCA9685_MODE1, newmode); // go to sleep
     write(PCA9685_PRESCALE, prescale); // set the prescaler
     write(PCA9685_MODE1, oldmode);
-    delay(5);
+    Timebase_Delay(5000);
     write(PCA9685_MODE1, oldmode | 0xa1);  // This sets the MODE1 register 
                                             // to turn on auto increment.
     oldmode = read(PCA9685_MODE1);
@@ -121,26 +117,49 @@ void setPWMFreq(float freq)
 //
 //****************************************************************************
 int setPWM_DutyCycle(uint8_t channel, float duty_cycle)
+{
+    uint16_t on;
+    uint16_t off;
+    // channel need to be from 0 to 15
+    if (channel > 15) return FAILURE; 
+    //convert duty cycle to steps
+    convertDutyCycleToOnOff(duty_cycle, &on, &off);
+    return setPWMOnOff(channel, on, off);
+}
+//****************************************************************************
+//
+//! Convert a duty cycle to the start (on) and end (off) ticks of the high
+//! segment of the PWM pulse, as setPWM_DutyCycle() writes them
+//!
+//! \param: 
+//!         duty_cycle: duty cycle of the PWM(in perecentage): from 0 to 100
+//!         on: returns the tick the signal goes high
+//!         off: returns the tick the signal goes low
+//!
+//! \return None
+//
+//****************************************************************************
+void convertDutyCycleToOnOff(float duty_cycle, uint16_t *on, uint16_t *off)
 {
     uint16_t step;
     //convert duty cycle to steps
     step = DUTYCYCLE_TO_STEPS(duty_cycle);
-    // channel need to be from 0 to 15
-    if (channel > 15) return FAILURE; 
     // check special case
     if (step == 4095) 
     {
     // Special value for signal fully on.
-      setPWMOnOff(channel, 4096, 0);
+      *on = 4096;
+      *off = 0;
     }
     else if (step == 0) {
     // Special value for signal fully off.
-      setPWMOnOff(channel, 0, 4096);
+      *on = 0;
+      *off = 4096;
     }
     else {
-      setPWMOnOff(channel, 0, step);
+      *on = 0;
+      *off = step;
     }
-    return SUCCESS;
 }
 //****************************************************************************
 //
@@ -149,6 +168,10 @@ int setPWM_DutyCycle(uint8_t channel, float duty_cycle)
 //! 0..4095 when the signal will turn on, and when it will turn off. Channel 
 //! indicates which of the 16 PWM outputs should be updated with the new values.
 //!
+//! The four registers are written in one queued I2C transaction using the
+//! auto increment mode enabled by setPWMFreq(). Returns without waiting for
+//! the bus.
+//!
 //! /param:
 //! channel: The channel that should be updated with the new values (0..15)
 //! on: The tick (between 0..4095) when the signal transition from low to high
@@ -156,24 +179,24 @@ int setPWM_DutyCycle(uint8_t channel, float duty_cycle)
 //!
 //! \return 0: SUCCESS; >0 Failure
 //****************************************************************************
-void setPWMOnOff(uint8_t channel, uint16_t on, uint16_t off)
+int setPWMOnOff(uint8_t channel, uint16_t on, uint16_t off)
 {
-    uint8_t LSB, MSB;
-    uint8_t regLAddress,regHAddress;
-    //Write to register ON
-    LSB = on & 0xFF; // extract the 8 LSB of variable on
-    MSB = on >> 8; // extract the 8 MSB of variable on
-    regLAddress = LED0_ON_L+4*channel;//get the LOW register of the channel
-    regHAddress = LED0_ON_H+4*channel;//get the HIGH register of the channel
-    write(regLAddress, LSB); //write 8 LSB to LOW register
-    write(regHAddress, MSB); //write 8 MSB to HIGH register
-    //Write to register OFF
-    LSB = off & 0xFF;
-    MSB = off >> 8;
-    regLAddress = LED0_OFF_L+4*channel;//get the L register of the channel
-    regHAddress = LED0_OFF_H+4*channel;//get the H register of the channel
-    write(regLAddress, LSB); //write 8 LSB to L register
-    write(regHAddress, MSB); //write 8 MSB to H register
+    unsigned char DataBuf[5];
+
+    DataBuf[0] = LED0_ON_L+4*channel; //get the first register of the channel
+    DataBuf[1] = on & 0xFF;           // 8 LSB of variable on
+    DataBuf[2] = on >> 8;             // 8 MSB of variable on
+    DataBuf[3] = off & 0xFF;          // 8 LSB of variable off
+    DataBuf[4] = off >> 8;            // 8 MSB of variable off
+
+    if (I2C_Queue_Submit((unsigned char)PWM_ADDRESS, DataBuf, 5, 0, NULL, NULL) != SUCCESS)
+    {
+        #ifdef PWM_DEBUG
+        UART_PRINT("I2C queue full\n\r");
+        #endif
+        return FAILURE;
+    }
+    return SUCCESS;
 }
 //****************************************************************************
 //
@@ -189,17 +212,8 @@ static uint8_t read(uint8_t regAddress)
     unsigned char DataBuf[1];
     //Construct the data buffer
     DataBuf[0] = (unsigned char) regAddress;
-    //Send command to the PWM board
-    iRetVal = I2C_IF_Write((unsigned char)PWM_ADDRESS, DataBuf, 1, 1);
-    if(iRetVal == FAILURE)
-    {
-        #ifdef PWM_DEBUG
-        UART_PRINT("I2C Read failed\n\r");
-        #endif
-        return 0; // TODO: figure out error code, use 0 as temp
-    }
-    //Read the value from the register
-    iRetVal = I2C_IF_Read((unsigned char)PWM_ADDRESS, DataBuf, 1);
+    //Send the register address, then read the value from the register
+    iRetVal = I2C_Queue_Transfer((unsigned char)PWM_ADDRESS, DataBuf, 1, DataBuf, 1);
     if(iRetVal == SUCCESS)
     {
         #ifdef PWM_DEBUG
@@ -234,7 +248,7 @@ static int write(uint8_t regAddress, uint8_t data)
     DataBuf[1] = (unsigned char)data;
 
     // Write the data to the register on the PWM Board
-    iRetVal = I2C_IF_Write((unsigned char)PWM_ADDRESS, DataBuf, 2, 1);
+    iRetVal = I2C_Queue_Transfer((unsigned char)PWM_ADDRESS, DataBuf, 2, NULL, 0);
 
     if(iRetVal == SUCCESS)
     {
@@ -251,39 +265,6 @@ static int write(uint8_t regAddress, uint8_t data)
         return FAILURE;
     }
 }
-//****************************************************************************
-//
-//! The delay function uses timer to implement the delay time in milliseconds
-//!
-//! \param time in millisecond
-//
-//!  \return void
-//****************************************************************************
-static void delay(int time_ms)
-{
-    // Initialize Timer 0B as one-shot down counter.
-    MAP_PRCMPeripheralClkEnable(PRCM_TIMERA0, PRCM_RUN_MODE_CLK);
-    MAP_PRCMPeripheralReset(PRCM_TIMERA0);
-    MAP_TimerConfigure(TIMERA0_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_B_ONE_SHOT);
-    MAP_TimerPrescaleSet(TIMERA0_BASE, TIMER_B, PRESCALE);
-    //Load the value in milisecond
-    MAP_TimerLoadSet(TIMERA0_BASE, TIMER_B, MILLISECONDS_TO_TICKS(time_ms));
-    // Enable the timer
-    MAP_TimerEnable(TIMERA0_BASE, TIMER_B);
-    //Stall during debug
-    MAP_TimerControlStall(TIMERA0_BASE, TIMER_B, 1);
-    // Enable interrupt upon Time-out
-    MAP_TimerIntEnable(TIMERA0_BASE, TIMER_TIMB_TIMEOUT);
-    // Clear Interrupt Flag
-    MAP_TimerIntClear(TIMERA0_BASE, MAP_TimerIntStatus(TIMERA0_BASE, true));
-    //Wait until timer time-out
-    while (MAP_TimerIntStatus(TIMERA0_BASE, true) != TIMER_TIMB_TIMEOUT){}
-    //Disable the timer
-    MAP_TimerDisable(TIMERA0_BASE, TIMER_B);
-    //Disable Interrupt
-    MAP_TimerIntDisable(TIMERA0_BASE, TIMER_TIMB_TIMEOUT);
-    MAP_TimerIntUnregister(TIMERA0_BASE, TIMER_B);
-}
 //*****************************************************************************
 //
 // Copyright (C) 2014 Texas Instruments Incorporated - http://www.ti.com/ 
@@ -44,8 +44,10 @@ void PWM_reset(void);
 void setPWMFreq(float freq);
 //set duty cycle for a specific PWM channel, channel from 0 to 15
 int setPWM_DutyCycle(uint8_t channel, float duty_cycle);
+//convert a duty cycle to the on and off ticks setPWM_DutyCycle() writes
+void convertDutyCycleToOnOff(float duty_cycle, uint16_t *on, uint16_t *off);
 //set the start (on) and end (off) of the high segment of the PWM pulse
-void setPWMOnOff(uint8_t channel, uint16_t on, uint16_t off);
+int setPWMOnOff(uint8_t channel, uint16_t on, uint16_t off);
 
 //******************************************************************************
 //                      EXAMPLE
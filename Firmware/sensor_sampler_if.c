@@ -0,0 +1,311 @@
+//*****************************************************************************
+//
+// sensor_sampler_if.c
+//
+// Background finger-tip sensor sampler. Readings are collected from a
+// periodic timer interrupt and published as a complete snapshot of all five
+// fingers, so that packet handling never waits on an ADC conversion.
+//
+// The ADS1015 breakout channels are pipelined: each tick queues a read of the
+// conversion started on the previous tick and the start of the next one on
+// the I2C queue, then returns. The reading is stored from the I2C completion
+// callback. The index finger is read from the CC3200 ADC FIFO once per sweep.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <string.h>
+
+// Driverlib includes
+#include "hw_types.h"
+#include "hw_ints.h"
+#include "hw_memmap.h"
+#include "rom.h"
+#include "rom_map.h"
+#include "timer.h"
+#include "prcm.h"
+
+// Common interface includes
+#include "common.h"
+#include "timer_if.h"
+#include "i2c_queue_if.h"
+#include "timebase_if.h"
+
+#include "adc_driver_if.h"
+#include "adc_break_out_if.h"
+#include "hircp.h"
+#include "sensor_sampler_if.h"
+#include "servo_driver_search_pressure_if.h"
+#include "profiler_if.h"
+
+#define NUM_BREAKOUT_SENSORS 4
+
+// Order in which the breakout channels are converted
+static const enum Fingertip_Sensor_Type g_eBreakoutSensor[NUM_BREAKOUT_SENSORS] = {
+    SENSOR_FINGER_THUMB,
+    SENSOR_FINGER_MIDDLE,
+    SENSOR_FINGER_RING,
+    SENSOR_FINGER_PINKY
+};
+static const unsigned int g_uiBreakoutChannel[NUM_BREAKOUT_SENSORS] = {
+    FINGER_THUMB_BREAKOUT,
+    FINGER_MIDDLE_BREAKOUT,
+    FINGER_RING_BREAKOUT,
+    FINGER_PINKY_BREAKOUT
+};
+
+// Front buffer is g_Snapshot[g_ulPublished & 1], the interrupt handler fills
+// the other one and publishes it by incrementing g_ulPublished
+static struct SensorSnapshot g_Snapshot[2];
+static volatile unsigned long g_ulPublished = 0;
+
+static unsigned char g_ucBreakoutSlot = 0;
+static tBoolean g_bConversionPending = false;
+static volatile unsigned char g_ucTransfersInFlight = 0;
+
+// Cycle count when the pending conversion read was queued
+static unsigned long g_ulReadBegin;
+
+static void SensorSamplerIntHandler(void);
+static void ConversionStarted(int iStatus, unsigned char *pucRdData,
+                              unsigned char ucRdLen, void *pvArg);
+static void ConversionRead(int iStatus, unsigned char *pucRdData,
+                           unsigned char ucRdLen, void *pvArg);
+
+//****************************************************************************
+//
+//! Starts sampling the finger-tip sensors in the background. The timebase,
+//! InitSensorADC() and the I2C queue must be initialized first.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void InitSensorSampler(void)
+{
+    memset(g_Snapshot, 0, sizeof(g_Snapshot));
+    g_ulPublished = 0;
+    g_ucBreakoutSlot = 0;
+    g_bConversionPending = false;
+    g_ucTransfersInFlight = 0;
+
+    Timer_IF_Init(SENSOR_SAMPLER_TIMER_PRCM, SENSOR_SAMPLER_TIMER_BASE,
+                  TIMER_CFG_PERIODIC, SENSOR_SAMPLER_TIMER, 0);
+    Timer_IF_IntSetup(SENSOR_SAMPLER_TIMER_BASE, SENSOR_SAMPLER_TIMER,
+                      SensorSamplerIntHandler);
+    Timer_IF_Start(SENSOR_SAMPLER_TIMER_BASE, SENSOR_SAMPLER_TIMER,
+                   SENSOR_SAMPLER_PERIOD_MS);
+}
+
+//****************************************************************************
+//
+//! Stops background sampling. The last snapshot remains available.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void StopSensorSampler(void)
+{
+    Timer_IF_Stop(SENSOR_SAMPLER_TIMER_BASE, SENSOR_SAMPLER_TIMER);
+    Timer_IF_DeInit(SENSOR_SAMPLER_TIMER_BASE, SENSOR_SAMPLER_TIMER);
+}
+
+//****************************************************************************
+//
+//! Copies the most recently published snapshot. Never waits on the ADCs;
+//! the copy is retried if a new snapshot is published while it is taken.
+//!
+//! \param pSnapshot receives the snapshot
+//!
+//! \return None
+//
+//****************************************************************************
+void GetSensorSnapshot(struct SensorSnapshot *pSnapshot)
+{
+    unsigned long ulPublished;
+
+    do
+    {
+        ulPublished = g_ulPublished;
+        memcpy(pSnapshot, &g_Snapshot[ulPublished & 1], sizeof(*pSnapshot));
+    } while (ulPublished != g_ulPublished);
+}
+
+//****************************************************************************
+//
+//! Writes the most recently published snapshot into a DACK payload as
+//! big-endian 16-bit readings, one per finger
+//!
+//! \param pucPayload receives NUM_SENSORS*2 bytes
+//!
+//! \return None
+//
+//****************************************************************************
+void PackSensorSnapshot(unsigned char *pucPayload)
+{
+    struct SensorSnapshot snapshot;
+    int i;
+
+    GetSensorSnapshot(&snapshot);
+    for (i = 0; i < NUM_SENSORS; i++)
+    {
+        UnsignedShort_to_UnsignedChar(snapshot.usReading[i], &pucPayload[i*2], &pucPayload[i*2+1]);
+    }
+}
+
+//****************************************************************************
+//
+//! Writes the most recently published snapshot into a timed DACK payload.
+//! Readings are saturated to 12 bits and packed two per three bytes, thumb
+//! first; the age saturates at 65535 units.
+//!
+//! \param pucPayload receives HIRCP_DACK_PAYLOAD_LEN bytes
+//!
+//! \return None
+//
+//****************************************************************************
+void PackTimedSensorSnapshot(unsigned char *pucPayload)
+{
+    struct SensorSnapshot snapshot;
+    unsigned short usReading;
+    unsigned long ulAge;
+    unsigned char *pucPair;
+    int i;
+
+    GetSensorSnapshot(&snapshot);
+    ulAge = (Timebase_GetMicros() - snapshot.ulTimestamp)/SENSOR_AGE_UNIT_US;
+
+    memset(pucPayload, 0, HIRCP_DACK_PAYLOAD_LEN);
+    for (i = 0; i < NUM_SENSORS; i++)
+    {
+        usReading = snapshot.usReading[i] > 0xFFF ? 0xFFF : snapshot.usReading[i];
+        pucPair = &pucPayload[(i/2)*3];
+        if (i % 2 == 0)
+        {
+            pucPair[0] = (unsigned char)(usReading >> 4);
+            pucPair[1] = (unsigned char)((usReading & 0xF) << 4);
+        }
+        else
+        {
+            pucPair[1] |= (unsigned char)(usReading >> 8);
+            pucPair[2] = (unsigned char)(usReading & 0xFF);
+        }
+    }
+
+    UnsignedShort_to_UnsignedChar(ulAge > 0xFFFF ? 0xFFFF : (unsigned short)ulAge,
+                                  &pucPayload[8], &pucPayload[9]);
+}
+
+//****************************************************************************
+//
+//! Sampler tick. Queues a read of the pending breakout conversion and the
+//! start of the next one. Returns without waiting for the bus.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void SensorSamplerIntHandler(void)
+{
+    Timer_IF_InterruptClear(SENSOR_SAMPLER_TIMER_BASE);
+
+    // The transfers queued on the previous tick are still waiting for the bus
+    if (g_ucTransfersInFlight != 0)
+    {
+        return;
+    }
+
+    if (g_bConversionPending)
+    {
+        g_bConversionPending = false;
+        g_ulReadBegin = ProfileBegin();
+        if (readADCResultAsync_Breakout(ConversionRead,
+                (void *)(unsigned long)g_ucBreakoutSlot) == SUCCESS)
+        {
+            g_ucTransfersInFlight++;
+        }
+        g_ucBreakoutSlot = (g_ucBreakoutSlot + 1) % NUM_BREAKOUT_SENSORS;
+    }
+
+    if (startADCAsync_Breakout(g_uiBreakoutChannel[g_ucBreakoutSlot],
+                               ConversionStarted, NULL) == SUCCESS)
+    {
+        g_ucTransfersInFlight++;
+    }
+}
+
+//****************************************************************************
+//
+//! I2C completion of a conversion start
+//!
+//! \param iStatus is SUCCESS if the config register was written
+//!
+//! \return None
+//
+//****************************************************************************
+static void ConversionStarted(int iStatus, unsigned char *pucRdData,
+                              unsigned char ucRdLen, void *pvArg)
+{
+    g_bConversionPending = (iStatus == SUCCESS);
+    g_ucTransfersInFlight--;
+}
+
+//****************************************************************************
+//
+//! I2C completion of a conversion read. Stores the reading into the back
+//! buffer and publishes it once every breakout channel has been read.
+//!
+//! \param iStatus is SUCCESS if the conversion register was read
+//! \param pucRdData holds the conversion register
+//! \param pvArg is the breakout slot the conversion was started for
+//!
+//! \return None
+//
+//****************************************************************************
+static void ConversionRead(int iStatus, unsigned char *pucRdData,
+                           unsigned char ucRdLen, void *pvArg)
+{
+    unsigned char ucSlot = (unsigned char)(unsigned long)pvArg;
+    struct SensorSnapshot *pBack;
+    unsigned long ulPublished;
+    unsigned short usIndexReading;
+
+    g_ucTransfersInFlight--;
+
+    ulPublished = g_ulPublished;
+    pBack = &g_Snapshot[(ulPublished + 1) & 1];
+
+    if (iStatus == SUCCESS)
+    {
+        pBack->usReading[g_eBreakoutSensor[ucSlot]] = convertADCResult_Breakout(pucRdData);
+    }
+
+    if (ucSlot == NUM_BREAKOUT_SENSORS - 1)
+    {
+        // Keep the previous index reading if the FIFO has not refilled
+        usIndexReading = g_Snapshot[ulPublished & 1].usReading[SENSOR_FINGER_INDEX];
+        PollSensorReading_CC3200(SENSOR_FINGER_INDEX, &usIndexReading);
+        pBack->usReading[SENSOR_FINGER_INDEX] = usIndexReading;
+
+        pBack->ulSequence = ulPublished + 1;
+        pBack->ulTimestamp = Timebase_GetMicros();
+        g_ulPublished = ulPublished + 1;
+    }
+
+    ProfileEnd(PROFILE_ADC, g_ulReadBegin);
+}
@@ -0,0 +1,77 @@
+#ifndef __SENSOR_SAMPLER_IF_H__
+#define __SENSOR_SAMPLER_IF_H__
+//*****************************************************************************
+//
+// sensor_sampler_if.h
+//
+// Header file for the background finger-tip sensor sampler. A timer interrupt
+// walks the sensors at a fixed rate and publishes complete readings into a
+// double-buffered snapshot that packet handling can copy without waiting on
+// the ADCs.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "adc_driver_if.h"
+
+// Timer used to pace the sampler. It is set up as one full-width timer, which
+// takes all of TIMERA1, so the sampler cannot run alongside the GPT PWM path
+// in servo_driver.c: InitPWMModules() splits TIMERA1 to drive two servos.
+// Only the PCA9685 breakout board can drive the servos meanwhile.
+#define SENSOR_SAMPLER_TIMER_PRCM   PRCM_TIMERA1
+#define SENSOR_SAMPLER_TIMER_BASE   TIMERA1_BASE
+#define SENSOR_SAMPLER_TIMER        TIMER_A
+
+// Sampler tick in milliseconds. Must not be shorter than
+// ADS1015_CONVERSIONDELAY, since each tick collects the conversion started on
+// the previous one. A full snapshot takes one tick per breakout channel.
+#define SENSOR_SAMPLER_PERIOD_MS    1
+
+// Unit of the snapshot age in a timed DACK payload
+#define SENSOR_AGE_UNIT_US          100
+
+struct SensorSnapshot {
+    unsigned short usReading[NUM_SENSORS];  // Raw ADC value per finger
+    unsigned long ulSequence;               // Incremented on every publish
+    unsigned long ulTimestamp;              // Timebase_GetMicros() at publish
+};
+
+//****************************************************************************
+// Starts sampling the finger-tip sensors in the background
+//****************************************************************************
+void InitSensorSampler(void);
+
+//****************************************************************************
+// Stops background sampling
+//****************************************************************************
+void StopSensorSampler(void);
+
+//****************************************************************************
+// Copies the most recently published snapshot
+//****************************************************************************
+void GetSensorSnapshot(struct SensorSnapshot *pSnapshot);
+
+//****************************************************************************
+// Writes the most recently published snapshot into a DACK payload as
+// big-endian 16-bit readings, one per finger
+//****************************************************************************
+void PackSensorSnapshot(unsigned char *pucPayload);
+
+//****************************************************************************
+// Writes the most recently published snapshot into a timed DACK payload:
+// 12-bit readings packed big-endian into the first 8 bytes, then the age of
+// the snapshot in SENSOR_AGE_UNIT_US as a big-endian 16-bit value
+//****************************************************************************
+void PackTimedSensorSnapshot(unsigned char *pucPayload);
+
+#endif //  __SENSOR_SAMPLER_IF_H__
@@ -35,7 +35,9 @@ void SetupTimerPWMMode(unsigned long ulBase, unsigned long ulTimer,
                        unsigned long ulConfig, unsigned char ucInvert);
 
 //*****************************************************************************
-// Sets up the identified timers as PWM to drive the peripherals
+// Sets up the identified timers as PWM to drive the peripherals. TIMERA1 to
+// TIMERA3 are split for this, so it cannot be used together with the sensor
+// sampler, the force controller or the jitter buffer, which take them whole.
 //*****************************************************************************
 void InitPWMModules();
 
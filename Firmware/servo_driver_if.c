@@ -36,6 +36,59 @@
 // Low-level Servo driver include
 #include "servo_driver.h"
 
+// Motion profile positions and velocities are fixed point with
+// SERVO_MOTION_SHIFT fractional bits, as the profiles step in an interrupt
+// and the Cortex-M4 here has no FPU
+#define SERVO_MOTION_SHIFT          8
+#define SERVO_MOTION_ONE            (1 << SERVO_MOTION_SHIFT)
+
+// Largest limits SetServoMotionLimits() takes, which keep the squared speeds
+// of a full-range move within 32 bits
+#define SERVO_MOTION_MAX_VELOCITY   4000
+#define SERVO_MOTION_MAX_ACCEL      32000
+
+// Motion profile of a joint, in degrees as given to MoveServo_PWM_Breakout()
+struct ServoMotion {
+    long lPosition;             // degrees, fixed point
+    long lVelocity;             // degrees/s, fixed point, signed
+    unsigned long ulMaxVelocity;// degrees/s
+    unsigned long ulMaxAccel;   // degrees/s^2
+    unsigned char ucTarget;
+    unsigned char ucCeiling;    // Highest position allowed, SERVO_NO_CEILING for none
+};
+
+static struct ServoMotion g_ServoMotion[NUM_SERVOS] = {
+    { 0, 0, FINGER_MAX_VELOCITY, FINGER_MAX_ACCEL, 0, SERVO_NO_CEILING },
+    { 0, 0, FINGER_MAX_VELOCITY, FINGER_MAX_ACCEL, 0, SERVO_NO_CEILING },
+    { 0, 0, FINGER_MAX_VELOCITY, FINGER_MAX_ACCEL, 0, SERVO_NO_CEILING },
+    { 0, 0, FINGER_MAX_VELOCITY, FINGER_MAX_ACCEL, 0, SERVO_NO_CEILING },
+    { 0, 0, FINGER_MAX_VELOCITY, FINGER_MAX_ACCEL, 0, SERVO_NO_CEILING },
+    { 0, 0, WRIST_MAX_VELOCITY, WRIST_MAX_ACCEL, 0, SERVO_NO_CEILING }
+};
+
+// Position last given to MoveServo_PWM_Breakout() for each joint
+static unsigned char g_ucServoPosition[NUM_SERVOS];
+
+// PWM Breakout Board channel of each joint
+static const uint8_t g_ucServoChannel[NUM_SERVOS] = {
+    FINGER_THUMB_MAPPING,
+    FINGER_INDEX_MAPPING,
+    FINGER_MIDDLE_MAPPING,
+    FINGER_RING_MAPPING,
+    FINGER_PINKY_MAPPING,
+    FINGER_WRIST_MAPPING
+};
+
+// PCA9685 ON/OFF ticks of a joint's channel for one input position
+struct ServoSteps {
+    uint16_t usOn;
+    uint16_t usOff;
+};
+
+// Limit check, calibration and duty cycle conversion of every input position,
+// done once so a servo update is a table load
+static struct ServoSteps g_ServoSteps[NUM_SERVOS][SERVO_STEP_TABLE_LEN];
+
 //****************************************************************************
 //
 // Initializes the Servo motors for operation
@@ -61,8 +114,39 @@ void InitServos()
 //****************************************************************************
 void InitServos_PWM_Breakout()
 {
+    InitServoTables_PWM_Breakout();
     PWM_reset();
-    setPWMFreq(50);			// Set the frequency of the PWM output to  50Hz (20ms) for servo
+    setPWMFreq(SERVO_PWM_FREQ_HZ);	// Set the frequency of the PWM output to  50Hz (20ms) for servo
+}
+
+//****************************************************************************
+//
+// Builds the per-joint tables of PCA9685 ON/OFF ticks. Each entry is what
+// CheckDegreeAgainstLimit(), Convert_Degrees_To_DutyCycle_PWM_Breakout() and
+// setPWM_DutyCycle() produce for that input position.
+//
+// \param none
+//
+// \return None.
+//
+//****************************************************************************
+void InitServoTables_PWM_Breakout(void)
+{
+    unsigned char ucDegrees;
+    float pwm_duty_cycle;
+    int i;
+    int j;
+
+    for (i = 0; i < NUM_SERVOS; i++)
+    {
+        for (j = 0; j < SERVO_STEP_TABLE_LEN; j++)
+        {
+            ucDegrees = (unsigned char)j;
+            CheckDegreeAgainstLimit(&ucDegrees, (enum Servo_Joint_Type)i);
+            pwm_duty_cycle = Convert_Degrees_To_DutyCycle_PWM_Breakout(ucDegrees, (enum Servo_Joint_Type)i);
+            convertDutyCycleToOnOff(pwm_duty_cycle, &g_ServoSteps[i][j].usOn, &g_ServoSteps[i][j].usOff);
+        }
+    }
 }
 
 //****************************************************************************
@@ -296,38 +380,19 @@ void MoveServo(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint)
 //****************************************************************************
 void MoveServo_PWM_Breakout(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint)
 {
-	float pwm_duty_cycle;
+    const struct ServoSteps *pSteps;
 
-    // Checks the input Degrees against the limits specified for the Servo of the joint
-    CheckDegreeAgainstLimit(&ucDegrees, eServoJoint);
+    if ((unsigned int)eServoJoint >= NUM_SERVOS)
+    {
+        //UART_PRINT("[MoveServo] Invalid Finger input\n");
+        return;
+    }
 
-    // Converts the degrees specified to the appropriate duty cycle percentage
-    pwm_duty_cycle = Convert_Degrees_To_DutyCycle_PWM_Breakout(ucDegrees, eServoJoint);
+    g_ucServoPosition[eServoJoint] = ucDegrees;
 
-    // Updates the proper timer (PWM) module
-    switch(eServoJoint) {
-        case SERVO_FINGER_THUMB:
-        	setPWM_DutyCycle(FINGER_THUMB_MAPPING, pwm_duty_cycle);
-            break;
-        case SERVO_FINGER_INDEX:
-        	setPWM_DutyCycle(FINGER_INDEX_MAPPING, pwm_duty_cycle);
-            break;
-        case SERVO_FINGER_MIDDLE:
-        	setPWM_DutyCycle(FINGER_MIDDLE_MAPPING, pwm_duty_cycle);
-            break;
-        case SERVO_FINGER_RING:
-        	setPWM_DutyCycle(FINGER_RING_MAPPING, pwm_duty_cycle);
-            break;
-        case SERVO_FINGER_PINKY:
-        	setPWM_DutyCycle(FINGER_PINKY_MAPPING, pwm_duty_cycle);
-            break;
-        case SERVO_WRIST:
-        	setPWM_DutyCycle(FINGER_WRIST_MAPPING, pwm_duty_cycle);
-            break;
-        default:
-            //UART_PRINT("[MoveServo] Invalid Finger input\n");
-        	return;
-    }
+    // Limit check and duty cycle conversion were done by InitServoTables_PWM_Breakout()
+    pSteps = &g_ServoSteps[eServoJoint][ucDegrees];
+    setPWMOnOff(g_ucServoChannel[eServoJoint], pSteps->usOn, pSteps->usOff);
 }
 
 //****************************************************************************
@@ -352,3 +417,283 @@ unsigned char GetFingerPositionLimit(enum Servo_Joint_Type eServoJoint)
 			return 0;
 	}
 }
+
+//****************************************************************************
+//
+// Gets the PCA9685 ON/OFF ticks MoveServo_PWM_Breakout() writes for a position
+//
+// \param ucDegrees -> same units as MoveServo_PWM_Breakout()
+// \param eServoJoint -> Servo Joint type (ex: finger_thumb, finger_index, etc)
+// \param pusOn -> returns the tick the pulse goes high
+// \param pusOff -> returns the tick the pulse goes low
+//
+// \return None. Both ticks are 0 for an invalid joint
+//
+//****************************************************************************
+void GetServoSteps_PWM_Breakout(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint,
+                                unsigned short *pusOn, unsigned short *pusOff)
+{
+    if ((unsigned int)eServoJoint >= NUM_SERVOS)
+    {
+        *pusOn = 0;
+        *pusOff = 0;
+        return;
+    }
+
+    *pusOn = g_ServoSteps[eServoJoint][ucDegrees].usOn;
+    *pusOff = g_ServoSteps[eServoJoint][ucDegrees].usOff;
+}
+
+//****************************************************************************
+//
+// Gets the position last written to the servo of a joint
+//
+// \param eServoJoint -> Servo Joint type (ex: finger_thumb, finger_index, etc)
+//
+// \return Degrees as last given to MoveServo_PWM_Breakout()
+//
+//****************************************************************************
+unsigned char GetServoPosition_PWM_Breakout(enum Servo_Joint_Type eServoJoint)
+{
+    if ((unsigned int)eServoJoint >= NUM_SERVOS)
+    {
+        return 0;
+    }
+
+    return g_ucServoPosition[eServoJoint];
+}
+
+//****************************************************************************
+//
+// Sets the position a joint moves to. The joint gets there along a
+// trapezoidal profile as StepServoMotion_PWM_Breakout() is called, so a new
+// target never steps the servo.
+//
+// \param ucDegrees -> same units as MoveServo_PWM_Breakout()
+// \param eServoJoint -> Servo Joint type (ex: finger_thumb, finger_index, etc)
+//
+// \return None.
+//
+//****************************************************************************
+void SetServoTarget_PWM_Breakout(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint)
+{
+    if ((unsigned int)eServoJoint < NUM_SERVOS)
+    {
+        g_ServoMotion[eServoJoint].ucTarget = ucDegrees;
+    }
+}
+
+//****************************************************************************
+//
+// Integer square root, rounded down
+//
+// \param ulValue -> number to take the root of
+//
+// \return The largest root whose square is at most ulValue
+//
+//****************************************************************************
+static unsigned long SquareRoot(unsigned long ulValue)
+{
+    unsigned long ulRoot = 0;
+    unsigned long ulBit = 1UL << 30;
+
+    while (ulBit > ulValue)
+    {
+        ulBit >>= 2;
+    }
+    while (ulBit != 0)
+    {
+        if (ulValue >= ulRoot + ulBit)
+        {
+            ulValue -= ulRoot + ulBit;
+            ulRoot = (ulRoot >> 1) + ulBit;
+        }
+        else
+        {
+            ulRoot >>= 1;
+        }
+        ulBit >>= 2;
+    }
+
+    return ulRoot;
+}
+
+//****************************************************************************
+//
+// Advances every joint along its motion profile. Each joint accelerates
+// towards its target, or its ceiling if that is lower, up to its velocity
+// limit, and slows down in time to stop on it; a target that moves mid-way
+// is followed from the current velocity. Servos are only written when their
+// whole-degree position changes. Runs in interrupt context, so all of it is
+// integer arithmetic.
+//
+// \param ulPeriodMs -> time since the previous call, in milliseconds
+//
+// \return None.
+//
+//****************************************************************************
+void StepServoMotion_PWM_Breakout(unsigned long ulPeriodMs)
+{
+    struct ServoMotion *pMotion;
+    long lTarget;
+    long lDistance;
+    unsigned long ulDistance;
+    unsigned long ulSquared;
+    long lDesired;
+    long lDeltaV;
+    long lMaxDeltaV;
+    unsigned char ucTarget;
+    unsigned char ucDegrees;
+    int i;
+
+    for (i = 0; i < NUM_SERVOS; i++)
+    {
+        pMotion = &g_ServoMotion[i];
+        ucTarget = pMotion->ucTarget;
+        if (ucTarget > pMotion->ucCeiling)
+        {
+            ucTarget = pMotion->ucCeiling;
+        }
+        lTarget = (long)ucTarget << SERVO_MOTION_SHIFT;
+        lDistance = lTarget - pMotion->lPosition;
+        ulDistance = (unsigned long)(lDistance < 0 ? -lDistance : lDistance);
+        lMaxDeltaV = (long)((pMotion->ulMaxAccel*ulPeriodMs << SERVO_MOTION_SHIFT)/1000);
+
+        if (ulDistance < SERVO_MOTION_ONE/2 &&
+            (pMotion->lVelocity < 0 ? -pMotion->lVelocity : pMotion->lVelocity) <= lMaxDeltaV)
+        {
+            // Close enough to stop on the target this step
+            pMotion->lPosition = lTarget;
+            pMotion->lVelocity = 0;
+        }
+        else
+        {
+            // Fastest speed from which the joint can still stop on the
+            // target, v^2 = 2*a*d. Past the stopping distance of the
+            // velocity limit, that is the limit itself.
+            ulSquared = 2*pMotion->ulMaxAccel*ulDistance;
+            if (ulSquared >= (pMotion->ulMaxVelocity*pMotion->ulMaxVelocity << SERVO_MOTION_SHIFT))
+            {
+                lDesired = (long)(pMotion->ulMaxVelocity << SERVO_MOTION_SHIFT);
+            }
+            else
+            {
+                lDesired = (long)(SquareRoot(ulSquared) << SERVO_MOTION_SHIFT/2);
+            }
+            if (lDistance < 0)
+            {
+                lDesired = -lDesired;
+            }
+
+            lDeltaV = lDesired - pMotion->lVelocity;
+            if (lDeltaV > lMaxDeltaV)
+            {
+                lDeltaV = lMaxDeltaV;
+            }
+            else if (lDeltaV < -lMaxDeltaV)
+            {
+                lDeltaV = -lMaxDeltaV;
+            }
+            pMotion->lVelocity += lDeltaV;
+            pMotion->lPosition += pMotion->lVelocity*(long)ulPeriodMs/1000;
+
+            // Stepped onto or past the target
+            if ((lDistance > 0 && pMotion->lPosition >= lTarget) ||
+                (lDistance < 0 && pMotion->lPosition <= lTarget))
+            {
+                pMotion->lPosition = lTarget;
+                pMotion->lVelocity = 0;
+            }
+        }
+
+        ucDegrees = (unsigned char)((pMotion->lPosition + SERVO_MOTION_ONE/2) >> SERVO_MOTION_SHIFT);
+        if (ucDegrees != g_ucServoPosition[i])
+        {
+            MoveServo_PWM_Breakout(ucDegrees, (enum Servo_Joint_Type)i);
+        }
+    }
+}
+
+//****************************************************************************
+//
+// Stops every joint where its servo was last moved to, with its target
+// there and no ceiling, so the profiles pick up from where other code left
+// the servos
+//
+// \param None
+//
+// \return None.
+//
+//****************************************************************************
+void ResetServoMotion_PWM_Breakout(void)
+{
+    int i;
+
+    for (i = 0; i < NUM_SERVOS; i++)
+    {
+        g_ServoMotion[i].lPosition = (long)g_ucServoPosition[i] << SERVO_MOTION_SHIFT;
+        g_ServoMotion[i].lVelocity = 0;
+        g_ServoMotion[i].ucTarget = g_ucServoPosition[i];
+        g_ServoMotion[i].ucCeiling = SERVO_NO_CEILING;
+    }
+}
+
+//****************************************************************************
+//
+// Caps the position of a joint. A joint above its new ceiling is stopped
+// and moved down to it at once, without going through its motion profile;
+// targets above the ceiling are followed only up to it until the ceiling is
+// raised again.
+//
+// \param ucDegrees -> same units as MoveServo_PWM_Breakout(), or
+//                     SERVO_NO_CEILING to remove the cap
+// \param eServoJoint -> Servo Joint type (ex: finger_thumb, finger_index, etc)
+//
+// \return None.
+//
+//****************************************************************************
+void SetServoCeiling_PWM_Breakout(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint)
+{
+    struct ServoMotion *pMotion;
+
+    if ((unsigned int)eServoJoint >= NUM_SERVOS)
+    {
+        return;
+    }
+
+    pMotion = &g_ServoMotion[eServoJoint];
+    pMotion->ucCeiling = ucDegrees;
+
+    if (pMotion->lPosition > ((long)ucDegrees << SERVO_MOTION_SHIFT))
+    {
+        pMotion->lPosition = (long)ucDegrees << SERVO_MOTION_SHIFT;
+        pMotion->lVelocity = 0;
+    }
+    if (g_ucServoPosition[eServoJoint] > ucDegrees)
+    {
+        MoveServo_PWM_Breakout(ucDegrees, eServoJoint);
+    }
+}
+
+//****************************************************************************
+//
+// Sets the limits of a joint's motion profile. Limits of zero, or above
+// SERVO_MOTION_MAX_VELOCITY and SERVO_MOTION_MAX_ACCEL, are ignored.
+//
+// \param eServoJoint -> Servo Joint type (ex: finger_thumb, finger_index, etc)
+// \param ulMaxVelocity -> degrees per second
+// \param ulMaxAccel -> degrees per second squared
+//
+// \return None.
+//
+//****************************************************************************
+void SetServoMotionLimits(enum Servo_Joint_Type eServoJoint, unsigned long ulMaxVelocity, unsigned long ulMaxAccel)
+{
+    if ((unsigned int)eServoJoint < NUM_SERVOS &&
+        ulMaxVelocity > 0 && ulMaxVelocity <= SERVO_MOTION_MAX_VELOCITY &&
+        ulMaxAccel > 0 && ulMaxAccel <= SERVO_MOTION_MAX_ACCEL)
+    {
+        g_ServoMotion[eServoJoint].ulMaxVelocity = ulMaxVelocity;
+        g_ServoMotion[eServoJoint].ulMaxAccel = ulMaxAccel;
+    }
+}
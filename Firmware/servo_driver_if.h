@@ -26,6 +26,10 @@
 // Define number of fingers
 #define NUM_FINGERS 5
 
+// PWM frequency of the breakout board, one servo pulse per period
+#define SERVO_PWM_FREQ_HZ 50
+#define SERVO_PWM_PERIOD_MS (1000/SERVO_PWM_FREQ_HZ)
+
 // Defines mapping on PWM Breakout Board
 #define FINGER_THUMB_MAPPING 0
 #define FINGER_INDEX_MAPPING 1
@@ -34,6 +38,12 @@
 #define FINGER_PINKY_MAPPING 4
 #define FINGER_WRIST_MAPPING 5
 
+// One lookup table entry per possible input position (0 to 255)
+#define SERVO_STEP_TABLE_LEN 256
+
+// Ceiling of a joint that is not capped
+#define SERVO_NO_CEILING 0xFF
+
 // Define the PWM Duty Cycle for degrees for HS311 Servo
 #define HS311_MAX_DEG_LIMIT 180									// 180 max
 #define HS311_PERIOD 20											// 20ms period
@@ -73,6 +83,12 @@
 // Define min position for all servos
 #define FINGER_MINIMUM_POS_LIMIT 30		// Anything below x degrees is interpreted as 0.
 
+// Motion profile limits, in degrees per second and degrees per second squared
+#define FINGER_MAX_VELOCITY 375		// HK15298B, 0.16s per 60 degrees
+#define FINGER_MAX_ACCEL 3750			// Full speed in 0.1s
+#define WRIST_MAX_VELOCITY 315			// HS311, 0.19s per 60 degrees
+#define WRIST_MAX_ACCEL 3150			// Full speed in 0.1s
+
 // Scaling for each finger
 #define FINGER_THUMB_SCALE HK15298B_MAX_DEG_LIMIT/(FINGER_THUMB_POS_LIMIT-FINGER_MINIMUM_POS_LIMIT)
 #define FINGER_INDEX_SCALE HK15298B_MAX_DEG_LIMIT/(FINGER_INDEX_POS_LIMIT-FINGER_MINIMUM_POS_LIMIT)
@@ -97,11 +113,27 @@ enum Servo_Joint_Type {
 void InitServos();
 
 //****************************************************************************
-// Initializes the Servo motors for operation
+// Initializes the Servo motors for operation and builds the lookup tables
+// used by MoveServo_PWM_Breakout()
 // Uses PWM Breakout Board
 //****************************************************************************
 void InitServos_PWM_Breakout();
 
+//****************************************************************************
+// Builds the per-joint tables of PCA9685 ON/OFF ticks for every input
+// position. Called by InitServos_PWM_Breakout().
+// Uses PWM Breakout Board
+//****************************************************************************
+void InitServoTables_PWM_Breakout(void);
+
+//****************************************************************************
+// Gets the PCA9685 ON/OFF ticks MoveServo_PWM_Breakout() writes for a
+// position, from the lookup tables
+// Uses PWM Breakout Board
+//****************************************************************************
+void GetServoSteps_PWM_Breakout(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint,
+                                unsigned short *pusOn, unsigned short *pusOff);
+
 //****************************************************************************
 // Disables the Servo motors
 //****************************************************************************
@@ -142,4 +174,44 @@ void MoveServo_PWM_Breakout(unsigned char ucDegrees, enum Servo_Joint_Type eServ
 //****************************************************************************
 unsigned char GetFingerPositionLimit(enum Servo_Joint_Type eServoJoint);
 
+//****************************************************************************
+// Gets the position last written to the servo of a joint
+// Uses PWM Breakout Board
+//****************************************************************************
+unsigned char GetServoPosition_PWM_Breakout(enum Servo_Joint_Type eServoJoint);
+
+//****************************************************************************
+// Sets the position a joint moves to, within its velocity and acceleration
+// limits, as StepServoMotion_PWM_Breakout() is called
+// Uses PWM Breakout Board
+//****************************************************************************
+void SetServoTarget_PWM_Breakout(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint);
+
+//****************************************************************************
+// Advances every joint along its motion profile by ulPeriodMs and moves the
+// servos that changed position. Call at a fixed rate.
+// Uses PWM Breakout Board
+//****************************************************************************
+void StepServoMotion_PWM_Breakout(unsigned long ulPeriodMs);
+
+//****************************************************************************
+// Stops every joint where its servo was last moved to, with its target there
+// and no ceiling
+// Uses PWM Breakout Board
+//****************************************************************************
+void ResetServoMotion_PWM_Breakout(void);
+
+//****************************************************************************
+// Caps the position of a joint, moving it down to the ceiling at once if it
+// is above. SERVO_NO_CEILING removes the cap.
+// Uses PWM Breakout Board
+//****************************************************************************
+void SetServoCeiling_PWM_Breakout(unsigned char ucDegrees, enum Servo_Joint_Type eServoJoint);
+
+//****************************************************************************
+// Sets the velocity (degrees/s) and acceleration (degrees/s^2) limits of a
+// joint's motion profile
+//****************************************************************************
+void SetServoMotionLimits(enum Servo_Joint_Type eServoJoint, unsigned long ulMaxVelocity, unsigned long ulMaxAccel);
+
 #endif //  __SERVO_DRIVER_IF_H__
@@ -35,6 +35,8 @@
 #include "servo_driver_search_pressure_if.h"
 #include "servo_driver.h"
 #include "adc_driver_if.h"
+#include "sensor_sampler_if.h"
+#include "force_controller_if.h"
 
 //****************************************************************************
 // Moves the servo motor by degrees on the finger specified
@@ -54,6 +56,9 @@ void MoveServo_SearchPressure(unsigned char ucCommand, unsigned char * data)
     unsigned char highByte;								// Storing High Byte of sensor reading
     unsigned char lowByte;								// Storing Low Byte of sensor reading
 
+    struct SensorSnapshot snapshot;                     // Latest readings from the sampler
+
+    GetSensorSnapshot(&snapshot);
 
     // Close/Open the hand incrementally _x_ number of times
     for (ucIterationIndex = 0; ucIterationIndex < SCALE_SPEED; ucIterationIndex++)
@@ -71,7 +76,7 @@ void MoveServo_SearchPressure(unsigned char ucCommand, unsigned char * data)
             usPressureSensorTolerance = GetFingerTolerance( (enum Fingertip_Sensor_Type)ucFingerIndex );
 
             // Get the Pressure sensor reading
-            usPressureSensorReading = GetSensorReading((enum Fingertip_Sensor_Type)ucFingerIndex);
+            usPressureSensorReading = snapshot.usReading[ucFingerIndex];
             UART_PRINT("Finger: %d, Reading: %d, Tolerance: %d ", ucFingerIndex, usPressureSensorReading, usPressureSensorTolerance);
 
             // Close the hand incrementally checking the pressure sensor each time
@@ -179,21 +184,7 @@ void SetFingerPosition(struct ServoPosition *PositionRecord, enum Fingertip_Sens
 //****************************************************************************
 unsigned short GetFingerTolerance( enum Fingertip_Sensor_Type eSensorJoint )
 {
-	switch(eSensorJoint)
-	{
-		case SENSOR_FINGER_THUMB:
-			return PRESSURE_THRESHOLD_THUMB;
-		case SENSOR_FINGER_INDEX:
-			return PRESSURE_THRESHOLD_INDEX;
-		case SENSOR_FINGER_MIDDLE:
-			return PRESSURE_THRESHOLD_MIDDLE;
-		case SENSOR_FINGER_RING:
-			return PRESSURE_THRESHOLD_RING;
-		case SENSOR_FINGER_PINKY:
-			return PRESSURE_THRESHOLD_PINKY;
-		default:
-			return 0;
-	}
+	return GetForceSetpoint(eSensorJoint);
 }
 
 //****************************************************************************
@@ -29,12 +29,8 @@
 #define POSITION_INCREMENT 5    		// Movement increment in degrees
 #define RETREAT_DECREMENT 2     		// Movement to retreat if above threshold
 
-// Pressure Threshold values for each finger before servo stops
-#define PRESSURE_THRESHOLD_THUMB 940  	// Threshold pressure before servo stops
-#define PRESSURE_THRESHOLD_INDEX 900  	// Threshold pressure before servo stops
-#define PRESSURE_THRESHOLD_MIDDLE 940  // Threshold pressure before servo stops
-#define PRESSURE_THRESHOLD_RING 940  	// Threshold pressure before servo stops
-#define PRESSURE_THRESHOLD_PINKY 940  	// Threshold pressure before servo stops
+// Pressure threshold values for each finger are the force controller's
+// setpoints, see force_controller_if.h
 
 #define TOLERANCE 50           			// Tolerance value for holding position
 
@@ -80,15 +80,21 @@ int ServerNewSockID; // Hold New Server Socket ID for Client
 //                  HELPER FUNCTIONS -- Start
 //*****************************************************************************
 static void SetSocketVariables();
+static int WaitReadable(int iSockID, long lTimeoutMs);
+#ifndef HOST_BUILD
 static long ConfigureSimpleLinkToDefaultState();
 static inline _u8 SecurityTypeParser(char * cSecurityType);
 static int ConnectToHTTPServer(HTTPCli_Handle httpClient);
 static int HTTPGetMethod(HTTPCli_Handle httpClient, char * getRequest);
 static int UpdateIPtoServer(char *ipAddr);//update the ipAddr to the Server
+#endif
 //*****************************************************************************
 //                  HELPER FUNCTIONS -- End
 //*****************************************************************************
 
+// The host build (Firmware/host) has no network processor to bring up and
+// provides its own WlanStart() and WlanConnect()
+#ifndef HOST_BUILD
 //****************************************************************************
 //
 //! Start the SimpleLink in Station Mode in order to connect to a WIFI Router
@@ -182,6 +188,7 @@ long WlanConnect(char *cSSID, char *cSecurityType, char*cSecurityKey)
     UpdateIPtoServer(ipString);
     return SUCCESS;
 }
+#endif // HOST_BUILD
 
 //****************************************************************************
 //
@@ -202,6 +209,7 @@ int BsdTcpServerSetup(unsigned short usPort)
 
     //Set variables for the socket
     SetSocketVariables();
+    g_uiPortNum = usPort;
 
     //filling the TCP server socket address
     sLocalAddr.sin_family = SL_AF_INET;
@@ -235,11 +243,10 @@ int BsdTcpServerSetup(unsigned short usPort)
         ASSERT_ON_ERROR(LISTEN_ERROR);
     }
 
-    //The code should be BLOCKING
-    //TO-DO: investigate the effects of BLOCKING CODE, SO FAR SO GOOD
-    // setting socket option to make the socket as non blocking
-    /* iStatus = sl_SetSockOpt(ServerSockID, SL_SOL_SOCKET, SL_SO_NONBLOCKING,
-                           &lNonBlocking, sizeof(lNonBlocking)); */
+    // setting socket option to make the socket as non blocking, waits are
+    // done in sl_Select() so the network task can drain the socket
+    iStatus = sl_SetSockOpt(ServerSockID, SL_SOL_SOCKET, SL_SO_NONBLOCKING,
+                           &lNonBlocking, sizeof(lNonBlocking));
     if( iStatus < 0 )
     {
         sl_Close(ServerSockID);
@@ -267,6 +274,10 @@ int BsdTcpServerAccept()
     SlSockAddrIn_t  sAddr;
     int iAddrSize;
     int iStatus;
+    long lNonBlocking = 1;
+#if TCP_RCV_WINDOW > 0
+    SlSockWinsize_t sWinsize;
+#endif
 
     iAddrSize = sizeof(SlSockAddrIn_t);
 
@@ -289,7 +300,8 @@ int BsdTcpServerAccept()
                                 (SlSocklen_t*)&iAddrSize);
         if( ServerNewSockID == SL_EAGAIN )
         {
-           MAP_UtilsDelay(10000);
+            // sleep until a client connects
+            WaitReadable(ServerSockID, -1);
         }
         else if( ServerNewSockID < 0 )
         {
@@ -299,6 +311,27 @@ int BsdTcpServerAccept()
             ASSERT_ON_ERROR(ACCEPT_ERROR);
         }
     }
+
+    // the client socket is drained without blocking as well
+    iStatus = sl_SetSockOpt(ServerNewSockID, SL_SOL_SOCKET, SL_SO_NONBLOCKING,
+                            &lNonBlocking, sizeof(lNonBlocking));
+    if( iStatus < 0 )
+    {
+        ASSERT_ON_ERROR(SOCKET_OPT_ERROR);
+    }
+
+#if TCP_RCV_WINDOW > 0
+    // a small window keeps the controller from queueing stale packets in
+    // the network, the connection still works with the default one
+    sWinsize.Winsize = TCP_RCV_WINDOW;
+    iStatus = sl_SetSockOpt(ServerNewSockID, SL_SOL_SOCKET, SL_SO_RCVBUF,
+                            &sWinsize, sizeof(sWinsize));
+    if( iStatus < 0 )
+    {
+        UART_PRINT("Receive window not set: %d\n\r", iStatus);
+    }
+#endif
+
     UART_PRINT("CLIENT CONNECTED. new SOCKID: %d.\n\r",ServerNewSockID);
     return SUCCESS;
 }
@@ -308,26 +341,111 @@ int BsdTcpServerAccept()
 //! \brief Recieving data from the client
 //!
 //! \param [in]: pointer to data, the recieving packet will be store in data
-//! \param [in]: length of data buffer
+//! \param [in]: length of data buffer, all of which is filled
 //!
-//! \return     0 on success, -1 on error.
+//! \return     0 on success, RECV_ERROR once the connection is closed or
+//!             fails.
 //!
 //****************************************************************************
 int BsdTcpServerReceive(unsigned char *data, int len)
 {
     int iStatus;
+    int iReceived = 0;
 
-    iStatus = sl_Recv(ServerNewSockID, (void*) data, len, 0);
-    if( iStatus <= 0 )
+    // the socket is non blocking, wait here for each part of the data
+    while( iReceived < len )
     {
-       // error
-    	UART_PRINT("ERROR RECEIVING DATA.\n\r");
+        if( WaitReadable(ServerNewSockID, -1) < 0 )
+        {
+            UART_PRINT("ERROR RECEIVING DATA.\n\r");
+            return RECV_ERROR;
+        }
+
+        iStatus = sl_Recv(ServerNewSockID, (void*) (data + iReceived),
+                          len - iReceived, 0);
+        if( iStatus == SL_EAGAIN )
+        {
+            continue;
+        }
+        else if( iStatus <= 0 )
+        {
+            // error
+            UART_PRINT("ERROR RECEIVING DATA.\n\r");
+            return RECV_ERROR;
+        }
+        iReceived += iStatus;
     }
-    else
+
+    return SUCCESS;
+}
+
+//****************************************************************************
+//
+//! \brief Waiting for data from the client
+//!
+//! \param [in]: longest wait in milliseconds, or -1 to wait until data comes
+//!
+//! \return     1 when data can be read, 0 on timeout, negative on error.
+//!
+//****************************************************************************
+int BsdTcpServerWaitReceive(long lTimeoutMs)
+{
+    return WaitReadable(ServerNewSockID, lTimeoutMs);
+}
+
+//****************************************************************************
+//
+//! \brief Waiting for another client to connect while one is served
+//!
+//! \param [in]: longest wait in milliseconds, or -1 to wait until one does
+//!
+//! \return     1 when a connection is waiting to be accepted, 0 on timeout,
+//!             negative on error.
+//!
+//****************************************************************************
+int BsdTcpServerWaitAccept(long lTimeoutMs)
+{
+    return WaitReadable(ServerSockID, lTimeoutMs);
+}
+
+//****************************************************************************
+//
+//! \brief Recieving all data the client has sent so far, without blocking
+//!
+//! \param [in]: pointer to data, the recieved bytes will be stored in data
+//! \param [in]: length of data buffer
+//!
+//! \return     number of bytes stored, 0 if none were waiting, RECV_ERROR
+//!             once the connection is closed or fails.
+//!
+//****************************************************************************
+int BsdTcpServerReceiveAvailable(unsigned char *data, int len)
+{
+    int iStatus;
+    int iReceived = 0;
+
+    while( iReceived < len )
     {
-        UART_PRINT("RECEIVED BUFF:%s\n\r", data);
+        iStatus = sl_Recv(ServerNewSockID, (void*) (data + iReceived),
+                          len - iReceived, 0);
+        if( iStatus == SL_EAGAIN )
+        {
+            break;
+        }
+        else if( iStatus <= 0 )
+        {
+            // closed or failed, report what came first
+            if( iReceived == 0 )
+            {
+                UART_PRINT("ERROR RECEIVING DATA.\n\r");
+                return RECV_ERROR;
+            }
+            break;
+        }
+        iReceived += iStatus;
     }
-    return SUCCESS;
+
+    return iReceived;
 }
 
 //****************************************************************************
@@ -362,9 +480,34 @@ int BsdTcpServerClose()
     ASSERT_ON_ERROR(iStatus);
     return SUCCESS;
 }
+
+//****************************************************************************
+//
+//! \brief Port of the TCP server socket
+//!
+//! \return     the port given to BsdTcpServerSetup()
+//!
+//****************************************************************************
+unsigned short BsdTcpServerPort()
+{
+    return (unsigned short)g_uiPortNum;
+}
+
+//****************************************************************************
+//
+//! \brief IP address acquired from the access point
+//!
+//! \return     the address in host byte order, 0 if none was reported
+//!
+//****************************************************************************
+unsigned long WlanGetIpAddress()
+{
+    return g_ulIpAddr;
+}
 //****************************************************************************
 //                          UTILITY FUNCTIONS
 //****************************************************************************
+#ifndef HOST_BUILD
 //****************************************************************************
 //
 //! \brief Update the IP address of the board to the server
@@ -513,6 +656,7 @@ static inline _u8 SecurityTypeParser(char * cSecurityType)
     if (strstr("SL_SEC_TYPE_P2P_PIN_DISPLAY",cSecurityType) != NULL) return SL_SEC_TYPE_P2P_PIN_DISPLAY;
     return SL_SEC_TYPE_OPEN;
 }
+#endif // HOST_BUILD
 //*****************************************************************************
 //
 //! This function set the socket variables
@@ -533,6 +677,39 @@ static void SetSocketVariables()
     g_ulPacketCount = TCP_PACKET_COUNT;
 }
 
+//*****************************************************************************
+//
+//! This function waits until a socket can be read
+//!
+//! \param[in]    iSockID - socket to wait on
+//! \param[in]    lTimeoutMs - longest wait in milliseconds, -1 for no limit
+//!
+//! \return 1 when the socket can be read, 0 on timeout, negative on error
+//!
+//*****************************************************************************
+static int WaitReadable(int iSockID, long lTimeoutMs)
+{
+    SlFdSet_t readSet;
+    SlTimeval_t timeout;
+    int iStatus;
+
+    SL_FD_ZERO(&readSet);
+    SL_FD_SET(iSockID, &readSet);
+
+    timeout.tv_sec = lTimeoutMs/1000;
+    timeout.tv_usec = (lTimeoutMs%1000)*1000;
+
+    iStatus = sl_Select(iSockID + 1, &readSet, NULL, NULL,
+                        lTimeoutMs < 0 ? NULL : &timeout);
+    if( iStatus < 0 )
+    {
+        return iStatus;
+    }
+
+    return SL_FD_ISSET(iSockID, &readSet) ? 1 : 0;
+}
+
+#ifndef HOST_BUILD
 //*****************************************************************************
 //! \brief This function puts the device in its default state. It:
 //!           - Set the mode to STATION
@@ -658,8 +835,14 @@ static long ConfigureSimpleLinkToDefaultState()
             WLAN_GENERAL_PARAM_OPT_STA_TX_POWER, 1, (unsigned char *)&ucPower);
     ASSERT_ON_ERROR(lRetVal);
 
+#if TCP_WLAN_ALWAYS_ON
+    // Set PM policy to always on, a dozing radio holds each packet from the
+    // controller until it wakes for the next beacon
+    lRetVal = sl_WlanPolicySet(SL_POLICY_PM , SL_ALWAYS_ON_POLICY, NULL, 0);
+#else
     // Set PM policy to normal
     lRetVal = sl_WlanPolicySet(SL_POLICY_PM , SL_NORMAL_POLICY, NULL, 0);
+#endif
     ASSERT_ON_ERROR(lRetVal);
 
     // Unregister mDNS services
@@ -918,6 +1101,7 @@ void SimpleLinkHttpServerCallback(SlHttpServerEvent_t *pHttpEvent,
 //*****************************************************************************
 // SimpleLink Asynchronous Event Handlers -- End
 //*****************************************************************************
+#endif // HOST_BUILD
 
 //*****************************************************************************
 //
@@ -40,6 +40,16 @@
 #define PORT_NUM            5001 /*Default PORT_NUM */
 #define TCP_PACKET_COUNT    1000 /*Default TCP Packet Count */
 
+/* Low-latency profile of the server socket. SimpleLink has no option for
+   Nagle's algorithm, delayed ACKs or the IP ToS byte, so the firmware side
+   of the profile is the receive window and the power policy of the radio */
+#define TCP_RCV_WINDOW      1024 /* Receive window in bytes, 0 keeps the
+                                    SimpleLink default. Bounds the stale
+                                    packets in flight to about 68 */
+#define TCP_WLAN_ALWAYS_ON  1    /* 1 keeps the radio awake between packets
+                                    (SL_ALWAYS_ON_POLICY) instead of dozing
+                                    until the next beacon */
+
 /* Server */
 #define HOST_NAME "robotarm.net23.net"
 #define HOST_PORT 80
@@ -63,6 +73,11 @@ typedef enum{
 
 /***************************END OF TCP CONFIG ************************************/
 
+//****************************************************************************
+//         	                    GLOBAL VARIABLES
+//****************************************************************************
+extern unsigned int g_uiPortNum; //Port the server listens on
+
 //****************************************************************************
 //         	                    INTERFACE FUNCTIONS
 //****************************************************************************
@@ -72,8 +87,13 @@ long WlanConnect(char *cSSID, char *cSecurityType, \
 int BsdTcpServerSetup(unsigned short usPort); //Create a TCP server socket
 int BsdTcpServerAccept(); //Accept connection
 int BsdTcpServerReceive(unsigned char *data, int len);//Recieve data
+int BsdTcpServerWaitReceive(long lTimeoutMs); //Wait for data
+int BsdTcpServerWaitAccept(long lTimeoutMs); //Wait for another client
+int BsdTcpServerReceiveAvailable(unsigned char *data, int len);//Recieve waiting data
 int BsdTcpServerSend(unsigned char *data, int length); //send data
 int BsdTcpServerClose();//Close the TCP socket
+unsigned short BsdTcpServerPort(); //Port the server listens on
+unsigned long WlanGetIpAddress(); //IP address from the AP, 0 if none
 int IpAddressParser(char *ucCMD);//convert string IP address to hex IP address
 
 //*****************************************************************************
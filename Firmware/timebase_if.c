@@ -0,0 +1,242 @@
+//*****************************************************************************
+//
+// timebase_if.c
+//
+// Shared monotonic timebase. Replaces the per-driver delay() functions that
+// reconfigured TIMERA0 on every call, which both stalled the CPU and broke
+// the wrist PWM on the same timer.
+//
+// SysTick reloads every millisecond and its interrupt counts milliseconds.
+// Microsecond timestamps are the millisecond count plus the ticks elapsed
+// in the current millisecond.
+//
+// With USE_FREERTOS the kernel owns SysTick and runs it at the same 1 ms
+// period (configTICK_RATE_HZ 1000 in the SDK's FreeRTOSConfig.h), so the
+// milliseconds are counted from the kernel's tick hook instead.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <stdlib.h>
+
+// Driverlib includes
+#include "hw_types.h"
+#include "hw_ints.h"
+#include "hw_nvic.h"
+#include "rom.h"
+#include "rom_map.h"
+#include "systick.h"
+
+#include "timebase_if.h"
+
+static volatile unsigned long g_ulMillis = 0;
+static void (*g_pfnIdle)(void) = NULL;
+
+static void TimebaseIntHandler(void);
+
+//****************************************************************************
+//
+//! Starts the timebase
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void Timebase_Init(void)
+{
+    g_ulMillis = 0;
+
+#ifndef USE_FREERTOS
+    MAP_SysTickPeriodSet(TIMEBASE_TICKS_PER_MS);
+    MAP_SysTickIntRegister(TimebaseIntHandler);
+    MAP_SysTickIntEnable();
+    MAP_SysTickEnable();
+#endif
+}
+
+//****************************************************************************
+//
+//! Returns microseconds since Timebase_Init(). Safe from interrupt context,
+//! including while the SysTick interrupt is held off.
+//!
+//! \param None
+//!
+//! \return timestamp in microseconds
+//
+//****************************************************************************
+unsigned long Timebase_GetMicros(void)
+{
+    unsigned long ulMillis;
+    unsigned long ulValue;
+    tBoolean bReloadPending;
+
+    // Retry if the interrupt ran between reading the count and the counter
+    do
+    {
+        ulMillis = g_ulMillis;
+        ulValue = MAP_SysTickValueGet();
+        bReloadPending = (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET) != 0;
+    } while (ulMillis != g_ulMillis);
+
+    // The counter reloaded but the interrupt has not run yet. SysTick counts
+    // down, so a value in the upper half was read after the reload.
+    if (bReloadPending && ulValue > TIMEBASE_TICKS_PER_MS/2)
+    {
+        ulMillis++;
+    }
+
+    return ulMillis*1000 + (TIMEBASE_TICKS_PER_MS - 1 - ulValue)/TIMEBASE_TICKS_PER_US;
+}
+
+//****************************************************************************
+//
+//! Returns milliseconds since Timebase_Init()
+//!
+//! \param None
+//!
+//! \return timestamp in milliseconds
+//
+//****************************************************************************
+unsigned long Timebase_GetMillis(void)
+{
+    return g_ulMillis;
+}
+
+//****************************************************************************
+//
+//! Arms a deadline
+//!
+//! \param pDeadline is the deadline to arm
+//! \param ulMicros is the time from now until it expires
+//!
+//! \return None
+//
+//****************************************************************************
+void Timebase_SetDeadline(struct Deadline *pDeadline, unsigned long ulMicros)
+{
+    pDeadline->ulExpiry = Timebase_GetMicros() + ulMicros;
+}
+
+//****************************************************************************
+//
+//! Checks whether a deadline has passed
+//!
+//! \param pDeadline is the deadline to check
+//!
+//! \return true once the deadline has passed
+//
+//****************************************************************************
+tBoolean Timebase_DeadlineExpired(const struct Deadline *pDeadline)
+{
+    return ((long)(Timebase_GetMicros() - pDeadline->ulExpiry) >= 0);
+}
+
+//****************************************************************************
+//
+//! Returns the time left before a deadline
+//!
+//! \param pDeadline is the deadline to check
+//!
+//! \return microseconds left, 0 if the deadline has passed
+//
+//****************************************************************************
+unsigned long Timebase_DeadlineRemaining(const struct Deadline *pDeadline)
+{
+    long lRemaining = (long)(pDeadline->ulExpiry - Timebase_GetMicros());
+
+    return (lRemaining > 0) ? (unsigned long)lRemaining : 0;
+}
+
+//****************************************************************************
+//
+//! Waits until a deadline has passed. The idle hook, if any, runs while
+//! waiting so that the caller does not hold up other work.
+//!
+//! \param pDeadline is the deadline to wait for
+//!
+//! \return None
+//
+//****************************************************************************
+void Timebase_WaitDeadline(const struct Deadline *pDeadline)
+{
+    while (!Timebase_DeadlineExpired(pDeadline))
+    {
+        if (g_pfnIdle != NULL)
+        {
+            g_pfnIdle();
+        }
+    }
+}
+
+//****************************************************************************
+//
+//! Waits for a duration, running the idle hook meanwhile
+//!
+//! \param ulMicros is the time to wait in microseconds
+//!
+//! \return None
+//
+//****************************************************************************
+void Timebase_Delay(unsigned long ulMicros)
+{
+    struct Deadline deadline;
+
+    Timebase_SetDeadline(&deadline, ulMicros);
+    Timebase_WaitDeadline(&deadline);
+}
+
+//****************************************************************************
+//
+//! Sets the function run while waiting on a deadline
+//!
+//! \param pfnIdle is the function to run, or NULL for none
+//!
+//! \return None
+//
+//****************************************************************************
+void Timebase_SetIdleHook(void (*pfnIdle)(void))
+{
+    g_pfnIdle = pfnIdle;
+}
+
+#ifdef USE_FREERTOS
+//****************************************************************************
+//
+//! Counts a millisecond. Called from the kernel's tick hook.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void Timebase_Tick(void)
+{
+    TimebaseIntHandler();
+}
+#endif
+
+//****************************************************************************
+//
+//! SysTick interrupt, counts milliseconds
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+static void TimebaseIntHandler(void)
+{
+    g_ulMillis++;
+}
@@ -0,0 +1,92 @@
+#ifndef __TIMEBASE_IF_H__
+#define __TIMEBASE_IF_H__
+//*****************************************************************************
+//
+// timebase_if.h
+//
+// Header file for the shared monotonic timebase. SysTick interrupts every
+// millisecond; timestamps combine the millisecond count with the SysTick
+// counter for microsecond resolution.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+
+#define TIMEBASE_SYS_CLK            80000000
+#define TIMEBASE_TICKS_PER_US       (TIMEBASE_SYS_CLK/1000000)
+#define TIMEBASE_TICKS_PER_MS       (TIMEBASE_SYS_CLK/1000)
+
+// Timestamps wrap every ~71 minutes. Compare them with TIMEBASE_ELAPSED or
+// Timebase_DeadlineExpired() rather than directly.
+#define TIMEBASE_ELAPSED(ulNow, ulThen)   ((unsigned long)((ulNow) - (ulThen)))
+
+struct Deadline {
+    unsigned long ulExpiry;     // Timestamp in microseconds
+};
+
+//****************************************************************************
+// Starts the timebase. Must be called before any other timebase function.
+// With USE_FREERTOS time only advances once the scheduler has started.
+//****************************************************************************
+void Timebase_Init(void);
+
+//****************************************************************************
+// Returns microseconds since Timebase_Init(). Safe from interrupt context.
+//****************************************************************************
+unsigned long Timebase_GetMicros(void);
+
+//****************************************************************************
+// Returns milliseconds since Timebase_Init(). Safe from interrupt context.
+//****************************************************************************
+unsigned long Timebase_GetMillis(void);
+
+//****************************************************************************
+// Arms a deadline ulMicros from now
+//****************************************************************************
+void Timebase_SetDeadline(struct Deadline *pDeadline, unsigned long ulMicros);
+
+//****************************************************************************
+// Returns true once the deadline has passed
+//****************************************************************************
+tBoolean Timebase_DeadlineExpired(const struct Deadline *pDeadline);
+
+//****************************************************************************
+// Returns microseconds left before the deadline, 0 if it has passed
+//****************************************************************************
+unsigned long Timebase_DeadlineRemaining(const struct Deadline *pDeadline);
+
+//****************************************************************************
+// Waits until the deadline has passed, running the idle hook meanwhile
+//****************************************************************************
+void Timebase_WaitDeadline(const struct Deadline *pDeadline);
+
+//****************************************************************************
+// Waits ulMicros microseconds, running the idle hook meanwhile
+//****************************************************************************
+void Timebase_Delay(unsigned long ulMicros);
+
+//****************************************************************************
+// Sets a function called repeatedly while Timebase_WaitDeadline() and
+// Timebase_Delay() wait, or NULL for none
+//****************************************************************************
+void Timebase_SetIdleHook(void (*pfnIdle)(void));
+
+#ifdef USE_FREERTOS
+//****************************************************************************
+// Counts a millisecond. Must be called from vApplicationTickHook().
+//****************************************************************************
+void Timebase_Tick(void);
+#endif
+
+#endif //  __TIMEBASE_IF_H__
@@ -0,0 +1,419 @@
+//*****************************************************************************
+//
+// trajectory_if.c
+//
+// On-board trajectory playback. An upload is announced by a TRAJ_BEGIN with
+// the frame count and rate, followed by one TRAJ_CHUNK per frame in order
+// and a TRAJ_END carrying a Fletcher-16 checksum of every frame. Each chunk
+// also carries its own checksum byte. Any bad or missing chunk fails the
+// upload when it ends, and the controller starts it over.
+//
+// Playback is driven by the pose playback interrupt, which asks for the
+// frame due at the current time on every tick and hands it to the servo
+// motion profiles in place of the buffered DATA poses. Frames recorded
+// faster than the tick are skipped; the profiles smooth out the rest.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+// Standard includes
+#include <string.h>
+
+// Driverlib includes
+#include "hw_types.h"
+#include "rom.h"
+#include "rom_map.h"
+#include "interrupt.h"
+
+#include "hircp.h"
+#include "timebase_if.h"
+#include "trajectory_if.h"
+
+static unsigned char g_ucFrames[TRAJECTORY_MAX_FRAMES][NUM_SERVOS];
+static volatile unsigned char g_ucState = HIRCP_TRAJ_EMPTY;
+static unsigned short g_usNumFrames = 0;
+static unsigned char g_ucFps = 0;
+
+// Upload progress
+static unsigned short g_usExpected = 0;         // Index of the next chunk
+static unsigned char g_ucUploadResult = HIRCP_TRAJ_OK;
+static unsigned short g_usSum1 = 0;             // Fletcher-16 running sums
+static unsigned short g_usSum2 = 0;
+
+// Playback progress
+static tBoolean g_bLoop = false;
+static tBoolean g_bTicked = false;              // g_ulLastTick is valid
+static unsigned long g_ulLastTick = 0;
+static unsigned long g_ulElapsed = 0;           // Microseconds into the pass
+static unsigned short g_usFrame = 0;
+static unsigned short g_usLoops = 0;
+
+static unsigned char HandleCommand(const unsigned char *pucPayload, unsigned char ucMode);
+static void StoreChunk(const unsigned char *pucPayload);
+static unsigned char FinishUpload(const unsigned char *pucPayload);
+static void PackStatus(unsigned char ucCommand, unsigned char ucResult,
+                       unsigned char *pucReply);
+static tBoolean EnterCritical(void);
+static void ExitCritical(tBoolean bWasDisabled);
+
+//****************************************************************************
+//
+//! Handles a TRAJ payload
+//!
+//! \param pucPayload holds HIRCP_TRAJ_PAYLOAD_LEN bytes
+//! \param ucMode is the HIRCP mode of the connection
+//! \param pucReply receives HIRCP_TRAJ_PAYLOAD_LEN bytes
+//!
+//! \return true if pucReply is to be sent, false for a chunk
+//
+//****************************************************************************
+tBoolean HandleTrajectoryCommand(const unsigned char *pucPayload, unsigned char ucMode,
+                                 unsigned char *pucReply)
+{
+    unsigned char ucResult;
+    tBoolean bWasDisabled;
+
+    if (pucPayload[0] == HIRCP_TRAJ_CHUNK)
+    {
+        StoreChunk(pucPayload);
+        return false;
+    }
+
+    // The playback interrupt reads the state and the progress
+    bWasDisabled = EnterCritical();
+    ucResult = HandleCommand(pucPayload, ucMode);
+    PackStatus(pucPayload[0], ucResult, pucReply);
+    ExitCritical(bWasDisabled);
+
+    return true;
+}
+
+//****************************************************************************
+//
+//! Ends playback. The trajectory stays uploaded.
+//!
+//! \param None
+//!
+//! \return None
+//
+//****************************************************************************
+void StopTrajectory(void)
+{
+    tBoolean bWasDisabled;
+
+    bWasDisabled = EnterCritical();
+    if (g_ucState == HIRCP_TRAJ_PLAYING || g_ucState == HIRCP_TRAJ_PAUSED)
+    {
+        g_ucState = HIRCP_TRAJ_READY;
+        g_usFrame = 0;
+    }
+    ExitCritical(bWasDisabled);
+}
+
+//****************************************************************************
+//
+//! Returns true while a trajectory is playing or paused
+//!
+//! \param None
+//!
+//! \return whether the trajectory owns the servo targets
+//
+//****************************************************************************
+tBoolean IsTrajectoryActive(void)
+{
+    return (g_ucState == HIRCP_TRAJ_PLAYING || g_ucState == HIRCP_TRAJ_PAUSED);
+}
+
+//****************************************************************************
+//
+//! Advances playback and gets the pose that is due. Called from the pose
+//! playback interrupt.
+//!
+//! \param ulNow is the current time in microseconds
+//! \param pucPose receives NUM_SERVOS positions in degrees
+//!
+//! \return true if a trajectory is active and pucPose was written
+//
+//****************************************************************************
+tBoolean StepTrajectory(unsigned long ulNow, unsigned char *pucPose)
+{
+    unsigned long ulDuration;
+    unsigned long ulFrame;
+
+    if (g_ucState == HIRCP_TRAJ_PAUSED)
+    {
+        // Time paused does not count towards the next frame
+        g_bTicked = false;
+        memcpy(pucPose, g_ucFrames[g_usFrame], NUM_SERVOS);
+        return true;
+    }
+    else if (g_ucState != HIRCP_TRAJ_PLAYING)
+    {
+        return false;
+    }
+
+    if (g_bTicked)
+    {
+        g_ulElapsed += TIMEBASE_ELAPSED(ulNow, g_ulLastTick);
+    }
+    g_ulLastTick = ulNow;
+    g_bTicked = true;
+
+    ulFrame = (unsigned long)((unsigned long long)g_ulElapsed*g_ucFps/1000000);
+    if (ulFrame >= g_usNumFrames)
+    {
+        if (g_bLoop)
+        {
+            ulDuration = (unsigned long)((unsigned long long)g_usNumFrames*1000000/g_ucFps);
+            g_ulElapsed %= ulDuration;
+            ulFrame = (unsigned long)((unsigned long long)g_ulElapsed*g_ucFps/1000000);
+            if (g_usLoops < 0xFFFF)
+            {
+                g_usLoops++;
+            }
+        }
+        else
+        {
+            // The last frame stays the target, DATA poses take over from it
+            ulFrame = g_usNumFrames - 1;
+            g_ucState = HIRCP_TRAJ_READY;
+        }
+    }
+
+    g_usFrame = (unsigned short)ulFrame;
+    memcpy(pucPose, g_ucFrames[g_usFrame], NUM_SERVOS);
+    return true;
+}
+
+//****************************************************************************
+//
+//! Runs a command other than a chunk. Interrupts must be masked.
+//!
+//! \param pucPayload holds HIRCP_TRAJ_PAYLOAD_LEN bytes
+//! \param ucMode is the HIRCP mode of the connection
+//!
+//! \return HIRCP_TRAJ_OK or the reason the command failed
+//
+//****************************************************************************
+static unsigned char HandleCommand(const unsigned char *pucPayload, unsigned char ucMode)
+{
+    unsigned short usNumFrames;
+    tBoolean bActive = IsTrajectoryActive();
+
+    switch (pucPayload[0])
+    {
+        case HIRCP_TRAJ_BEGIN:
+            usNumFrames = (unsigned short)((pucPayload[2] << 8) | pucPayload[3]);
+            if (bActive)
+            {
+                return HIRCP_TRAJ_NOT_READY;
+            }
+            if (usNumFrames == 0 || usNumFrames > TRAJECTORY_MAX_FRAMES ||
+                pucPayload[1] == 0)
+            {
+                return HIRCP_TRAJ_REJECTED;
+            }
+            g_ucFps = pucPayload[1];
+            g_usNumFrames = usNumFrames;
+            g_usExpected = 0;
+            g_ucUploadResult = HIRCP_TRAJ_OK;
+            g_usSum1 = 0;
+            g_usSum2 = 0;
+            g_usFrame = 0;
+            g_usLoops = 0;
+            g_ucState = HIRCP_TRAJ_UPLOADING;
+            return HIRCP_TRAJ_OK;
+
+        case HIRCP_TRAJ_END:
+            return FinishUpload(pucPayload);
+
+        case HIRCP_TRAJ_PLAY:
+            if ((ucMode != HIRCP_NORMAL && ucMode != HIRCP_HYBRID) ||
+                (g_ucState != HIRCP_TRAJ_READY && !bActive))
+            {
+                return HIRCP_TRAJ_NOT_READY;
+            }
+            if (g_ucState == HIRCP_TRAJ_READY)
+            {
+                g_ulElapsed = 0;
+                g_usFrame = 0;
+                g_usLoops = 0;
+            }
+            g_bLoop = (pucPayload[1] & HIRCP_TRAJ_LOOP) != 0;
+            if (g_ucState != HIRCP_TRAJ_PLAYING)
+            {
+                g_bTicked = false;
+                g_ucState = HIRCP_TRAJ_PLAYING;
+            }
+            return HIRCP_TRAJ_OK;
+
+        case HIRCP_TRAJ_PAUSE:
+            if (!bActive)
+            {
+                return HIRCP_TRAJ_NOT_READY;
+            }
+            g_ucState = HIRCP_TRAJ_PAUSED;
+            return HIRCP_TRAJ_OK;
+
+        case HIRCP_TRAJ_STOP:
+            // Also abandons an upload
+            if (g_ucState == HIRCP_TRAJ_UPLOADING)
+            {
+                g_ucState = HIRCP_TRAJ_EMPTY;
+            }
+            else if (bActive)
+            {
+                g_ucState = HIRCP_TRAJ_READY;
+                g_usFrame = 0;
+            }
+            return HIRCP_TRAJ_OK;
+
+        case HIRCP_TRAJ_STATUS:
+            return HIRCP_TRAJ_OK;
+
+        default:
+            return HIRCP_TRAJ_REJECTED;
+    }
+}
+
+//****************************************************************************
+//
+//! Stores one frame of an upload. A chunk carries its index as a big-endian
+//! 16-bit value in bytes 1-2, the frame in bytes 3-8, and a byte that makes
+//! the sum of the whole payload zero. The first bad chunk fails the upload.
+//!
+//! \param pucPayload holds HIRCP_TRAJ_PAYLOAD_LEN bytes
+//!
+//! \return None
+//
+//****************************************************************************
+static void StoreChunk(const unsigned char *pucPayload)
+{
+    unsigned short usIndex;
+    unsigned char ucSum = 0;
+    int i;
+
+    if (g_ucState != HIRCP_TRAJ_UPLOADING || g_ucUploadResult != HIRCP_TRAJ_OK)
+    {
+        return;
+    }
+
+    for (i = 0; i < HIRCP_TRAJ_PAYLOAD_LEN; i++)
+    {
+        ucSum += pucPayload[i];
+    }
+    if (ucSum != 0)
+    {
+        g_ucUploadResult = HIRCP_TRAJ_BAD_CHECKSUM;
+        return;
+    }
+
+    usIndex = (unsigned short)((pucPayload[1] << 8) | pucPayload[2]);
+    if (usIndex != g_usExpected || usIndex >= g_usNumFrames)
+    {
+        g_ucUploadResult = HIRCP_TRAJ_INCOMPLETE;
+        return;
+    }
+
+    memcpy(g_ucFrames[usIndex], &pucPayload[3], NUM_SERVOS);
+    for (i = 0; i < NUM_SERVOS; i++)
+    {
+        g_usSum1 = (g_usSum1 + pucPayload[3+i]) % 255;
+        g_usSum2 = (g_usSum2 + g_usSum1) % 255;
+    }
+    g_usExpected++;
+}
+
+//****************************************************************************
+//
+//! Checks a finished upload against its TRAJ_END, which carries the
+//! Fletcher-16 checksum of every frame in order as a big-endian 16-bit
+//! value in bytes 1-2. Interrupts must be masked.
+//!
+//! \param pucPayload holds HIRCP_TRAJ_PAYLOAD_LEN bytes
+//!
+//! \return HIRCP_TRAJ_OK if the trajectory is ready to play
+//
+//****************************************************************************
+static unsigned char FinishUpload(const unsigned char *pucPayload)
+{
+    unsigned short usChecksum = (unsigned short)((pucPayload[1] << 8) | pucPayload[2]);
+    unsigned char ucResult = g_ucUploadResult;
+
+    if (g_ucState != HIRCP_TRAJ_UPLOADING)
+    {
+        return HIRCP_TRAJ_NOT_READY;
+    }
+
+    if (ucResult == HIRCP_TRAJ_OK && g_usExpected != g_usNumFrames)
+    {
+        ucResult = HIRCP_TRAJ_INCOMPLETE;
+    }
+    else if (ucResult == HIRCP_TRAJ_OK && usChecksum != ((g_usSum2 << 8) | g_usSum1))
+    {
+        ucResult = HIRCP_TRAJ_BAD_CHECKSUM;
+    }
+
+    g_ucState = (ucResult == HIRCP_TRAJ_OK) ? HIRCP_TRAJ_READY : HIRCP_TRAJ_EMPTY;
+    return ucResult;
+}
+
+//****************************************************************************
+//
+//! Writes a TRAJ reply: the command, its result, the state, then the
+//! current frame, the frame count and the completed loops as big-endian
+//! 16-bit values. Interrupts must be masked.
+//!
+//! \param ucCommand is the command answered
+//! \param ucResult is HIRCP_TRAJ_OK or the reason the command failed
+//! \param pucReply receives HIRCP_TRAJ_PAYLOAD_LEN bytes
+//!
+//! \return None
+//
+//****************************************************************************
+static void PackStatus(unsigned char ucCommand, unsigned char ucResult,
+                       unsigned char *pucReply)
+{
+    unsigned short usNumFrames = (g_ucState == HIRCP_TRAJ_EMPTY) ? 0 : g_usNumFrames;
+
+    memset(pucReply, 0, HIRCP_TRAJ_PAYLOAD_LEN);
+    pucReply[0] = ucCommand;
+    pucReply[1] = ucResult;
+    pucReply[2] = g_ucState;
+    pucReply[3] = (g_usFrame >> 8) & 0xFF;
+    pucReply[4] = g_usFrame & 0xFF;
+    pucReply[5] = (usNumFrames >> 8) & 0xFF;
+    pucReply[6] = usNumFrames & 0xFF;
+    pucReply[7] = (g_usLoops >> 8) & 0xFF;
+    pucReply[8] = g_usLoops & 0xFF;
+}
+
+//****************************************************************************
+//
+//! Masks interrupts around changes the playback interrupt reads
+//!
+//! \return whether interrupts were already disabled
+//
+//****************************************************************************
+static tBoolean EnterCritical(void)
+{
+    return MAP_IntMasterDisable();
+}
+
+static void ExitCritical(tBoolean bWasDisabled)
+{
+    if (!bWasDisabled)
+    {
+        MAP_IntMasterEnable();
+    }
+}
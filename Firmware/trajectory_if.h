@@ -0,0 +1,58 @@
+#ifndef __TRAJECTORY_IF_H__
+#define __TRAJECTORY_IF_H__
+//*****************************************************************************
+//
+// trajectory_if.h
+//
+// Header file for on-board trajectory playback. A recorded sequence of poses
+// is uploaded with TRAJ packets into RAM and played from the pose playback
+// tick, so a replayed motion does not depend on the network.
+//
+// Copyright (c) 2015 Brandon To, Minh Mai, and Yuzhou Liu
+// This code is licensed under BSD license (see LICENSE.txt for details)
+//
+// Project: Human Interface for Robotic Control
+//
+// Created:
+// October 19, 2026
+//
+// Modified:
+// October 19, 2026
+//
+//*****************************************************************************
+
+#include "hw_types.h"
+#include "servo_driver_if.h"
+
+// Frames that fit in RAM, NUM_SERVOS bytes each. About 68 seconds of a
+// recording made at 30 frames per second.
+#define TRAJECTORY_MAX_FRAMES       2048
+
+//****************************************************************************
+// Handles a TRAJ payload and writes the reply into pucReply, which holds
+// HIRCP_TRAJ_PAYLOAD_LEN bytes. Returns false for a command that is not
+// answered. ucMode is the HIRCP mode of the connection; playback only runs
+// in the modes that play poses.
+//****************************************************************************
+tBoolean HandleTrajectoryCommand(const unsigned char *pucPayload, unsigned char ucMode,
+                                 unsigned char *pucReply);
+
+//****************************************************************************
+// Ends playback. The trajectory stays uploaded.
+//****************************************************************************
+void StopTrajectory(void);
+
+//****************************************************************************
+// Returns true while a trajectory is playing or paused, when it owns the
+// servo targets
+//****************************************************************************
+tBoolean IsTrajectoryActive(void);
+
+//****************************************************************************
+// Advances playback to ulNow, in microseconds, and writes the pose that is
+// due into pucPose, NUM_SERVOS positions in degrees. Returns false if no
+// trajectory is active. Called from the pose playback interrupt.
+//****************************************************************************
+tBoolean StepTrajectory(unsigned long ulNow, unsigned char *pucPose);
+
+#endif //  __TRAJECTORY_IF_H__